@@ -11,7 +11,7 @@
 # Version: 3.5.0
 # Date: October 13, 2025
 
-QT += core widgets multimedia multimediawidgets
+QT += core widgets concurrent multimedia
 
 
 CONFIG += c++20
@@ -21,12 +21,66 @@ TEMPLATE = app
 
 SOURCES += src/gui/photo_smith.cpp \
            src/gui/ColorWheelDialog.cpp \
+           src/gui/QtProgressReporter.cpp \
+           src/gui/DiagnosticsDialog.cpp \
            src/core/filters/ImageFilters.cpp \
-           src/core/image/Image_Class.cpp
+           src/core/filters/BlurEngine.cpp \
+           src/core/filters/OilPaintEngine.cpp \
+           src/core/filters/WarpEngine.cpp \
+           src/core/filters/FrameEngine.cpp \
+           src/core/filters/BlendEngine.cpp \
+           src/core/filters/EdgeEngine.cpp \
+           src/core/filters/FilterPipeline.cpp \
+           src/core/parallel/ThreadPool.cpp \
+           src/core/simd/PointKernels.cpp \
+           src/core/history/HistoryManager.cpp \
+           src/core/history/HistoryCodec.cpp \
+           src/core/history/CommandHistory.cpp \
+           src/core/diagnostics/OperationTrace.cpp \
+           src/core/image/BufferPool.cpp \
+           src/core/image/Image_Class.cpp \
+           src/core/image/ImagePyramid.cpp \
+           src/core/image/DirtyRegion.cpp \
+           src/core/image/PixelConverter.cpp \
+           src/core/image/Resampler.cpp \
+           src/core/image/TiledImage.cpp \
+           src/core/io/ImageCodecs.cpp \
+           src/core/io/ImageLoader.cpp \
+           src/core/io/codecs/StbCodec.cpp
 
-HEADERS += src/core/image/Image_Class.h \
+HEADERS += src/core/image/BufferPool.h \
+           src/core/image/Image_Class.h \
+           src/core/image/ImageView.h \
+           src/core/image/ImagePyramid.h \
+           src/core/image/DirtyRegion.h \
+           src/core/image/PixelFormat.h \
+           src/core/image/PixelConverter.h \
+           src/core/image/Resampler.h \
+           src/core/image/TiledImage.h \
            src/core/filters/ImageFilters.h \
-           src/gui/ColorWheelDialog.h
+           src/core/filters/BlurEngine.h \
+           src/core/filters/OilPaintEngine.h \
+           src/core/filters/WarpEngine.h \
+           src/core/filters/FrameEngine.h \
+           src/core/filters/BlendEngine.h \
+           src/core/filters/EdgeEngine.h \
+           src/core/filters/Stencil.h \
+           src/core/filters/NoiseSource.h \
+           src/core/filters/FilterPipeline.h \
+           src/core/filters/ProgressReporter.h \
+           src/core/parallel/ThreadPool.h \
+           src/core/parallel/BoundedQueue.h \
+           src/core/simd/PointKernels.h \
+           src/core/history/HistoryManager.h \
+           src/core/history/HistoryCodec.h \
+           src/core/history/CommandHistory.h \
+           src/core/diagnostics/OperationTrace.h \
+           src/core/io/ImageCodecs.h \
+           src/core/io/ImageLoader.h \
+           src/core/io/codecs/CodecBackends.h \
+           src/gui/ColorWheelDialog.h \
+           src/gui/QtProgressReporter.h \
+           src/gui/DiagnosticsDialog.h
 
 FORMS += src/gui/mainwindow.ui
 
@@ -36,6 +90,25 @@ INCLUDEPATH += src/core \
 
 QMAKE_CXXFLAGS += -std=c++20
 
+# Optional codec backends: qmake CONFIG+=jpeg_turbo CONFIG+=spng CONFIG+=webp
+jpeg_turbo {
+    SOURCES += src/core/io/codecs/JpegTurboCodec.cpp
+    DEFINES += PHOTOSMITH_HAVE_JPEG_TURBO
+    LIBS += -ljpeg
+}
+spng {
+    CONFIG += link_pkgconfig
+    PKGCONFIG += spng
+    SOURCES += src/core/io/codecs/SpngCodec.cpp
+    DEFINES += PHOTOSMITH_HAVE_SPNG
+}
+webp {
+    CONFIG += link_pkgconfig
+    PKGCONFIG += libwebp
+    SOURCES += src/core/io/codecs/WebpCodec.cpp
+    DEFINES += PHOTOSMITH_HAVE_WEBP
+}
+
 # Disable warnings for STB library
 QMAKE_CXXFLAGS += -Wno-missing-field-initializers
 
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Compare two photosmith-bench JSON files, e.g. before and after a change.
+
+Usage: compare.py BASELINE.json CANDIDATE.json [--threshold PERCENT]
+
+Prints the change in best time for every case present in both files and
+exits with status 1 if any case got slower than the threshold (default 10%).
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {(b["name"], round(b["megapixels"], 1)): b for b in data["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent reported as a regression (default: 10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    candidate = load(args.candidate)
+    regressions = 0
+
+    print(f"{'case':28} {'MP':>6} {'base ms':>10} {'new ms':>10} {'change':>8}")
+    for key in sorted(baseline.keys() & candidate.keys()):
+        old = baseline[key]["best_ms"]
+        new = candidate[key]["best_ms"]
+        change = (new - old) / old * 100.0 if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  slower"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  faster"
+        print(f"{key[0]:28} {key[1]:6.1f} {old:10.2f} {new:10.2f} {change:+7.1f}%{flag}")
+
+    for key in sorted(baseline.keys() - candidate.keys()):
+        print(f"{key[0]:28} {key[1]:6.1f}  only in baseline")
+    for key in sorted(candidate.keys() - baseline.keys()):
+        print(f"{key[0]:28} {key[1]:6.1f}  only in candidate")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,454 @@
+/**
+ * @file photosmith_bench.cpp
+ * @brief Headless throughput benchmarks for filters, file I/O and history.
+ *
+ * Times every ImageFilters::apply* method, ImageCodecs::load()/save() per
+ * format, display-pyramid building and HistoryManager push/undo on
+ * synthetic images (1 to 50 megapixels by default). No display is needed.
+ *
+ * @details For each case the benchmark reports:
+ * - The fastest and the median wall time over the repetitions
+ * - Throughput in megapixels per second, based on the fastest time
+ * - Peak resident memory of the process while the case ran (Linux resets the
+ *   peak before each case; elsewhere it is the peak so far)
+ *
+ * Results print as a table; --json writes them in a form that
+ * benchmarks/compare.py can diff between two commits.
+ *
+ * @code
+ * photosmith-bench                              # all cases, 1, 12 and 50 MP
+ * photosmith-bench --sizes 1,4 --filter blur    # cases whose name contains "blur"
+ * photosmith-bench --json before.json
+ * @endcode
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "image/Image_Class.h"
+#include "image/ImagePyramid.h"
+#include "filters/ImageFilters.h"
+#include "filters/FilterPipeline.h"
+#include "history/HistoryManager.h"
+#include "io/ImageCodecs.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief One benchmark: untimed setup, then the timed operation.
+ */
+struct Case {
+    std::string name;
+    std::function<void()> setup; ///< Prepares the inputs of one repetition (not timed)
+    std::function<void()> run;   ///< The operation being measured
+};
+
+/**
+ * @brief Measurements of one case at one image size.
+ */
+struct Result {
+    std::string name;
+    double megapixels = 0.0;
+    int width = 0;
+    int height = 0;
+    int iterations = 0;
+    double bestMs = 0.0;
+    double medianMs = 0.0;
+    double peakMiB = 0.0;
+};
+
+/**
+ * @brief Peak resident set size of the process in bytes (0 if unknown).
+ */
+std::size_t peakMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return counters.PeakWorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    // VmHWM, unlike getrusage(), honours resetPeakMemory()
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.rfind("VmHWM:", 0) == 0) return static_cast<std::size_t>(std::stoull(line.substr(6))) * 1024;
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return static_cast<std::size_t>(usage.ru_maxrss); // bytes on macOS
+#endif
+}
+
+/**
+ * @brief Lets the next peakMemory() cover only what follows (Linux 4.0+; no-op elsewhere).
+ */
+void resetPeakMemory()
+{
+#ifdef __linux__
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+/**
+ * @brief Builds a deterministic test image with gradients, edges and noise.
+ *
+ * Flat synthetic images would flatter the codecs and the history delta
+ * compression, so every pixel gets a little pseudo-random noise.
+ */
+Image makeSyntheticImage(int width, int height, std::uint32_t seed)
+{
+    Image image(width, height);
+    std::uint32_t state = seed * 2654435761u + 1;
+    for (int y = 0; y < height; ++y) {
+        unsigned char* row = image.imageData + static_cast<std::size_t>(y) * width * 3;
+        for (int x = 0; x < width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            const int noise = static_cast<int>(state >> 28) - 8;
+            const int block = ((x / 64) + (y / 64)) % 2 ? 40 : 0;
+            row[x * 3 + 0] = static_cast<unsigned char>(std::clamp(x * 255 / width + noise, 0, 255));
+            row[x * 3 + 1] = static_cast<unsigned char>(std::clamp(y * 255 / height + block + noise, 0, 255));
+            row[x * 3 + 2] = static_cast<unsigned char>(std::clamp(128 + block - noise, 0, 255));
+        }
+    }
+    return image;
+}
+
+/**
+ * @brief A private copy of @p image, so timed code never pays for copy-on-write.
+ */
+Image deepCopy(const Image& image)
+{
+    Image copy = image;
+    copy.detach();
+    return copy;
+}
+
+/**
+ * @brief Runs @p benchmark until @p minSeconds have been spent timing it.
+ */
+Result measure(const Case& benchmark, double minSeconds, int maxIterations)
+{
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times;
+    double total = 0.0;
+    resetPeakMemory();
+    while (times.empty() || (total < minSeconds && static_cast<int>(times.size()) < maxIterations)) {
+        if (benchmark.setup) benchmark.setup();
+        const Clock::time_point start = Clock::now();
+        benchmark.run();
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        times.push_back(seconds * 1000.0);
+        total += seconds;
+    }
+    std::sort(times.begin(), times.end());
+
+    Result result;
+    result.name = benchmark.name;
+    result.iterations = static_cast<int>(times.size());
+    result.bestMs = times.front();
+    result.medianMs = times[times.size() / 2];
+    result.peakMiB = static_cast<double>(peakMemory()) / (1024.0 * 1024.0);
+    return result;
+}
+
+/**
+ * @brief Inputs and state shared by the cases of one image size.
+ */
+struct Workspace {
+    Image source;               ///< Input image (never modified)
+    Image other;                ///< Second input, for merge
+    Image otherHalf;            ///< Second input at half size, for scaled merges
+    Image work;                 ///< Image each case mutates; reset from source by the setups
+    Image before;               ///< Pre-filter copy required by the cancelable filters
+    Image next;                 ///< Next state pushed by the history cases
+    std::atomic<bool> cancel{false};
+    ImageFilters filters;       ///< No reporter: progress updates would only add noise
+    HistoryManager history;
+    ImagePyramid pyramid;
+    fs::path scratchDir;        ///< Directory for the I/O cases' files
+};
+
+/**
+ * @brief Every benchmark case, operating on @p ws.
+ */
+std::vector<Case> makeCases(Workspace& ws)
+{
+    std::vector<Case> cases;
+    ImageFilters& filters = ws.filters;
+    auto reset = [&ws]() { ws.work = deepCopy(ws.source); };
+    auto addFilter = [&](const std::string& name, std::function<void()> run) {
+        cases.push_back({"filter/" + name, reset, std::move(run)});
+    };
+
+    // Filters with progress and cancellation
+    addFilter("grayscale", [&]() { filters.applyGrayscale(ws.work, ws.before, ws.cancel); });
+    addFilter("black-and-white", [&]() { filters.applyBlackAndWhite(ws.work, ws.before, ws.cancel); });
+    addFilter("invert", [&]() { filters.applyInvert(ws.work, ws.before, ws.cancel); });
+    addFilter("tv", [&]() { filters.applyTVFilter(ws.work, ws.before, ws.cancel, 1); });
+    addFilter("infrared", [&]() { filters.applyInfrared(ws.work, ws.before, ws.cancel); });
+    addFilter("purple", [&]() { filters.applyPurpleFilter(ws.work, ws.before, ws.cancel); });
+    addFilter("tint", [&]() { filters.applyColorTint(ws.work, ws.before, ws.cancel, 255, 120, 0, 0.5); });
+    addFilter("blur", [&]() { filters.applyBlur(ws.work, ws.before, ws.cancel, 60); });
+    addFilter("gaussian-blur", [&]() { filters.applyGaussianBlur(ws.work, ws.before, ws.cancel, 60); });
+    addFilter("emboss", [&]() { filters.applyEmboss(ws.work, ws.before, ws.cancel); });
+    addFilter("double-vision", [&]() { filters.applyDoubleVision(ws.work, ws.before, ws.cancel); });
+    addFilter("oil-painting", [&]() { filters.applyOilPainting(ws.work, ws.before, ws.cancel); });
+    addFilter("sunlight", [&]() { filters.applyEnhanceSunlight(ws.work, ws.before, ws.cancel); });
+    addFilter("fisheye", [&]() { filters.applyFishEye(ws.work, ws.before, ws.cancel); });
+    addFilter("pipeline-4-stages", [&]() {
+        FilterPipeline pipeline;
+        pipeline.grayscale().darkAndLight(false, 20).colorTint(255, 120, 0, 0.3).invert();
+        filters.applyPipeline(ws.work, ws.before, ws.cancel, pipeline);
+    });
+
+    // Immediate filters
+    addFilter("darken", [&]() { filters.applyDarkAndLight(ws.work, "Darken", 50); });
+    addFilter("lighten", [&]() { filters.applyDarkAndLight(ws.work, "Lighten", 50); });
+    addFilter("flip-horizontal", [&]() { filters.applyFlip(ws.work, "Horizontal"); });
+    addFilter("flip-vertical", [&]() { filters.applyFlip(ws.work, "Vertical"); });
+    addFilter("rotate-90", [&]() { filters.applyRotate(ws.work, 90); });
+    addFilter("rotate-180", [&]() { filters.applyRotate(ws.work, 180); });
+    addFilter("rotate-270", [&]() { filters.applyRotate(ws.work, 270); });
+    addFilter("rotate-30", [&]() { filters.applyRotate(ws.work, 30); });
+    addFilter("frame-solid", [&]() { filters.applyFrame(ws.work, 20, 0, 0, 255); });
+    addFilter("frame-gold", [&]() { filters.applyFrame(ws.work, "Gold Decorated Frame", 20, 212, 175, 55); });
+    addFilter("edges", [&]() { filters.applyEdges(ws.work); });
+    addFilter("edges-magnitude", [&]() { filters.applyEdges(ws.work, EdgeEngine::Output::Magnitude); });
+    addFilter("resize-half", [&]() {
+        filters.applyResize(ws.work, std::max(1, ws.source.width / 2), std::max(1, ws.source.height / 2));
+    });
+    addFilter("resize-double", [&]() { filters.applyResize(ws.work, ws.source.width * 2, ws.source.height * 2); });
+    addFilter("resize-fifth-box", [&]() {
+        filters.applyResize(ws.work, std::max(1, ws.source.width / 5), std::max(1, ws.source.height / 5),
+                            Resampler::Filter::Box);
+    });
+    addFilter("resize-half-bilinear", [&]() {
+        filters.applyResize(ws.work, std::max(1, ws.source.width / 2), std::max(1, ws.source.height / 2),
+                            Resampler::Filter::Bilinear);
+    });
+    addFilter("skew", [&]() { filters.applySkew(ws.work, 40.0); });
+    addFilter("merge", [&]() {
+        filters.applyMerge(ws.work, ws.other);
+    });
+    addFilter("merge-overlay-scaled", [&]() {
+        // Overlay mode with the second image scaled up from half size while blending
+        filters.applyMerge(ws.work, ws.otherHalf, BlendEngine::Mode::Overlay, 70);
+    });
+
+    // Codecs, through a file on disk as the GUI and CLI use them (whichever backends are built in)
+    for (const std::string& ext : ImageCodecs::extensions()) {
+        if (ext == ".jpeg") continue; // same codec as .jpg
+        const std::string format = ext.substr(1);
+        const std::string path = (ws.scratchDir / ("bench" + ext)).string();
+        cases.push_back({"io/save-" + format, {}, [&ws, path]() { ImageCodecs::save(ws.source, path); }});
+        cases.push_back({"io/load-" + format,
+                         [&ws, path]() { if (!fs::exists(path)) ImageCodecs::save(ws.source, path); },
+                         [&ws, path]() { ws.work = ImageCodecs::load(path); }});
+    }
+    // Preview decode at a quarter of the size; only scaling codecs (libjpeg-turbo) gain from it
+    const std::string previewPath = (ws.scratchDir / "bench.jpg").string();
+    cases.push_back({"io/load-jpg-preview",
+                     [&ws, previewPath]() { if (!fs::exists(previewPath)) ImageCodecs::save(ws.source, previewPath); },
+                     [&ws, previewPath]() {
+                         ws.work = ImageCodecs::load(previewPath, {ws.source.width / 4, ws.source.height / 4});
+                     }});
+
+    // Display scaling: the pyramid from the full image down to a screen-sized level
+    cases.push_back({"display/pyramid-to-1080p",
+                     [&ws]() { ws.pyramid.clear(); ws.work = deepCopy(ws.source); },
+                     [&ws]() {
+                         ws.pyramid.sync(ws.work);
+                         ws.pyramid.levelFor(1920, 1080);
+                     }});
+    cases.push_back({"display/scale-to-1080p",
+                     [&ws]() { ws.pyramid.clear(); ws.work = deepCopy(ws.source); },
+                     [&ws]() {
+                         ws.pyramid.sync(ws.work);
+                         ws.next = ws.pyramid.scaled(1440, 1080);
+                     }});
+
+    // History: pushing packs the previous top against the new state, undo unpacks it
+    auto prepareHistory = [&ws]() {
+        ws.history.clear();
+        ws.history.pushUndo(deepCopy(ws.source));
+        ws.next = deepCopy(ws.source);
+        ws.filters.applyDarkAndLight(ws.next, "Darken", 10);
+    };
+    cases.push_back({"history/push", prepareHistory, [&ws]() { ws.history.pushUndo(std::move(ws.next)); }});
+    cases.push_back({"history/undo",
+                     [&ws, prepareHistory]() {
+                         prepareHistory();
+                         ws.history.pushUndo(std::move(ws.next));
+                         ws.work = deepCopy(ws.source);
+                     },
+                     [&ws]() { ws.history.undo(ws.work); }});
+    return cases;
+}
+
+std::string jsonEscape(const std::string& text)
+{
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void writeJson(const std::string& path, const std::vector<Result>& results)
+{
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("Cannot write " + path);
+    out << "{\n  \"context\": {\n"
+        << "    \"threads\": " << ThreadPool::instance().concurrency() << ",\n"
+        << "    \"build_date\": \"" << __DATE__ << "\"\n  },\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"megapixels\": " << r.megapixels
+            << ", \"width\": " << r.width << ", \"height\": " << r.height
+            << ", \"iterations\": " << r.iterations << ", \"best_ms\": " << r.bestMs
+            << ", \"median_ms\": " << r.medianMs
+            << ", \"mpix_per_s\": " << r.megapixels / (r.bestMs / 1000.0)
+            << ", \"peak_mib\": " << r.peakMiB << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+std::vector<double> parseSizes(const std::string& text)
+{
+    std::vector<double> sizes;
+    std::stringstream stream(text);
+    for (std::string item; std::getline(stream, item, ',');) {
+        const double megapixels = std::stod(item);
+        if (megapixels <= 0.0) throw std::invalid_argument("Sizes must be positive");
+        sizes.push_back(megapixels);
+    }
+    return sizes;
+}
+
+void printHelp(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --sizes LIST      Image sizes in megapixels (default: 1,12,50)\n"
+              << "  --filter TEXT     Only run cases whose name contains TEXT\n"
+              << "  --min-time SEC    Time spent on each case (default: 0.5)\n"
+              << "  --max-iter N      Repetitions per case at most (default: 50)\n"
+              << "  --json FILE       Also write the results as JSON\n"
+              << "  --list            List the case names\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<double> sizes = {1.0, 12.0, 50.0};
+    std::string nameFilter;
+    std::string jsonPath;
+    double minSeconds = 0.5;
+    int maxIterations = 50;
+    bool listOnly = false;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--sizes") sizes = parseSizes(value());
+            else if (arg == "--filter") nameFilter = value();
+            else if (arg == "--min-time") minSeconds = std::stod(value());
+            else if (arg == "--max-iter") maxIterations = std::max(1, std::stoi(value()));
+            else if (arg == "--json") jsonPath = value();
+            else if (arg == "--list") listOnly = true;
+            else if (arg == "-h" || arg == "--help") { printHelp(argv[0]); return 0; }
+            else throw std::invalid_argument("Unknown option: " + arg);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << argv[0] << ": " << e.what() << "\n";
+        return 2;
+    }
+
+    const fs::path scratchDir = fs::temp_directory_path() / "photosmith-bench";
+    fs::create_directories(scratchDir);
+    std::vector<Result> results;
+
+    std::printf("%-28s %8s %6s %11s %11s %10s %10s\n", "case", "MP", "iters", "best ms", "median ms", "MPix/s", "peak MiB");
+    for (double megapixels : sizes) {
+        // 4:3 frame, like most camera sensors
+        const int width = std::max(1, static_cast<int>(std::lround(std::sqrt(megapixels * 1e6 * 4.0 / 3.0))));
+        const int height = std::max(1, static_cast<int>(std::lround(megapixels * 1e6 / width)));
+        const double actualMegapixels = static_cast<double>(width) * height / 1e6;
+        Workspace ws;
+        ws.source = makeSyntheticImage(width, height, 1);
+        ws.other = makeSyntheticImage(width, height, 2);
+        ws.otherHalf = makeSyntheticImage(std::max(1, width / 2), std::max(1, height / 2), 2);
+        ws.scratchDir = scratchDir;
+
+        for (const Case& benchmark : makeCases(ws)) {
+            if (!nameFilter.empty() && benchmark.name.find(nameFilter) == std::string::npos) continue;
+            if (listOnly) {
+                std::printf("%s\n", benchmark.name.c_str());
+                continue;
+            }
+            try {
+                Result result = measure(benchmark, minSeconds, maxIterations);
+                result.megapixels = actualMegapixels;
+                result.width = width;
+                result.height = height;
+                std::printf("%-28s %8.1f %6d %11.2f %11.2f %10.1f %10.1f\n", result.name.c_str(), actualMegapixels,
+                            result.iterations, result.bestMs, result.medianMs,
+                            actualMegapixels / (result.bestMs / 1000.0), result.peakMiB);
+                std::fflush(stdout);
+                results.push_back(result);
+            } catch (const std::exception& e) {
+                std::fprintf(stderr, "%s (%.1f MP) failed: %s\n", benchmark.name.c_str(), actualMegapixels, e.what());
+            }
+        }
+        if (listOnly) break;
+    }
+
+    std::error_code ignored;
+    fs::remove_all(scratchDir, ignored);
+    if (!jsonPath.empty()) {
+        try {
+            writeJson(jsonPath, results);
+        } catch (const std::exception& e) {
+            std::cerr << argv[0] << ": " << e.what() << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file BatchPipeline.cpp
+ * @brief Implementation of the batch decode -> filter -> encode pipeline.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "BatchPipeline.h"
+#include "image/Image_Class.h"
+#include "filters/ImageFilters.h"
+#include "filters/ProgressReporter.h"
+#include "parallel/BoundedQueue.h"
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief An image travelling between two stages.
+ */
+struct Item {
+    std::size_t job = 0; ///< Index into the job list
+    Image image;
+};
+
+/**
+ * @brief Starts @p count threads running @p work; the last one to finish closes @p output.
+ */
+template <typename Work>
+void startStage(std::vector<std::thread>& threads, int count, BoundedQueue<Item>* output, Work work)
+{
+    auto remaining = std::make_shared<std::atomic<int>>(count);
+    for (int i = 0; i < count; ++i) {
+        threads.emplace_back([output, work, remaining]() {
+            work();
+            if (--*remaining == 0 && output) output->close();
+        });
+    }
+}
+
+} // namespace
+
+BatchPipeline::BatchPipeline(Recipe recipe, int threadsPerStage, const ImageEncodeOptions& encodeOptions)
+    : recipe(std::move(recipe)), threadsPerStage(std::max(1, threadsPerStage)), encodeOptions(encodeOptions) {}
+
+BatchPipeline::Summary BatchPipeline::run(const std::vector<Job>& jobs, std::atomic<bool>& cancelRequested,
+                                          ProgressReporter* reporter) const
+{
+    const std::size_t capacity = static_cast<std::size_t>(threadsPerStage) * 2;
+    BoundedQueue<Item> decoded(capacity);
+    BoundedQueue<Item> filtered(capacity);
+    std::atomic<std::size_t> nextJob{0};
+    std::atomic<std::size_t> written{0};
+    std::atomic<std::size_t> failed{0};
+    const int total = static_cast<int>(jobs.size());
+
+    auto fail = [&](std::size_t job, const std::string& what) {
+        const std::size_t count = ++failed;
+        if (reporter) {
+            reporter->showStatus("Failed: " + jobs[job].input + ": " + what);
+            reporter->updateProgress(static_cast<int>(count + written), total);
+        }
+    };
+
+    // Whichever stage notices a cancel request first drops the queued images,
+    // which wakes every thread blocked on a full or empty queue
+    auto cancelled = [&]() {
+        if (!cancelRequested) return false;
+        decoded.cancel();
+        filtered.cancel();
+        return true;
+    };
+
+    if (reporter) reporter->beginProgress(total);
+    std::vector<std::thread> threads;
+
+    // Decode: claim files in order until none are left, in the first step's own formats if the file has one
+    ImageDecodeOptions decodeOptions;
+    decodeOptions.formats = recipe.inputFormats();
+    startStage(threads, threadsPerStage, &decoded, [&]() {
+        for (std::size_t job; !cancelled() && (job = nextJob++) < jobs.size();) {
+            Item item;
+            item.job = job;
+            try {
+                item.image = ImageCodecs::load(jobs[job].input, decodeOptions);
+            } catch (const std::exception& e) {
+                fail(job, e.what());
+                continue;
+            }
+            if (!decoded.push(std::move(item))) break;
+        }
+    });
+
+    // Filter: one ImageFilters per thread, reporting nothing (progress is per file)
+    startStage(threads, threadsPerStage, &filtered, [&]() {
+        ImageFilters filters;
+        while (std::optional<Item> item = decoded.pop()) {
+            try {
+                if (!recipe.apply(filters, item->image, cancelRequested)) {
+                    cancelled();
+                    break;
+                }
+            } catch (const std::exception& e) {
+                fail(item->job, e.what());
+                continue;
+            }
+            if (!filtered.push(std::move(*item))) break;
+        }
+    });
+
+    // Encode: the format follows the output file's extension
+    startStage(threads, threadsPerStage, nullptr, [&]() {
+        while (std::optional<Item> item = filtered.pop()) {
+            if (cancelled()) break;
+            try {
+                ImageCodecs::save(item->image, jobs[item->job].output, encodeOptions);
+            } catch (const std::exception& e) {
+                fail(item->job, e.what());
+                continue;
+            }
+            const std::size_t count = ++written;
+            if (reporter) {
+                reporter->updateProgress(static_cast<int>(count + failed), total);
+                reporter->showStatus("Wrote " + jobs[item->job].output);
+            }
+        }
+    });
+
+    for (std::thread& thread : threads) thread.join();
+    if (reporter) reporter->endProgress();
+
+    Summary summary;
+    summary.written = written;
+    summary.failed = failed;
+    summary.cancelled = cancelRequested;
+    return summary;
+}
+
+BatchPipeline::Summary BatchPipeline::runTiled(const std::vector<Job>& jobs, std::atomic<bool>& cancelRequested,
+                                               ProgressReporter* reporter, const TiledImage::Options& options) const
+{
+    if (!recipe.tileable()) throw std::logic_error("The recipe has filters that need the whole image");
+
+    Summary summary;
+    ImageFilters filters;
+    const int total = static_cast<int>(jobs.size());
+    if (reporter) reporter->beginProgress(total);
+
+    for (const Job& job : jobs) {
+        if (cancelRequested) break;
+        try {
+            const TiledImage source = TiledImage::load(job.input, options);
+            TiledImage result(source.width, source.height, options);
+            if (!recipe.apply(filters, source, result, cancelRequested)) break;
+            result.save(job.output, encodeOptions);
+            ++summary.written;
+            if (reporter) reporter->showStatus("Wrote " + job.output);
+        } catch (const std::exception& e) {
+            ++summary.failed;
+            if (reporter) reporter->showStatus("Failed: " + job.input + ": " + e.what());
+        }
+        if (reporter) reporter->updateProgress(static_cast<int>(summary.written + summary.failed), total);
+    }
+    if (reporter) reporter->endProgress();
+
+    summary.cancelled = cancelRequested;
+    return summary;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file BatchPipeline.h
+ * @brief Pipelined decode -> filter -> encode runner for batches of image files.
+ *
+ * This file declares the BatchPipeline class used by photosmith-cli. Each image
+ * moves through three stages, each with its own worker threads, connected by
+ * bounded queues: while one image is being filtered, the next ones are being
+ * decoded and the previous ones encoded. The queues cap the images in flight,
+ * so memory stays bounded however many files the batch has.
+ *
+ * @details The pipeline provides:
+ * - Decoder, filter and encoder threads, sized by the caller
+ * - Bounded hand-off queues between stages (see BoundedQueue)
+ * - Per-file error handling: a bad file is reported and skipped
+ * - Cancellation through an atomic flag (e.g. set from a SIGINT handler)
+ * - Per-file progress through a ProgressReporter
+ * - A tiled mode for images larger than memory (see runTiled())
+ *
+ * @note Filters that use the shared ThreadPool take turns on it, so the filter
+ *       stage gains most from its own threads with serial filters.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BATCHPIPELINE_H
+#define BATCHPIPELINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "image/TiledImage.h"
+#include "io/ImageCodecs.h"
+
+class ProgressReporter;
+
+/**
+ * @class BatchPipeline
+ * @brief Applies one recipe to many files across all cores.
+ *
+ * @code
+ * BatchPipeline pipeline(Recipe::parse("grayscale"), 4);
+ * BatchPipeline::Summary summary = pipeline.run(jobs, cancelRequested, &reporter);
+ * @endcode
+ */
+class BatchPipeline {
+public:
+    /**
+     * @brief One file to process.
+     */
+    struct Job {
+        std::string input;  ///< Path of the image to read
+        std::string output; ///< Path to write the result to (format from its extension)
+    };
+
+    /**
+     * @brief Outcome of a run.
+     */
+    struct Summary {
+        std::size_t written = 0; ///< Files processed and saved
+        std::size_t failed = 0;  ///< Files that could not be read, filtered or written
+        bool cancelled = false;  ///< True if the run stopped early
+    };
+
+    /**
+     * @param recipe Filters applied to every image
+     * @param threadsPerStage Worker threads for each of the three stages (at least 1)
+     * @param encodeOptions Quality and compression for the written files
+     */
+    BatchPipeline(Recipe recipe, int threadsPerStage, const ImageEncodeOptions& encodeOptions = ImageEncodeOptions());
+
+    /**
+     * @brief Processes @p jobs and blocks until all are done or cancelled.
+     *
+     * @param jobs Files to process
+     * @param cancelRequested Stops the run: no new files start, queued ones are dropped
+     * @param reporter Receives per-file progress and error messages (can be nullptr)
+     * @return Counts of written and failed files
+     */
+    Summary run(const std::vector<Job>& jobs, std::atomic<bool>& cancelRequested, ProgressReporter* reporter) const;
+
+    /**
+     * @brief Processes @p jobs one at a time, each tile by tile out of core.
+     *
+     * Every image is loaded into a TiledImage, filtered one tile at a time
+     * and saved from the tiles, so memory stays near the tile cache budget
+     * whatever the image size. The filters still use the ThreadPool on each
+     * tile, but files are not overlapped as in run().
+     *
+     * @param jobs Files to process
+     * @param cancelRequested Stops the run between tiles
+     * @param reporter Receives per-file progress and error messages (can be nullptr)
+     * @param options Tile size, cache budget and scratch directory
+     * @return Counts of written and failed files
+     * @throws std::logic_error If the recipe is not Recipe::tileable()
+     */
+    Summary runTiled(const std::vector<Job>& jobs, std::atomic<bool>& cancelRequested, ProgressReporter* reporter,
+                     const TiledImage::Options& options) const;
+
+private:
+    Recipe recipe;        ///< Filters applied to every image
+    int threadsPerStage;  ///< Worker threads per stage
+    ImageEncodeOptions encodeOptions; ///< Quality and compression for the written files
+};
+
+#endif // BATCHPIPELINE_H
@@ -0,0 +1,370 @@
+/**
+ * @file Recipe.cpp
+ * @brief Implementation of the filter recipe parser.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "Recipe.h"
+#include "image/Image_Class.h"
+#include "image/PixelConverter.h"
+#include "image/TiledImage.h"
+#include "image/Resampler.h"
+#include "filters/ImageFilters.h"
+#include "filters/BlurEngine.h"
+#include "filters/EdgeEngine.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+using Args = std::vector<std::string>;
+
+/**
+ * @brief One filter the recipe language knows.
+ */
+struct FilterSpec {
+    const char* name;   ///< Name used in recipes
+    const char* params; ///< Parameter list shown by usage()
+    std::size_t minArgs;
+    std::size_t maxArgs;
+    Recipe::Step (*make)(const Args& args); ///< Builds the step from its parameters
+    int (*halo)(const Args& args, double pixelScale); ///< Context pixels the step needs; nullptr = whole image
+    PixelFormatSet formats = {PixelFormat::rgb8()};   ///< Pixel formats the filter handles without conversion
+};
+
+/// Formats of filters that work on any 8-bit channel count.
+constexpr PixelFormatSet kAnyChannels = PixelFormatSet::interleaved8();
+/// Formats of filters that treat every channel alike and so cannot leave alpha alone.
+constexpr PixelFormatSet kGrayOrRgb = {PixelFormat::gray8(), PixelFormat::rgb8()};
+
+int toInt(const Args& args, std::size_t index, int fallback, int low, int high)
+{
+    if (index >= args.size()) return fallback;
+    const std::string& text = args[index];
+    std::size_t used = 0;
+    int value = 0;
+    try {
+        value = std::stoi(text, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != text.size()) {
+        throw std::invalid_argument("Not a number: '" + text + "'");
+    }
+    if (value < low || value > high) {
+        throw std::invalid_argument("Out of range [" + std::to_string(low) + ", " + std::to_string(high) + "]: " + text);
+    }
+    return value;
+}
+
+Resampler::Filter toFilter(const Args& args, std::size_t index, Resampler::Filter fallback)
+{
+    return index < args.size() ? Resampler::parse(args[index]) : fallback;
+}
+
+/// Steps whose filter only takes the image, its snapshot and the cancel flag.
+template <void (ImageFilters::*Filter)(Image&, Image&, std::atomic<bool>&)>
+Recipe::Step cancelable(const Args&)
+{
+    return [](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+        Image before = image; // O(1): shares the buffer copy-on-write
+        (filters.*Filter)(image, before, cancelRequested);
+    };
+}
+
+/// Halo of filters whose output pixel depends only on the same input pixel.
+int pointHalo(const Args&, double)
+{
+    return 0;
+}
+
+/// Halo of filters with a fixed neighbourhood.
+template <int Pixels>
+int fixedHalo(const Args&, double)
+{
+    return Pixels;
+}
+
+/// Halo of filters whose first parameter is their reach in pixels.
+template <int Fallback>
+int firstArgHalo(const Args& args, double)
+{
+    return toInt(args, 0, Fallback, 0, 10000);
+}
+
+int blurHalo(const Args& args, double pixelScale)
+{
+    // Same radius as ImageFilters::applyBlur()
+    const int blurSize = std::max(1, toInt(args, 0, 60, 0, 100) * 24 / 100 + 1);
+    return std::max(1, static_cast<int>(std::lround(blurSize * pixelScale)));
+}
+
+int gaussianHalo(const Args& args, double pixelScale)
+{
+    // Same box passes as ImageFilters::applyGaussianBlur(); their reaches add up
+    const int blurSize = std::max(1, toInt(args, 0, 60, 0, 100) * 24 / 100 + 1);
+    const std::vector<int> radii = BlurEngine::gaussianBoxRadii(blurSize * pixelScale / std::sqrt(3.0), 3);
+    return std::accumulate(radii.begin(), radii.end(), 0);
+}
+
+const FilterSpec kFilters[] = {
+    {"grayscale", "", 0, 0, &cancelable<&ImageFilters::applyGrayscale>, &pointHalo, kGrayOrRgb},
+    {"bw", "", 0, 0, &cancelable<&ImageFilters::applyBlackAndWhite>, &pointHalo},
+    {"invert", "", 0, 0, &cancelable<&ImageFilters::applyInvert>, &pointHalo, kGrayOrRgb},
+    {"infrared", "", 0, 0, &cancelable<&ImageFilters::applyInfrared>, &pointHalo},
+    {"purple", "", 0, 0, &cancelable<&ImageFilters::applyPurpleFilter>, &pointHalo},
+    {"sunlight", "", 0, 0, &cancelable<&ImageFilters::applyEnhanceSunlight>, &pointHalo},
+    {"tv", "[seed=random]", 0, 1, [](const Args& args) -> Recipe::Step {
+        // A given seed makes the noise, and so the batch output, reproducible
+        const bool seeded = !args.empty();
+        const int seed = toInt(args, 0, 0, 0, std::numeric_limits<int>::max());
+        return [seeded, seed](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+            Image before = image;
+            filters.applyTVFilter(image, before, cancelRequested,
+                                  seeded ? static_cast<std::uint64_t>(seed) : NoiseSource::randomSeed());
+        };
+    }, nullptr},
+    {"emboss", "", 0, 0, &cancelable<&ImageFilters::applyEmboss>, &fixedHalo<1>},
+    {"fisheye", "", 0, 0, &cancelable<&ImageFilters::applyFishEye>, nullptr},
+    {"edges", "[threshold=50[:output=threshold]]", 0, 2, [](const Args& args) -> Recipe::Step {
+        const int threshold = toInt(args, 0, 50, 0, 255);
+        const EdgeEngine::Output output = args.size() > 1 ? EdgeEngine::parse(args[1]) : EdgeEngine::Output::Threshold;
+        return [threshold, output](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyEdges(image, output, threshold);
+        };
+    }, &fixedHalo<3>},
+    {"blur", "[strength=60]", 0, 1, [](const Args& args) -> Recipe::Step {
+        const int strength = toInt(args, 0, 60, 0, 100);
+        return [strength](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+            Image before = image;
+            filters.applyBlur(image, before, cancelRequested, strength);
+        };
+    }, &blurHalo},
+    {"gaussian", "[strength=60]", 0, 1, [](const Args& args) -> Recipe::Step {
+        const int strength = toInt(args, 0, 60, 0, 100);
+        return [strength](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+            Image before = image;
+            filters.applyGaussianBlur(image, before, cancelRequested, strength);
+        };
+    }, &gaussianHalo},
+    {"darken", "[percent=50]", 0, 1, [](const Args& args) -> Recipe::Step {
+        const int percent = toInt(args, 0, 50, 0, 100);
+        return [percent](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyDarkAndLight(image, "dark", percent);
+        };
+    }, &pointHalo},
+    {"lighten", "[percent=50]", 0, 1, [](const Args& args) -> Recipe::Step {
+        const int percent = toInt(args, 0, 50, 0, 100);
+        return [percent](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyDarkAndLight(image, "light", percent);
+        };
+    }, &pointHalo},
+    {"tint", "r:g:b[:intensity=50]", 3, 4, [](const Args& args) -> Recipe::Step {
+        const int r = toInt(args, 0, 0, 0, 255);
+        const int g = toInt(args, 1, 0, 0, 255);
+        const int b = toInt(args, 2, 0, 0, 255);
+        const double intensity = toInt(args, 3, 50, 0, 100) / 100.0;
+        return [r, g, b, intensity](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+            Image before = image;
+            filters.applyColorTint(image, before, cancelRequested, r, g, b, intensity);
+        };
+    }, &pointHalo},
+    {"oil", "[radius=3[:intensity=30]]", 0, 2, [](const Args& args) -> Recipe::Step {
+        const int radius = toInt(args, 0, 3, 1, 30);
+        const int intensity = toInt(args, 1, 30, 1, 100);
+        return [radius, intensity](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+            Image before = image;
+            filters.applyOilPainting(image, before, cancelRequested, radius, intensity);
+        };
+    }, &firstArgHalo<3>},
+    {"doublevision", "[offset=15]", 0, 1, [](const Args& args) -> Recipe::Step {
+        const int offset = toInt(args, 0, 15, 0, 10000);
+        return [offset](ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) {
+            Image before = image;
+            filters.applyDoubleVision(image, before, cancelRequested, offset);
+        };
+    }, &firstArgHalo<15>},
+    {"flip", "horizontal|vertical", 1, 1, [](const Args& args) -> Recipe::Step {
+        if (args[0] != "horizontal" && args[0] != "vertical") {
+            throw std::invalid_argument("Flip direction must be horizontal or vertical");
+        }
+        const std::string direction = args[0] == "horizontal" ? "Horizontal" : "Vertical";
+        return [direction](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyFlip(image, direction);
+        };
+    }, nullptr, kAnyChannels},
+    {"rotate", "degrees", 1, 1, [](const Args& args) -> Recipe::Step {
+        const int degrees = toInt(args, 0, 0, -360, 360);
+        return [degrees](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyRotate(image, degrees);
+        };
+    }, nullptr},
+    {"skew", "[degrees=40]", 0, 1, [](const Args& args) -> Recipe::Step {
+        const int degrees = toInt(args, 0, 40, -89, 89);
+        return [degrees](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applySkew(image, degrees);
+        };
+    }, nullptr},
+    {"resize", "width:height[:filter=lanczos]", 2, 3, [](const Args& args) -> Recipe::Step {
+        const int width = toInt(args, 0, 0, 1, 100000);
+        const int height = toInt(args, 1, 0, 1, 100000);
+        const Resampler::Filter filter = toFilter(args, 2, Resampler::Filter::Lanczos3);
+        return [width, height, filter](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyResize(image, width, height, filter);
+        };
+    }, nullptr, kAnyChannels | PixelFormatSet{PixelFormat::rgb8().planar(), PixelFormat::rgba8().planar()}},
+    {"thumbnail", "size[:filter=box]", 1, 2, [](const Args& args) -> Recipe::Step {
+        const int size = toInt(args, 0, 0, 1, 100000);
+        const Resampler::Filter filter = toFilter(args, 1, Resampler::Filter::Box);
+        return [size, filter](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            // Fits into size x size keeping the aspect ratio; never enlarges
+            const double scale = std::min({1.0, static_cast<double>(size) / image.width,
+                                           static_cast<double>(size) / image.height});
+            if (scale >= 1.0) return;
+            filters.applyResize(image, std::max(1, static_cast<int>(std::lround(image.width * scale))),
+                                std::max(1, static_cast<int>(std::lround(image.height * scale))), filter);
+        };
+    }, nullptr, kAnyChannels | PixelFormatSet{PixelFormat::rgb8().planar(), PixelFormat::rgba8().planar()}},
+    {"frame", "width:r:g:b", 4, 4, [](const Args& args) -> Recipe::Step {
+        const int width = toInt(args, 0, 0, 1, 10000);
+        const int r = toInt(args, 1, 0, 0, 255);
+        const int g = toInt(args, 2, 0, 0, 255);
+        const int b = toInt(args, 3, 0, 0, 255);
+        return [width, r, g, b](ImageFilters& filters, Image& image, std::atomic<bool>&) {
+            filters.applyFrame(image, width, r, g, b);
+        };
+    }, nullptr},
+};
+
+/// Splits @p text at every @p separator, trimming spaces around each part.
+std::vector<std::string> split(const std::string& text, char separator)
+{
+    std::vector<std::string> parts;
+    std::size_t begin = 0;
+    while (true) {
+        const std::size_t end = text.find(separator, begin);
+        std::string part = text.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        const std::size_t first = part.find_first_not_of(" \t");
+        const std::size_t last = part.find_last_not_of(" \t");
+        parts.push_back(first == std::string::npos ? std::string() : part.substr(first, last - first + 1));
+        if (end == std::string::npos) break;
+        begin = end + 1;
+    }
+    return parts;
+}
+
+} // namespace
+
+Recipe Recipe::parse(const std::string& text)
+{
+    Recipe recipe;
+    for (const std::string& stepText : split(text, ',')) {
+        if (stepText.empty()) continue;
+        Args args = split(stepText, ':');
+        std::string name = args.front();
+        args.erase(args.begin());
+        for (char& ch : name) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+
+        const FilterSpec* spec = nullptr;
+        for (const FilterSpec& candidate : kFilters) {
+            if (name == candidate.name) spec = &candidate;
+        }
+        if (!spec) throw std::invalid_argument("Unknown filter '" + name + "'");
+        if (args.size() < spec->minArgs || args.size() > spec->maxArgs) {
+            throw std::invalid_argument("Usage: " + name + (*spec->params ? std::string(":") + spec->params : std::string()));
+        }
+        try {
+            recipe.steps.push_back(spec->make(args));
+            recipe.halos.push_back(spec->halo ? Halo([halo = spec->halo, args](double pixelScale) {
+                return halo(args, pixelScale);
+            }) : Halo());
+            recipe.formats.push_back(spec->formats);
+        } catch (const std::invalid_argument& e) {
+            throw std::invalid_argument(name + ": " + e.what());
+        }
+        recipe.names.push_back(stepText);
+    }
+    if (recipe.steps.empty()) throw std::invalid_argument("The recipe has no filters");
+    return recipe;
+}
+
+std::string Recipe::usage()
+{
+    std::string text;
+    for (const FilterSpec& spec : kFilters) {
+        text += "  ";
+        text += spec.name;
+        if (*spec.params) {
+            text += ':';
+            text += spec.params;
+        }
+        if (!spec.halo) text += "  (not with --tiled)";
+        text += '\n';
+    }
+    return text;
+}
+
+bool Recipe::apply(ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) const
+{
+    for (std::size_t i = 0; i < steps.size(); ++i) {
+        if (cancelRequested) return false;
+        // A step gets the image as it is whenever it can, so gray scans stay gray through gray-capable steps
+        if (!formats[i].contains(image.format())) image = PixelConverter::conform(image, formats[i]);
+        // Filters catch their own errors; without a reporter the last error is the only trace of one
+        filters.clearLastError();
+        steps[i](filters, image, cancelRequested);
+        if (!filters.getLastError().empty()) throw std::runtime_error("'" + names[i] + "' failed: " + filters.getLastError());
+    }
+    return !cancelRequested;
+}
+
+PixelFormatSet Recipe::inputFormats() const
+{
+    return formats.empty() ? PixelFormatSet{PixelFormat::rgb8()} : formats.front();
+}
+
+bool Recipe::tileable() const
+{
+    return std::all_of(halos.begin(), halos.end(), [](const Halo& halo) { return static_cast<bool>(halo); });
+}
+
+bool Recipe::apply(ImageFilters& filters, const TiledImage& source, TiledImage& destination,
+                   std::atomic<bool>& cancelRequested, const std::function<void(int done, int total)>& progress) const
+{
+    // Each step is wrong within its own halo of a region's cut edges, so the chain needs their sum
+    int halo = 0;
+    for (std::size_t i = 0; i < halos.size(); ++i) {
+        if (!halos[i]) throw std::logic_error("'" + names[i] + "' needs the whole image and cannot run tiled");
+        halo += halos[i](filters.getPixelScale());
+    }
+    const bool completed = source.transformInto(destination, halo, [&](Image& region) {
+        apply(filters, region, cancelRequested);
+        region = PixelConverter::convert(region, PixelFormat::rgb8()); // tiles are stored as RGB
+    }, &cancelRequested, progress);
+    return completed && !cancelRequested;
+}
+
+std::string Recipe::description() const
+{
+    std::string text;
+    for (const std::string& name : names) {
+        if (!text.empty()) text += " > ";
+        text += name;
+    }
+    return text;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file Recipe.h
+ * @brief Textual filter chains for the batch-processing command-line tool.
+ *
+ * This file declares the Recipe class, a parsed list of ImageFilters calls
+ * written as text, e.g. "grayscale,blur:40,resize:800:600". Each step is a
+ * filter name followed by its colon-separated parameters; steps run in order.
+ * A recipe whose steps only look at nearby pixels can also run tile by tile
+ * on a TiledImage, for pictures too large for memory.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef RECIPE_H
+#define RECIPE_H
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+#include "image/PixelFormat.h"
+
+class Image;
+class ImageFilters;
+class TiledImage;
+
+/**
+ * @class Recipe
+ * @brief Ordered chain of filters parsed from text.
+ *
+ * @code
+ * Recipe recipe = Recipe::parse("grayscale,darken:20");
+ * ImageFilters filters;
+ * std::atomic<bool> cancelRequested{false};
+ * recipe.apply(filters, image, cancelRequested);
+ * @endcode
+ */
+class Recipe {
+public:
+    /// Applies one filter, with its parsed parameters, to the image in place.
+    using Step = std::function<void(ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested)>;
+
+    /// Context pixels a step needs around each output pixel at a pixel scale; empty if it needs the whole image.
+    using Halo = std::function<int(double pixelScale)>;
+
+    /**
+     * @brief Parses a comma-separated list of filter steps.
+     *
+     * @param text Steps such as "blur:40" or "tint:255:0:0:50"
+     * @return The parsed recipe
+     * @throws std::invalid_argument If a filter is unknown or a parameter is malformed
+     */
+    static Recipe parse(const std::string& text);
+
+    /**
+     * @brief Lists every filter with its parameters, one per line.
+     */
+    static std::string usage();
+
+    /**
+     * @brief Runs every step on @p image.
+     *
+     * Before each step the image is converted, with PixelConverter, to the
+     * nearest format the step accepts, only if its current format is not one.
+     *
+     * @param filters Filters instance to run the steps with
+     * @param image Image to process (modified in place)
+     * @param cancelRequested Stops the chain; the image is then incomplete
+     * @return False if cancelled
+     * @throws std::runtime_error If a step fails (see ImageFilters::getLastError())
+     */
+    bool apply(ImageFilters& filters, Image& image, std::atomic<bool>& cancelRequested) const;
+
+    /**
+     * @brief Pixel formats the first step handles natively.
+     *
+     * Loading the input with these (ImageDecodeOptions::formats) keeps a gray
+     * or RGBA file in its own format as long as the steps accept it; apply()
+     * converts before any step that does not.
+     */
+    PixelFormatSet inputFormats() const;
+
+    /**
+     * @brief True if every step can run tile by tile (see apply() for TiledImage).
+     *
+     * Point filters and neighbourhood filters (blur, oil, emboss, edges...)
+     * qualify; position-dependent, global and geometric ones (tv, fisheye, flip, rotate,
+     * skew, resize, thumbnail, frame) do not.
+     */
+    bool tileable() const;
+
+    /**
+     * @brief Runs every step on @p source tile by tile, writing to @p destination.
+     *
+     * All steps run on each tile in one pass, with a halo wide enough for the
+     * whole chain, so the result matches apply() on the whole image.
+     *
+     * @param filters Filters instance to run the steps with
+     * @param source Image to process
+     * @param destination Image of the same size receiving the result
+     * @param cancelRequested Stops between tiles; @p destination is then incomplete
+     * @param progress Optional callback receiving (tiles done, total tiles)
+     * @return False if cancelled
+     * @throws std::logic_error If the recipe is not tileable()
+     * @throws std::runtime_error If a step fails on a tile
+     */
+    bool apply(ImageFilters& filters, const TiledImage& source, TiledImage& destination,
+               std::atomic<bool>& cancelRequested, const std::function<void(int done, int total)>& progress = {}) const;
+
+    /**
+     * @brief The recipe's steps as text, joined by " > ".
+     */
+    std::string description() const;
+
+    /**
+     * @brief True if the recipe has no steps.
+     */
+    bool empty() const { return steps.empty(); }
+
+private:
+    std::vector<std::string> names;      ///< Step text as written, for description()
+    std::vector<Step> steps;             ///< Steps in application order
+    std::vector<Halo> halos;             ///< Context each step needs, parallel to steps
+    std::vector<PixelFormatSet> formats; ///< Formats each step accepts natively, parallel to steps
+};
+
+#endif // RECIPE_H
@@ -0,0 +1,347 @@
+/**
+ * @file photosmith_cli.cpp
+ * @brief Headless batch front end: applies a filter recipe to many images.
+ *
+ * photosmith-cli runs the same ImageFilters as the GUI without a window or
+ * event loop, so it can run on servers and in scripts. Inputs are files,
+ * directories (every supported image inside) or simple patterns such as
+ * "IMG_????.jpg"; results are written to an output directory under the same
+ * file names, which must therefore be unique across the inputs.
+ *
+ * @code
+ * photosmith-cli -r "grayscale,darken:20" -o out photos/a.jpg photos/b.jpg
+ * photosmith-cli -r "resize:800:600,frame:10:255:255:255" -j 8 --format png photos
+ * photosmith-cli -r "gaussian:40,sunlight" --tiled --scratch /data/tmp -o out scan.bmp
+ * photosmith-cli -r "resize:1280:720" --format jpg --quality 82 -o web photos
+ * photosmith-cli -r "thumbnail:256" --format jpg -o thumbs photos
+ * photosmith-cli --list
+ * @endcode
+ *
+ * Exit status: 0 when every file was written, 1 when some failed, 2 on a usage
+ * error, 130 when interrupted with Ctrl+C.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "BatchPipeline.h"
+#include "Recipe.h"
+#include "filters/ProgressReporter.h"
+#include "io/ImageCodecs.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <csignal>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::atomic<bool> cancelRequested{false};
+
+void onInterrupt(int)
+{
+    cancelRequested = true;
+}
+
+/**
+ * @brief Progress on stderr: a counter line, plus status lines when verbose.
+ */
+class ConsoleReporter : public ProgressReporter {
+public:
+    explicit ConsoleReporter(bool verbose) : verbose(verbose) {}
+
+    void beginProgress(int) override {}
+
+    void updateProgress(int current, int maximum) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::cerr << "\r[" << current << "/" << maximum << "]" << std::flush;
+        lineOpen = true;
+    }
+
+    void endProgress() override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (lineOpen) std::cerr << "\n";
+        lineOpen = false;
+    }
+
+    void showStatus(const std::string& message) override
+    {
+        // Failures are always shown, everything else only when asked for
+        if (!verbose && message.rfind("Failed", 0) != 0) return;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (lineOpen) std::cerr << "\n";
+        lineOpen = false;
+        std::cerr << message << "\n";
+    }
+
+private:
+    const bool verbose;
+    std::mutex mutex;
+    bool lineOpen = false;
+};
+
+std::string lowercase(std::string text)
+{
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+}
+
+bool isSupportedImage(const fs::path& path)
+{
+    return ImageCodecs::isSupported(path.extension().string());
+}
+
+/**
+ * @brief The writable formats without dots, e.g. "png, jpg, jpeg, bmp, tga".
+ */
+std::string formatList()
+{
+    std::string list;
+    for (const std::string& ext : ImageCodecs::extensions()) list += (list.empty() ? "" : ", ") + ext.substr(1);
+    return list;
+}
+
+/**
+ * @brief Matches @p name against a pattern with '*' (any run) and '?' (any character).
+ */
+bool matchesPattern(const std::string& pattern, const std::string& name)
+{
+    std::size_t p = 0, n = 0, star = std::string::npos, resume = 0;
+    while (n < name.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+            ++p;
+            ++n;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            star = p++;
+            resume = n;
+        } else if (star != std::string::npos) {
+            p = star + 1;
+            n = ++resume;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') ++p;
+    return p == pattern.size();
+}
+
+/**
+ * @brief Expands one command-line input into image files, sorted by name.
+ *
+ * @throws std::invalid_argument If nothing matches
+ */
+std::vector<fs::path> expandInput(const std::string& input)
+{
+    const fs::path path(input);
+    std::vector<fs::path> files;
+    const std::string name = path.filename().string();
+
+    if (name.find_first_of("*?") != std::string::npos) {
+        // Patterns only apply to the file name; the shell usually expands them first
+        const fs::path dir = path.has_parent_path() ? path.parent_path() : fs::path(".");
+        if (fs::is_directory(dir)) {
+            for (const fs::directory_entry& entry : fs::directory_iterator(dir)) {
+                if (entry.is_regular_file() && matchesPattern(name, entry.path().filename().string())) {
+                    files.push_back(entry.path());
+                }
+            }
+        }
+    } else if (fs::is_directory(path)) {
+        for (const fs::directory_entry& entry : fs::directory_iterator(path)) {
+            if (entry.is_regular_file() && isSupportedImage(entry.path())) files.push_back(entry.path());
+        }
+    } else if (fs::exists(path)) {
+        files.push_back(path);
+    }
+
+    if (files.empty()) throw std::invalid_argument("No images match " + input);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+/**
+ * @brief One job per input file, each writing @p outputDir / its file name (with @p format's extension if given).
+ *
+ * A file named twice (by two patterns, say) is processed once. Two different
+ * files that would write the same output, such as x.png from two directories
+ * or a.png and a.jpg with --format, are a usage error: the encode threads would
+ * race to replace the one file and a result would be lost.
+ *
+ * @throws std::invalid_argument If two inputs map to the same output file
+ */
+std::vector<BatchPipeline::Job> makeJobs(const std::vector<std::string>& inputs, const std::string& outputDir,
+                                         const std::string& format)
+{
+    std::vector<BatchPipeline::Job> batch;
+    std::map<std::string, fs::path> sources; // output key -> input written there
+    for (const std::string& input : inputs) {
+        for (const fs::path& file : expandInput(input)) {
+            fs::path output = fs::path(outputDir) / file.filename();
+            if (!format.empty()) output.replace_extension(format);
+#if defined(_WIN32) || defined(__APPLE__)
+            const std::string key = lowercase(output.lexically_normal().string()); // case-insensitive file systems
+#else
+            const std::string key = output.lexically_normal().string();
+#endif
+            const auto [existing, added] = sources.emplace(key, file);
+            if (!added) {
+                std::error_code error;
+                if (fs::equivalent(existing->second, file, error)) continue;
+                throw std::invalid_argument("'" + existing->second.string() + "' and '" + file.string()
+                                            + "' would both be written to " + output.string());
+            }
+            batch.push_back({file.string(), output.string()});
+        }
+    }
+    return batch;
+}
+
+void printHelp(const char* program)
+{
+    std::cout << "Usage: " << program << " -r RECIPE -o DIR [options] INPUT...\n"
+              << "\n"
+              << "Applies a chain of Photo Smith filters to every input image.\n"
+              << "INPUT is an image file, a directory or a pattern like photos/*.jpg.\n"
+              << "\n"
+              << "Options:\n"
+              << "  -r, --recipe TEXT   Filters to apply, e.g. \"grayscale,darken:20\"\n"
+              << "  -o, --output DIR    Directory for the results (created if missing)\n"
+              << "  -j, --jobs N        Threads per pipeline stage (default: CPU count)\n"
+              << "      --format EXT    Write this format (" << formatList() << ") instead of the input's\n"
+              << "      --quality N     JPEG/WebP quality 1-100 (default: 90)\n"
+              << "      --png-level N   PNG compression 0 (fastest) to 9 (smallest)\n"
+              << "      --lossless      Write lossless WebP\n"
+              << "      --tiled         Process each image tile by tile, for images larger than memory\n"
+              << "                      (BMP and TGA stream; PNG and JPEG are still decoded whole)\n"
+              << "      --tile-size N   Tile edge in pixels for --tiled (default: 512)\n"
+              << "      --cache-mb N    Memory for mapped tiles with --tiled (default: 256)\n"
+              << "      --scratch DIR   Directory for --tiled scratch files (default: system temp)\n"
+              << "      --list          List the available filters and their parameters\n"
+              << "      --codecs        Show which library reads and writes each format\n"
+              << "  -v, --verbose       Report every file written\n"
+              << "  -h, --help          Show this help\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string recipeText;
+    std::string outputDir;
+    std::string format;
+    int jobs = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    bool verbose = false;
+    bool tiled = false;
+    TiledImage::Options tileOptions;
+    ImageEncodeOptions encodeOptions;
+    std::vector<std::string> inputs;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "-h" || arg == "--help") {
+                printHelp(argv[0]);
+                return 0;
+            } else if (arg == "--list") {
+                std::cout << Recipe::usage();
+                return 0;
+            } else if (arg == "--codecs") {
+                std::cout << ImageCodecs::describe() << "\n";
+                return 0;
+            } else if (arg == "-r" || arg == "--recipe") {
+                recipeText = value();
+            } else if (arg == "-o" || arg == "--output") {
+                outputDir = value();
+            } else if (arg == "-j" || arg == "--jobs") {
+                jobs = std::stoi(value());
+                if (jobs < 1) throw std::invalid_argument("--jobs must be at least 1");
+            } else if (arg == "--format") {
+                format = lowercase(value());
+                if (!format.empty() && format[0] == '.') format.erase(0, 1);
+                if (!isSupportedImage("x." + format)) throw std::invalid_argument("Unsupported format: " + format);
+            } else if (arg == "--quality") {
+                encodeOptions.quality = std::stoi(value());
+                if (encodeOptions.quality < 1 || encodeOptions.quality > 100) {
+                    throw std::invalid_argument("--quality must be between 1 and 100");
+                }
+            } else if (arg == "--png-level") {
+                encodeOptions.pngLevel = std::stoi(value());
+                if (encodeOptions.pngLevel < 0 || encodeOptions.pngLevel > 9) {
+                    throw std::invalid_argument("--png-level must be between 0 and 9");
+                }
+            } else if (arg == "--lossless") {
+                encodeOptions.lossless = true;
+            } else if (arg == "--tiled") {
+                tiled = true;
+            } else if (arg == "--tile-size") {
+                tileOptions.tileSize = std::stoi(value());
+                if (tileOptions.tileSize < 16) throw std::invalid_argument("--tile-size must be at least 16");
+            } else if (arg == "--cache-mb") {
+                const int megabytes = std::stoi(value());
+                if (megabytes < 1) throw std::invalid_argument("--cache-mb must be at least 1");
+                tileOptions.cacheBytes = static_cast<std::size_t>(megabytes) << 20;
+            } else if (arg == "--scratch") {
+                tileOptions.scratchDir = value();
+            } else if (arg == "-v" || arg == "--verbose") {
+                verbose = true;
+            } else if (!arg.empty() && arg[0] == '-') {
+                throw std::invalid_argument("Unknown option: " + arg);
+            } else {
+                inputs.push_back(arg);
+            }
+        }
+        if (recipeText.empty()) throw std::invalid_argument("No recipe given (use -r)");
+        if (outputDir.empty()) throw std::invalid_argument("No output directory given (use -o)");
+        if (inputs.empty()) throw std::invalid_argument("No input images given");
+
+        const Recipe recipe = Recipe::parse(recipeText);
+        if (tiled && !recipe.tileable()) {
+            throw std::invalid_argument("--tiled cannot run whole-image filters (see --list)");
+        }
+
+        const std::vector<BatchPipeline::Job> batch = makeJobs(inputs, outputDir, format);
+        fs::create_directories(outputDir);
+
+        std::signal(SIGINT, onInterrupt);
+        ConsoleReporter reporter(verbose);
+        if (verbose) {
+            std::cerr << "Applying " << recipe.description() << " to " << batch.size() << " image(s)\n";
+        }
+        const BatchPipeline pipeline(recipe, jobs, encodeOptions);
+        const BatchPipeline::Summary summary = tiled ? pipeline.runTiled(batch, cancelRequested, &reporter, tileOptions)
+                                                     : pipeline.run(batch, cancelRequested, &reporter);
+
+        std::cerr << summary.written << " written, " << summary.failed << " failed"
+                  << (summary.cancelled ? ", cancelled" : "") << "\n";
+        if (summary.cancelled) return 130;
+        return summary.failed ? 1 : 0;
+    } catch (const std::invalid_argument& e) {
+        std::cerr << argv[0] << ": " << e.what() << "\nTry --help for usage.\n";
+        return 2;
+    } catch (const std::exception& e) {
+        std::cerr << argv[0] << ": " << e.what() << "\n";
+        return 1;
+    }
+}
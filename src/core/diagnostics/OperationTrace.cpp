@@ -0,0 +1,165 @@
+/**
+ * @file OperationTrace.cpp
+ * @brief Implementation of the operation ring buffer and its Chrome trace export.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "OperationTrace.h"
+#include "../image/Image_Class.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+const std::chrono::steady_clock::time_point programStart = std::chrono::steady_clock::now();
+
+/// Writes @p text as a JSON string literal.
+void writeJsonString(std::ostream& out, const std::string& text)
+{
+    out << '"';
+    for (const char c : text) {
+        switch (c) {
+        case '"': out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u00" << "0123456789abcdef"[(c >> 4) & 0xF] << "0123456789abcdef"[c & 0xF];
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+double toMiB(std::size_t bytes)
+{
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // namespace
+
+double OperationTrace::Record::megapixelsPerSecond() const
+{
+    if (pixels == 0 || durationUs <= 0) return 0.0;
+    return static_cast<double>(pixels) / static_cast<double>(durationUs);
+}
+
+OperationTrace::Stopwatch::Stopwatch(std::string name, std::string category, std::uint64_t pixels)
+{
+    record.name = std::move(name);
+    record.category = std::move(category);
+    record.pixels = pixels;
+    record.thread = currentThreadId();
+    Image::resetPixelBytesPeak();
+    allocatedAtStart = Image::pixelBytesAllocated();
+    record.startUs = nowUs();
+}
+
+OperationTrace::Record OperationTrace::Stopwatch::stop() const
+{
+    Record result = record;
+    result.durationUs = nowUs() - record.startUs;
+    result.allocatedBytes = Image::pixelBytesAllocated() - allocatedAtStart;
+    result.peakBytes = Image::pixelBytesPeak();
+    return result;
+}
+
+OperationTrace::OperationTrace(std::size_t capacity)
+    : ring(std::max<std::size_t>(1, capacity)) {}
+
+void OperationTrace::add(Record record)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    ring[next] = std::move(record);
+    next = (next + 1) % ring.size();
+    count = std::min(count + 1, ring.size());
+}
+
+std::vector<OperationTrace::Record> OperationTrace::records() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Record> result;
+    result.reserve(count);
+    const std::size_t oldest = (next + ring.size() - count) % ring.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(ring[(oldest + i) % ring.size()]);
+    }
+    return result;
+}
+
+void OperationTrace::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Record& record : ring) record = Record();
+    next = 0;
+    count = 0;
+}
+
+std::string OperationTrace::toChromeTrace() const
+{
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const Record& record : records()) {
+        if (!first) out << ",";
+        first = false;
+
+        // One complete ("X") event per operation...
+        out << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << record.thread << ",\"ts\":" << record.startUs
+            << ",\"dur\":" << record.durationUs << ",\"name\":";
+        writeJsonString(out, record.name);
+        out << ",\"cat\":";
+        writeJsonString(out, record.category);
+        out << ",\"args\":{\"outcome\":";
+        writeJsonString(out, record.outcome);
+        out << ",\"megapixels\":" << static_cast<double>(record.pixels) / 1e6
+            << ",\"mpix_per_s\":" << record.megapixelsPerSecond()
+            << ",\"allocated_mib\":" << toMiB(record.allocatedBytes)
+            << ",\"peak_mib\":" << toMiB(record.peakBytes)
+            << ",\"history_mib\":" << toMiB(record.historyBytes) << "}}";
+
+        // ...and counter ("C") samples, drawn as memory graphs under the timeline
+        out << ",\n{\"ph\":\"C\",\"pid\":1,\"ts\":" << record.startUs + record.durationUs
+            << ",\"name\":\"Memory (MiB)\",\"args\":{\"pixel peak\":" << toMiB(record.peakBytes)
+            << ",\"history\":" << toMiB(record.historyBytes) << "}}";
+    }
+    out << "\n]}\n";
+    return out.str();
+}
+
+void OperationTrace::writeChromeTrace(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Cannot open " + path + " for writing");
+    file << toChromeTrace();
+    if (!file) throw std::runtime_error("Failed to write " + path);
+}
+
+std::int64_t OperationTrace::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - programStart).count();
+}
+
+std::uint32_t OperationTrace::currentThreadId()
+{
+    static std::atomic<std::uint32_t> nextId{1};
+    thread_local const std::uint32_t id = nextId++;
+    return id;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file OperationTrace.h
+ * @brief Ring buffer of timed operations, exportable as a Chrome trace.
+ *
+ * This file declares the OperationTrace class, a lightweight record of what
+ * the application spent its time and memory on. Each filter, undo/redo and
+ * file operation is timed with a Stopwatch and stored as a Record along with
+ * the pixels it processed and the pixel memory it allocated. Only the most
+ * recent records are kept, so the trace can stay enabled all the time.
+ *
+ * @details The operation trace provides:
+ * - Wall time, pixel count and throughput per operation
+ * - Pixel-buffer bytes allocated and peak pixel memory during the operation
+ *   (see Image::pixelBytesAllocated() and Image::pixelBytesPeak())
+ * - Undo history memory after the operation, filled in by the caller
+ * - A fixed-capacity ring buffer: recording never grows memory
+ * - Export in the Chrome trace event format (chrome://tracing, Perfetto)
+ *
+ * @note Memory figures are process-wide: an operation running at the same
+ *       time as another (e.g. a live preview) is charged for both.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef OPERATIONTRACE_H
+#define OPERATIONTRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class OperationTrace
+ * @brief Thread-safe, fixed-size log of timed operations.
+ *
+ * @code
+ * OperationTrace::Stopwatch stopwatch("Blur", "filter", image.width * image.height);
+ * filters.applyBlur(image, before, cancel);
+ * OperationTrace::Record record = stopwatch.stop();
+ * record.historyBytes = history.memoryUsage();
+ * trace.add(record);
+ * trace.writeChromeTrace("trace.json");
+ * @endcode
+ */
+class OperationTrace {
+public:
+    /// Default number of records kept.
+    static constexpr std::size_t DefaultCapacity = 512;
+
+    /**
+     * @brief One timed operation.
+     */
+    struct Record {
+        std::string name;               ///< Operation name, e.g. "Gaussian Blur"
+        std::string category;           ///< Group, e.g. "filter", "history", "io"
+        std::string outcome = "ok";     ///< "ok", "cancelled" or "failed"
+        std::int64_t startUs = 0;       ///< Start time, microseconds since the program started
+        std::int64_t durationUs = 0;    ///< Wall time in microseconds
+        std::uint64_t pixels = 0;       ///< Pixels processed (0 if not meaningful)
+        std::size_t allocatedBytes = 0; ///< Pixel-buffer bytes allocated while it ran
+        std::size_t peakBytes = 0;      ///< Peak pixel-buffer bytes alive while it ran
+        std::size_t historyBytes = 0;   ///< Undo history memory afterwards
+        std::uint32_t thread = 0;       ///< Small id of the thread that ran it
+
+        /**
+         * @brief Megapixels per second, or 0 when unknown.
+         */
+        double megapixelsPerSecond() const;
+    };
+
+    /**
+     * @class Stopwatch
+     * @brief Times one operation on the calling thread.
+     *
+     * Starting a stopwatch restarts Image::pixelBytesPeak(), so the peak it
+     * reports covers only the operation (and anything running alongside it).
+     */
+    class Stopwatch {
+    public:
+        /**
+         * @param name Operation name
+         * @param category Group shown in the trace viewer
+         * @param pixels Pixels the operation processes
+         */
+        Stopwatch(std::string name, std::string category, std::uint64_t pixels = 0);
+
+        /**
+         * @brief Ends the measurement.
+         *
+         * @return The record, with every field except historyBytes filled in
+         */
+        Record stop() const;
+
+    private:
+        Record record;                   ///< Fields known at the start
+        std::size_t allocatedAtStart;    ///< Image::pixelBytesAllocated() at the start
+    };
+
+    /**
+     * @param capacity Records kept before the oldest are overwritten (at least 1)
+     */
+    explicit OperationTrace(std::size_t capacity = DefaultCapacity);
+
+    /**
+     * @brief Appends @p record, overwriting the oldest one when full.
+     */
+    void add(Record record);
+
+    /**
+     * @brief Copy of the stored records, oldest first.
+     */
+    std::vector<Record> records() const;
+
+    /**
+     * @brief Removes every record.
+     */
+    void clear();
+
+    /**
+     * @brief Maximum number of records kept.
+     */
+    std::size_t capacity() const { return ring.size(); }
+
+    /**
+     * @brief The records as Chrome trace event JSON ("X" complete events).
+     */
+    std::string toChromeTrace() const;
+
+    /**
+     * @brief Writes toChromeTrace() to @p path.
+     *
+     * @throws std::runtime_error If the file cannot be written
+     */
+    void writeChromeTrace(const std::string& path) const;
+
+    /**
+     * @brief Microseconds since the program started (monotonic).
+     */
+    static std::int64_t nowUs();
+
+    /**
+     * @brief Small, stable id for the calling thread (1 = first thread seen).
+     */
+    static std::uint32_t currentThreadId();
+
+private:
+    mutable std::mutex mutex;  ///< Guards the fields below
+    std::vector<Record> ring;  ///< Fixed-size storage
+    std::size_t next = 0;      ///< Slot the next record goes to
+    std::size_t count = 0;     ///< Records stored (up to capacity)
+};
+
+#endif // OPERATIONTRACE_H
@@ -0,0 +1,242 @@
+/**
+ * @file BlurEngine.cpp
+ * @brief Implementation of the sliding-window box and Gaussian blur kernels.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "BlurEngine.h"
+#include "../image/BufferPool.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief Exact division by a fixed window size through a multiply and a shift.
+ *
+ * Window sums are below 256 * divisor, so with 2^shift >= 256 * divisor^2 and
+ * multiplier = floor(2^shift / divisor) + 1 the product never overshoots into
+ * the next quotient. Windows too large for a 64-bit product divide directly.
+ */
+struct WindowDivisor {
+    std::uint64_t multiplier = 0;
+    int shift = -1;              ///< -1: divide by `divisor` instead
+    std::uint32_t divisor = 1;
+    std::uint32_t bias = 0;      ///< Added before dividing (divisor / 2 to round to nearest)
+
+    WindowDivisor() = default;
+    WindowDivisor(std::uint32_t count, bool roundToNearest) : divisor(count), bias(roundToNearest ? count / 2 : 0)
+    {
+        int bits = 8;
+        while ((std::uint64_t(1) << bits) < std::uint64_t(256) * count * count && bits < 56) ++bits;
+        if ((std::uint64_t(1) << bits) >= std::uint64_t(256) * count * count) {
+            shift = bits;
+            multiplier = ((std::uint64_t(1) << bits) / count) + 1;
+        }
+    }
+
+    unsigned char operator()(std::uint32_t sum) const
+    {
+        const std::uint64_t n = sum + bias;
+        return static_cast<unsigned char>(shift >= 0 ? (n * multiplier) >> shift : n / divisor);
+    }
+};
+
+/**
+ * @brief Writes window sums for x in [begin, end), sliding the window after each.
+ *
+ * Enter and Leave say whether pixel x + radius + 1 enters and pixel x - radius
+ * leaves inside this range, so each range runs without bounds checks.
+ */
+template <bool Enter, bool Leave>
+void slideRange(const unsigned char* row, int begin, int end, int radius, std::uint32_t sums[3], std::uint32_t* out)
+{
+    for (int x = begin; x < end; ++x) {
+        out[x * 3] = sums[0];
+        out[x * 3 + 1] = sums[1];
+        out[x * 3 + 2] = sums[2];
+        if constexpr (Enter) {
+            const unsigned char* p = row + (x + radius + 1) * 3;
+            sums[0] += p[0];
+            sums[1] += p[1];
+            sums[2] += p[2];
+        }
+        if constexpr (Leave) {
+            const unsigned char* p = row + (x - radius) * 3;
+            sums[0] -= p[0];
+            sums[1] -= p[1];
+            sums[2] -= p[2];
+        }
+    }
+}
+
+} // namespace
+
+void BlurEngine::horizontalSums(const unsigned char* row, int width, int radius, std::uint32_t* out)
+{
+    std::uint32_t sums[3] = {0, 0, 0};
+
+    // Prime the window with pixels [0, radius] (clipped)
+    const int primeEnd = std::min(radius, width - 1);
+    for (int x = 0; x <= primeEnd; ++x) {
+        sums[0] += row[x * 3];
+        sums[1] += row[x * 3 + 1];
+        sums[2] += row[x * 3 + 2];
+    }
+
+    // Pixels enter while x + radius + 1 < width and leave once x >= radius; the
+    // interior between the two limits slides without checks
+    const int enterEnd = std::max(0, width - radius - 1);
+    const int leaveBegin = std::min(width, radius);
+    if (leaveBegin <= enterEnd) {
+        slideRange<true, false>(row, 0, leaveBegin, radius, sums, out);
+        slideRange<true, true>(row, leaveBegin, enterEnd, radius, sums, out);
+        slideRange<false, true>(row, enterEnd, width, radius, sums, out);
+    } else {
+        // Window wider than the row: the middle sees the whole row
+        slideRange<true, false>(row, 0, enterEnd, radius, sums, out);
+        slideRange<false, false>(row, enterEnd, leaveBegin, radius, sums, out);
+        slideRange<false, true>(row, leaveBegin, width, radius, sums, out);
+    }
+}
+
+void BlurEngine::boxBand(const ConstImageView& src, const ImageView& dst, int radius,
+                         bool roundToNearest, int rowBegin, int rowEnd)
+{
+    const int width = src.width;
+    const int height = src.height;
+    const std::size_t rowValues = static_cast<std::size_t>(width) * 3;
+
+    // Number of columns inside the clipped horizontal window, per x
+    std::vector<int> colCount(width);
+    for (int x = 0; x < width; ++x) {
+        colCount[x] = std::min(width - 1, x + radius) - std::max(0, x - radius) + 1;
+    }
+
+    // Window sizes only change near the borders, so the divisors are rebuilt
+    // only when the clipped row count does
+    std::vector<WindowDivisor> divisors(width);
+    int divisorRows = -1;
+
+    // Ring of horizontal row sums: row k lives in slot k % ringRows
+    const int ringRows = std::min(height, 2 * radius + 1);
+    std::vector<std::uint32_t> ring(static_cast<std::size_t>(ringRows) * rowValues);
+    std::vector<std::uint32_t> vertical(rowValues, 0);
+    auto slot = [&](int k) { return ring.data() + static_cast<std::size_t>(k % ringRows) * rowValues; };
+
+    // Prime the vertical window of the first output row (clipped), halo rows included
+    const int primeBegin = std::max(0, rowBegin - radius);
+    const int primeEnd = std::min(height - 1, rowBegin + radius);
+    for (int k = primeBegin; k <= primeEnd; ++k) {
+        std::uint32_t* h = slot(k);
+        horizontalSums(src.row(k), width, radius, h);
+        for (std::size_t i = 0; i < rowValues; ++i) vertical[i] += h[i];
+    }
+
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const int rowCount = std::min(height - 1, y + radius) - std::max(0, y - radius) + 1;
+        if (rowCount != divisorRows) {
+            for (int x = 0; x < width; ++x) {
+                divisors[x] = WindowDivisor(static_cast<std::uint32_t>(colCount[x] * rowCount), roundToNearest);
+            }
+            divisorRows = rowCount;
+        }
+        unsigned char* d = dst.row(y);
+        for (int x = 0; x < width; ++x) {
+            const WindowDivisor& divide = divisors[x];
+            const std::uint32_t* v = vertical.data() + x * 3;
+            d[x * 3] = divide(v[0]);
+            d[x * 3 + 1] = divide(v[1]);
+            d[x * 3 + 2] = divide(v[2]);
+        }
+
+        if (y + 1 == rowEnd) break;
+
+        // Slide: row y - radius leaves first (it shares a slot with the entering row)
+        const int leave = y - radius;
+        const int enter = y + radius + 1;
+        if (leave >= 0) {
+            const std::uint32_t* h = slot(leave);
+            for (std::size_t i = 0; i < rowValues; ++i) vertical[i] -= h[i];
+        }
+        if (enter < height) {
+            std::uint32_t* h = slot(enter);
+            horizontalSums(src.row(enter), width, radius, h);
+            for (std::size_t i = 0; i < rowValues; ++i) vertical[i] += h[i];
+        }
+    }
+}
+
+bool BlurEngine::boxPass(const ConstImageView& src, const ImageView& dst, int radius,
+                         bool roundToNearest, const std::atomic<bool>* cancelRequested,
+                         const RowProgress& progress, int rowsBefore, int totalRows)
+{
+    radius = std::max(0, radius);
+    ThreadPool& pool = ThreadPool::instance();
+
+    // Each band re-reads about 2r+1 halo rows, so keep bands several times taller
+    const int grain = std::max(4 * (radius + 1), src.height / (pool.concurrency() * 4));
+    ThreadPool::ProgressFunction report;
+    if (progress) {
+        report = [&](int done, int) { progress(rowsBefore + done, totalRows); };
+    }
+    return pool.parallelRows(src.height, [&](int rowBegin, int rowEnd) {
+        boxBand(src, dst, radius, roundToNearest, rowBegin, rowEnd);
+    }, cancelRequested, report, grain);
+}
+
+bool BlurEngine::boxBlur(const ConstImageView& src, const ImageView& dst, int radius,
+                         const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    if (src.empty()) return true;
+    return boxPass(src, dst, radius, false, cancelRequested, progress, 0, src.height);
+}
+
+std::vector<int> BlurEngine::gaussianBoxRadii(double sigma, int passes)
+{
+    // Ideal box width so that `passes` boxes match the Gaussian variance, then
+    // mix the two nearest odd widths to hit it as closely as possible.
+    passes = std::max(1, passes);
+    const double variance12 = 12.0 * sigma * sigma;
+    const double wIdeal = std::sqrt(variance12 / passes + 1.0);
+    int wl = static_cast<int>(std::floor(wIdeal));
+    if (wl % 2 == 0) --wl;
+    wl = std::max(1, wl);
+    const int wu = wl + 2;
+    const double mIdeal = (variance12 - passes * wl * wl - 4.0 * passes * wl - 3.0 * passes) / (-4.0 * wl - 4.0);
+    const int m = static_cast<int>(std::lround(mIdeal));
+
+    std::vector<int> radii(passes);
+    for (int i = 0; i < passes; ++i) {
+        radii[i] = ((i < m ? wl : wu) - 1) / 2;
+    }
+    return radii;
+}
+
+bool BlurEngine::gaussianBlur(const ConstImageView& src, const ImageView& dst, double sigma,
+                              const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    if (src.empty()) return true;
+    const int passes = 3;
+    const std::vector<int> radii = gaussianBoxRadii(std::max(0.0, sigma), passes);
+    const int totalRows = passes * src.height;
+
+    // Ping-pong between dst and one pooled scratch buffer: src -> dst -> scratch -> dst
+    BufferPool::Lease scratch = BufferPool::instance().lease(static_cast<std::size_t>(src.rowBytes()) * src.height);
+    ImageView tmp(scratch.data(), src.width, src.height, src.channels, src.rowBytes());
+
+    if (!boxPass(src, dst, radii[0], true, cancelRequested, progress, 0, totalRows)) return false;
+    if (!boxPass(dst, tmp, radii[1], true, cancelRequested, progress, src.height, totalRows)) return false;
+    return boxPass(tmp, dst, radii[2], true, cancelRequested, progress, 2 * src.height, totalRows);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file BlurEngine.h
+ * @brief Radius-independent box and Gaussian blur kernels.
+ *
+ * This file declares the BlurEngine class, which implements blurring with
+ * separable sliding-window sums. The cost per pixel is constant regardless of
+ * the blur radius, so a maximum-strength blur costs the same as a small one.
+ *
+ * @details The engine provides:
+ * - Box blur (mean over a clipped (2r+1) x (2r+1) window), bit-exact with the
+ *   direct 2-D average the application used before
+ * - Gaussian blur approximated by three stacked box passes
+ * - Row bands processed in parallel on the shared ThreadPool
+ * - Progress reporting and cancellation between bands
+ *
+ * @note The engine works on ImageView/ConstImageView and has no Qt dependency;
+ *       ImageFilters adapts it to the progress bar and cancel flag.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BLURENGINE_H
+#define BLURENGINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "../image/ImageView.h"
+
+/**
+ * @class BlurEngine
+ * @brief Static utility class implementing O(1)-per-pixel blur passes.
+ *
+ * Each pass runs a horizontal running sum per row and keeps a running sum of
+ * those row sums over the vertical window. Horizontal row sums are cached in a
+ * ring of 2r+1 rows, so every source row is summed exactly once.
+ *
+ * @see ImageFilters::applyBlur() and ImageFilters::applyGaussianBlur() for the
+ *      reporting wrappers
+ */
+class BlurEngine {
+public:
+    /**
+     * @brief Progress callback, invoked on the calling thread between bands.
+     *
+     * @param rowsDone Rows finished so far (across all passes)
+     * @param totalRows Total rows the operation will produce
+     */
+    using RowProgress = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief Box-blurs @p src into @p dst.
+     *
+     * Each output pixel is the truncated mean of the source pixels inside the
+     * (2 * radius + 1)^2 window centred on it, clipped to the image.
+     *
+     * @param src Source pixels (3 channels)
+     * @param dst Destination of the same size; must not alias @p src
+     * @param radius Window radius in pixels (0 copies the image)
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback
+     * @return true on completion, false if cancelled
+     */
+    static bool boxBlur(const ConstImageView& src, const ImageView& dst, int radius,
+                        const std::atomic<bool>* cancelRequested = nullptr,
+                        const RowProgress& progress = {});
+
+    /**
+     * @brief Approximates a Gaussian blur with three stacked box passes.
+     *
+     * @param src Source pixels (3 channels)
+     * @param dst Destination of the same size; must not alias @p src
+     * @param sigma Standard deviation of the Gaussian in pixels
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback (reports 3 * height rows)
+     * @return true on completion, false if cancelled
+     */
+    static bool gaussianBlur(const ConstImageView& src, const ImageView& dst, double sigma,
+                             const std::atomic<bool>* cancelRequested = nullptr,
+                             const RowProgress& progress = {});
+
+    /**
+     * @brief Computes box radii whose stacked passes approximate a Gaussian.
+     *
+     * @param sigma Standard deviation of the target Gaussian
+     * @param passes Number of box passes
+     * @return One radius per pass
+     */
+    static std::vector<int> gaussianBoxRadii(double sigma, int passes);
+
+private:
+    /**
+     * @brief Single separable box pass shared by boxBlur() and gaussianBlur().
+     *
+     * Splits the image into row bands and runs boxBand() on each in parallel.
+     *
+     * @param roundToNearest Round the mean instead of truncating it; stacked
+     *        Gaussian passes use this so they do not darken the image.
+     * @param rowsBefore Rows already reported by earlier passes.
+     * @param totalRows Total rows reported across all passes.
+     */
+    static bool boxPass(const ConstImageView& src, const ImageView& dst, int radius,
+                        bool roundToNearest, const std::atomic<bool>* cancelRequested,
+                        const RowProgress& progress, int rowsBefore, int totalRows);
+
+    /**
+     * @brief Box-blurs output rows [rowBegin, rowEnd).
+     *
+     * The band primes its own vertical window from the halo rows above
+     * rowBegin, so bands are independent and may run on any thread.
+     */
+    static void boxBand(const ConstImageView& src, const ImageView& dst, int radius,
+                        bool roundToNearest, int rowBegin, int rowEnd);
+
+    /**
+     * @brief Writes clipped horizontal window sums of one row into @p out.
+     *
+     * The border stretches, where the window is clipped, and the interior run
+     * in separate loops, so the interior slides without bounds checks.
+     */
+    static void horizontalSums(const unsigned char* row, int width, int radius, std::uint32_t* out);
+};
+
+#endif // BLURENGINE_H
@@ -0,0 +1,209 @@
+/**
+ * @file EdgeEngine.cpp
+ * @brief Implementation of the streaming Sobel and emboss stencils.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "EdgeEngine.h"
+#include "Stencil.h"
+#include "../parallel/ThreadPool.h"
+#include "../simd/PointKernels.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr int kMinBandRows = 32; // Each band recomputes 2 blurred and 4 luma rows above and below it
+
+using Gaussian = Stencil::Kernel<1, 4, 6, 4, 1>; // Squared, its taps add up to 256
+using Smooth = Stencil::Kernel<1, 2, 1>;         // Sobel = smoothing across the gradient direction
+using Derivative = Stencil::Kernel<-1, 0, 1>;
+using Relief = Stencil::Kernel<1, -1>;           // Emboss: pixel minus its lower-right neighbour
+
+/**
+ * @brief Squared gradient threshold: pixels with gx^2 + gy^2 >= limit are edges.
+ *
+ * The magnitude is truncated and capped at 255 before the comparison, so
+ * "magnitude > threshold" is exactly "gx^2 + gy^2 >= (threshold + 1)^2".
+ */
+int squaredLimit(EdgeEngine::Output output, int threshold)
+{
+    if (output == EdgeEngine::Output::Magnitude) return -1;
+    if (threshold < 0) return 0;
+    if (threshold >= 255) return INT_MAX;
+    return (threshold + 1) * (threshold + 1);
+}
+
+/// Threshold or magnitude output of the gradients; a negative limit selects the magnitude.
+void gradientScalar(const std::int16_t* gx, const std::int16_t* gy, int count, int limit, unsigned char* out)
+{
+    for (int x = 0; x < count; ++x) {
+        const int squared = gx[x] * gx[x] + gy[x] * gy[x];
+        if (limit >= 0) {
+            out[x] = squared >= limit ? 0 : 255;
+        } else {
+            const int magnitude = std::min(255, static_cast<int>(std::sqrt(static_cast<float>(squared))));
+            out[x] = static_cast<unsigned char>(255 - magnitude);
+        }
+    }
+}
+
+#if defined(STENCIL_SIMD_X86)
+
+/// Output of 8 gradients; |gx|, |gy| <= 1020, so madd of (gx, gy) pairs gives gx^2 + gy^2 exactly.
+inline __m128i gradient8(__m128i gx, __m128i gy, int limit)
+{
+    const __m128i pairsLo = _mm_unpacklo_epi16(gx, gy);
+    const __m128i pairsHi = _mm_unpackhi_epi16(gx, gy);
+    const __m128i squaredLo = _mm_madd_epi16(pairsLo, pairsLo);
+    const __m128i squaredHi = _mm_madd_epi16(pairsHi, pairsHi);
+    if (limit >= 0) {
+        const __m128i bound = _mm_set1_epi32(limit);
+        // -1 (white) below the limit, 0 (black) on edges
+        return _mm_packs_epi32(_mm_cmplt_epi32(squaredLo, bound), _mm_cmplt_epi32(squaredHi, bound));
+    }
+    const __m128i lo = _mm_cvttps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(squaredLo)));
+    const __m128i hi = _mm_cvttps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(squaredHi)));
+    const __m128i magnitude = _mm_min_epi16(_mm_packs_epi32(lo, hi), _mm_set1_epi16(255));
+    return _mm_sub_epi16(_mm_set1_epi16(255), magnitude);
+}
+
+void gradientSse2(const std::int16_t* gx, const std::int16_t* gy, int count, int limit, unsigned char* out)
+{
+    int x = 0;
+    for (; x + 16 <= count; x += 16) {
+        const __m128i lo = gradient8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(gx + x)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(gy + x)), limit);
+        const __m128i hi = gradient8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(gx + x + 8)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(gy + x + 8)), limit);
+        // Threshold masks are 0 / -1, which packs to 0 / 255 with signed saturation
+        const __m128i bytes = limit >= 0 ? _mm_packs_epi16(lo, hi) : _mm_packus_epi16(lo, hi);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), bytes);
+    }
+    gradientScalar(gx + x, gy + x, count - x, limit, out + x);
+}
+
+#endif // STENCIL_SIMD_X86
+
+using GradientKernel = void (*)(const std::int16_t*, const std::int16_t*, int, int, unsigned char*);
+
+GradientKernel gradientKernel()
+{
+#if defined(STENCIL_SIMD_X86)
+    if (Stencil::simd()) return gradientSse2;
+#endif
+    return gradientScalar;
+}
+
+void checkViews(const ConstImageView& src, const ImageView& dst)
+{
+    if (src.channels != 3 || dst.channels != 3) throw std::invalid_argument("Edge filters need 3-channel images");
+    if (src.width != dst.width || src.height != dst.height) {
+        throw std::invalid_argument("Edge filter source and destination sizes differ");
+    }
+}
+
+int bandGrain(int height)
+{
+    return std::max(kMinBandRows, height / (ThreadPool::instance().concurrency() * 8));
+}
+
+} // namespace
+
+bool EdgeEngine::sobel(const ConstImageView& src, const ImageView& dst, Output output, int threshold,
+                       const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    checkViews(src, dst);
+    if (dst.empty()) return true;
+
+    const GradientKernel gradient = gradientKernel();
+    const int width = src.width;
+    const int lastRow = src.height - 1;
+    const int limit = squaredLimit(output, threshold);
+    return ThreadPool::instance().parallelRows(src.height, [&](int rowBegin, int rowEnd) {
+        Stencil::RowRing<unsigned char, 5> luma(width, 2);
+        Stencil::RowRing<unsigned char, 3> blurred(width, 1);
+        // Column sums cover the padding too, so the horizontal passes read past both edges
+        std::vector<std::int16_t> columns(static_cast<std::size_t>(width) + 4);
+        std::vector<std::int16_t> smooth(static_cast<std::size_t>(width) + 2);
+        std::vector<std::int16_t> derivative(static_cast<std::size_t>(width) + 2);
+        std::vector<std::int16_t> gx(static_cast<std::size_t>(width));
+        std::vector<std::int16_t> gy(static_cast<std::size_t>(width));
+        std::vector<unsigned char> edges(static_cast<std::size_t>(width));
+
+        auto lumaRow = [&](int y) {
+            y = std::clamp(y, 0, lastRow);
+            return luma.fetch(y, [&](unsigned char* row) { PointKernels::luma(src.row(y), row, width); }) - 2;
+        };
+        auto blurredRow = [&](int y) {
+            y = std::clamp(y, 0, lastRow);
+            return blurred.fetch(y, [&](unsigned char* row) {
+                const unsigned char* const rows[5] = {lumaRow(y - 2), lumaRow(y - 1), lumaRow(y), lumaRow(y + 1),
+                                                      lumaRow(y + 2)};
+                Stencil::columns<Gaussian>(rows, width + 4, columns.data());
+                Stencil::alongToBytes<Gaussian, 256>(columns.data() + 2, width, row);
+            }) - 1;
+        };
+
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const unsigned char* const rows[3] = {blurredRow(y - 1), blurredRow(y), blurredRow(y + 1)};
+            // gx = derivative across of the vertical smoothing, gy = smoothing across of the vertical derivative
+            Stencil::columns<Smooth>(rows, width + 2, smooth.data());
+            Stencil::columns<Derivative>(rows, width + 2, derivative.data());
+            Stencil::along<Derivative>(smooth.data() + 1, width, gx.data());
+            Stencil::along<Smooth>(derivative.data() + 1, width, gy.data());
+            gradient(gx.data(), gy.data(), width, limit, edges.data());
+            PointKernels::spreadGray(edges.data(), dst.row(y), width);
+        }
+    }, cancelRequested, progress, bandGrain(src.height));
+}
+
+bool EdgeEngine::emboss(const ConstImageView& src, const ImageView& dst,
+                        const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    checkViews(src, dst);
+    if (dst.empty()) return true;
+
+    const int width = src.width;
+    const int lastRow = src.height - 1;
+    return ThreadPool::instance().parallelRows(src.height, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const unsigned char* p = src.row(y);
+            const unsigned char* below = src.row(std::min(y + 1, lastRow));
+            unsigned char* d = dst.row(y);
+            // Channel differences to the lower-right pixel; the last column replicates its neighbour
+            const std::size_t inner = static_cast<std::size_t>(width - 1) * 3;
+            const unsigned char* const inside[2] = {p, below + 3};
+            const unsigned char* const edge[2] = {p + inner, below + inner};
+            Stencil::columnsToBytes<Relief, 1, 128>(inside, static_cast<int>(inner), d);
+            Stencil::columnsToBytes<Relief, 1, 128>(edge, 3, d + inner);
+            PointKernels::grayscale(d, width);
+        }
+    }, cancelRequested, progress);
+}
+
+const char* EdgeEngine::name(Output output)
+{
+    return output == Output::Magnitude ? "magnitude" : "threshold";
+}
+
+EdgeEngine::Output EdgeEngine::parse(const std::string& text)
+{
+    for (Output output : {Output::Threshold, Output::Magnitude}) {
+        if (text == name(output)) return output;
+    }
+    throw std::invalid_argument("Unknown edge output '" + text + "' (threshold, magnitude)");
+}
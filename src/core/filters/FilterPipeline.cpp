@@ -0,0 +1,217 @@
+/**
+ * @file FilterPipeline.cpp
+ * @brief Implementation of the fused point-operation pipeline.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "FilterPipeline.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+#include <utility>
+
+FilterPipeline& FilterPipeline::add(Stage stage)
+{
+    stages.push_back(std::move(stage));
+    return *this;
+}
+
+FilterPipeline& FilterPipeline::grayscale()
+{
+    Stage stage;
+    stage.kind = StageKind::Grayscale;
+    stage.name = "Grayscale";
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::blackAndWhite(int level)
+{
+    Stage stage;
+    stage.kind = StageKind::Threshold;
+    stage.name = "Black & White";
+    stage.level = level;
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::invert()
+{
+    Stage stage;
+    stage.name = "Invert";
+    stage.map = invertMap();
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::infrared()
+{
+    Stage stage;
+    stage.kind = StageKind::Infrared;
+    stage.name = "Infrared";
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::purple()
+{
+    Stage stage;
+    stage.name = "Purple";
+    stage.map = purpleMap();
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::sunlight()
+{
+    Stage stage;
+    stage.name = "Enhance Sunlight";
+    stage.map = sunlightMap();
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::darkAndLight(bool darken, int percent)
+{
+    Stage stage;
+    stage.name = std::string(darken ? "Darken " : "Lighten ")
+               + std::to_string(std::max(0, std::min(100, percent))) + "%";
+    stage.map = darkAndLightMap(darken, percent);
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::colorTint(int r, int g, int b, double intensity)
+{
+    Stage stage;
+    stage.name = "Color Tint";
+    stage.map = colorTintMap(r, g, b, intensity);
+    return add(std::move(stage));
+}
+
+FilterPipeline& FilterPipeline::channelMap(const std::string& name, const std::function<int(int channel, int value)>& transform)
+{
+    Stage stage;
+    stage.name = name;
+    stage.map = PointKernels::makeChannelMap(transform);
+    return add(std::move(stage));
+}
+
+PointKernels::ChannelMap FilterPipeline::invertMap()
+{
+    return PointKernels::makeChannelMap([](int, int p) { return 255 - p; });
+}
+
+PointKernels::ChannelMap FilterPipeline::purpleMap()
+{
+    // Boost red and blue, halve green
+    return PointKernels::makeChannelMap([](int channel, int p) {
+        return channel == 1 ? std::max(0, (int)(p * 0.5)) : std::min(255, (int)(p * 1.3));
+    });
+}
+
+PointKernels::ChannelMap FilterPipeline::sunlightMap()
+{
+    // Boost red and green by 40%
+    return PointKernels::makeChannelMap([](int channel, int p) {
+        return channel == 2 ? p : std::min(255, int(p * 1.4));
+    });
+}
+
+PointKernels::ChannelMap FilterPipeline::darkAndLightMap(bool darken, int percent)
+{
+    percent = std::max(0, std::min(100, percent));
+    const double factor = darken
+        ? std::max(0.0, 1.0 - (percent / 100.0))
+        : (1.0 + (percent / 100.0));
+    return PointKernels::makeChannelMap([factor](int, int p) {
+        double v = p * factor;
+        if (v < 0.0) v = 0.0;
+        if (v > 255.0) v = 255.0;
+        return static_cast<int>(v);
+    });
+}
+
+PointKernels::ChannelMap FilterPipeline::colorTintMap(int r, int g, int b, double intensity)
+{
+    intensity = std::max(0.0, std::min(1.0, intensity));
+    // Blend the tint color with the original pixel
+    const int tint[3] = {r, g, b};
+    return PointKernels::makeChannelMap([&](int channel, int p) {
+        return static_cast<int>(p * (1.0 - intensity) + tint[channel] * intensity);
+    });
+}
+
+PointKernels::ChannelMap FilterPipeline::compose(const PointKernels::ChannelMap& first,
+                                                 const PointKernels::ChannelMap& second)
+{
+    return PointKernels::makeChannelMap([&](int channel, int p) {
+        return second.lut[channel][first.lut[channel][p]];
+    });
+}
+
+std::string FilterPipeline::description() const
+{
+    std::string text;
+    for (const Stage& stage : stages) {
+        if (!text.empty()) text += " > ";
+        text += stage.name;
+    }
+    return text;
+}
+
+std::vector<FilterPipeline::Stage> FilterPipeline::fused() const
+{
+    std::vector<Stage> result;
+    for (const Stage& stage : stages) {
+        if (!result.empty()) {
+            Stage& last = result.back();
+            if (stage.kind == StageKind::ChannelMap && last.kind == StageKind::ChannelMap) {
+                last.map = compose(last.map, stage.map);
+                last.name += " > " + stage.name;
+                continue;
+            }
+            if (stage.kind == StageKind::Grayscale && last.kind == StageKind::Grayscale) {
+                continue;
+            }
+            if (stage.kind == StageKind::Threshold && last.kind == StageKind::Grayscale) {
+                last = stage;
+                continue;
+            }
+        }
+        result.push_back(stage);
+    }
+    return result;
+}
+
+bool FilterPipeline::apply(const ImageView& image, const std::atomic<bool>* cancelRequested,
+                           const RowProgress& progress) const
+{
+    if (image.empty() || stages.empty()) return true;
+    const std::vector<Stage> program = fused();
+
+    // Every band runs the whole chain on one row before moving to the next,
+    // so each row is loaded from memory once
+    return ThreadPool::instance().parallelRows(image.height, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            unsigned char* row = image.row(y);
+            for (const Stage& stage : program) {
+                switch (stage.kind) {
+                case StageKind::ChannelMap:
+                    PointKernels::mapChannels(row, row, image.width, stage.map);
+                    break;
+                case StageKind::Grayscale:
+                    PointKernels::grayscale(row, image.width);
+                    break;
+                case StageKind::Threshold:
+                    PointKernels::threshold(row, image.width, stage.level);
+                    break;
+                case StageKind::Infrared:
+                    PointKernels::infrared(row, image.width);
+                    break;
+                }
+            }
+        }
+    }, cancelRequested, progress);
+}
@@ -0,0 +1,189 @@
+/**
+ * @file FilterPipeline.h
+ * @brief Chains of point operations fused into a single pass over the image.
+ *
+ * This file declares the FilterPipeline class. A pipeline is an ordered list
+ * of point operations (grayscale, black & white, invert, infrared, purple,
+ * sunlight, dark & light, colour tint or any custom per-channel transform).
+ * Before running, consecutive per-channel transforms are composed into one
+ * 256-entry lookup table per channel, and the remaining stages are executed
+ * row by row, so every row is read from memory once and stays in cache while
+ * the whole chain is applied to it.
+ *
+ * @details The pipeline provides:
+ * - A fluent builder API that works without Qt (headless tools, scripts)
+ * - Lookup-table composition of adjacent per-channel stages
+ * - Row-fused execution of the fused stages on the shared ThreadPool
+ * - The vectorized PointKernels for every stage
+ * - Output identical to applying the same filters one after another
+ * - Progress reporting and cancellation between bands
+ *
+ * @note ImageFilters::applyPipeline() adapts a pipeline to the progress bar and
+ *       cancel flag; the GUI applies a whole chain as one undoable step.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef FILTERPIPELINE_H
+#define FILTERPIPELINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "../image/ImageView.h"
+#include "../simd/PointKernels.h"
+
+/**
+ * @class FilterPipeline
+ * @brief Ordered chain of point operations applied in one pass.
+ *
+ * @code
+ * FilterPipeline pipeline;
+ * pipeline.grayscale().darkAndLight(false, 30).colorTint(255, 120, 0, 0.25);
+ * pipeline.apply(image.view());   // one read and one write per pixel
+ * @endcode
+ *
+ * The static *Map() functions define the per-channel filters; ImageFilters
+ * uses the same tables for the individual filter buttons, so a chain and
+ * the equivalent sequence of single filters always agree.
+ */
+class FilterPipeline {
+public:
+    /**
+     * @brief Progress callback, invoked on the calling thread between bands.
+     *
+     * @param rowsDone Rows finished so far
+     * @param totalRows Total rows the operation will produce
+     */
+    using RowProgress = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief Kind of a pipeline stage.
+     */
+    enum class StageKind {
+        ChannelMap, ///< Independent per-channel table lookup
+        Grayscale,  ///< Channel average written to all channels
+        Threshold,  ///< Channel average compared to a level (black & white)
+        Infrared    ///< Red saturated, green and blue set to the inverted average
+    };
+
+    /**
+     * @brief One operation of the chain.
+     */
+    struct Stage {
+        StageKind kind = StageKind::ChannelMap;
+        std::string name;                ///< Display name, e.g. "Grayscale"
+        PointKernels::ChannelMap map{};  ///< Table for StageKind::ChannelMap
+        int level = 127;                 ///< Level for StageKind::Threshold
+    };
+
+    /// @name Builder
+    /// Each call appends one stage and returns the pipeline for chaining.
+    /// @{
+    FilterPipeline& grayscale();
+    FilterPipeline& blackAndWhite(int level = 127);
+    FilterPipeline& invert();
+    FilterPipeline& infrared();
+    FilterPipeline& purple();
+    FilterPipeline& sunlight();
+    /**
+     * @param darken True to darken, false to lighten
+     * @param percent Strength in percent, as in ImageFilters::applyDarkAndLight()
+     */
+    FilterPipeline& darkAndLight(bool darken, int percent);
+    /**
+     * @param intensity Blend factor in [0, 1] between the pixel and (r, g, b)
+     */
+    FilterPipeline& colorTint(int r, int g, int b, double intensity);
+    /**
+     * @brief Appends a custom per-channel transform.
+     *
+     * @param name Display name of the stage
+     * @param transform Function returning the output for (channel, value)
+     */
+    FilterPipeline& channelMap(const std::string& name, const std::function<int(int channel, int value)>& transform);
+    /// @}
+
+    /// @name Filter tables
+    /// Per-channel definitions shared with ImageFilters.
+    /// @{
+    static PointKernels::ChannelMap invertMap();
+    static PointKernels::ChannelMap purpleMap();
+    static PointKernels::ChannelMap sunlightMap();
+    static PointKernels::ChannelMap darkAndLightMap(bool darken, int percent);
+    static PointKernels::ChannelMap colorTintMap(int r, int g, int b, double intensity);
+    /// @}
+
+    /**
+     * @brief Removes every stage.
+     */
+    void clear() { stages.clear(); }
+
+    /**
+     * @brief True if the pipeline has no stage.
+     */
+    bool empty() const { return stages.empty(); }
+
+    /**
+     * @brief Number of stages as added.
+     */
+    std::size_t size() const { return stages.size(); }
+
+    /**
+     * @brief The stages as added.
+     */
+    const std::vector<Stage>& steps() const { return stages; }
+
+    /**
+     * @brief Stage names joined with " > ", e.g. "Grayscale > Purple".
+     */
+    std::string description() const;
+
+    /**
+     * @brief Returns the stages after fusion.
+     *
+     * Adjacent per-channel stages become one composed table and repeated
+     * grayscale stages collapse into one. A grayscale stage directly followed
+     * by a threshold is dropped, since thresholding a gray pixel gives the same
+     * result as thresholding the original.
+     */
+    std::vector<Stage> fused() const;
+
+    /**
+     * @brief Applies every stage to @p image in place.
+     *
+     * @param image Pixels to transform (3 channels)
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback
+     * @return true on completion, false if cancelled (rows already processed
+     *         keep the new values, so callers restore their own copy)
+     */
+    bool apply(const ImageView& image, const std::atomic<bool>* cancelRequested = nullptr,
+               const RowProgress& progress = {}) const;
+
+private:
+    /**
+     * @brief Appends a stage and returns *this.
+     */
+    FilterPipeline& add(Stage stage);
+
+    /**
+     * @brief Table equal to applying @p first, then @p second.
+     */
+    static PointKernels::ChannelMap compose(const PointKernels::ChannelMap& first,
+                                            const PointKernels::ChannelMap& second);
+
+    std::vector<Stage> stages;
+};
+
+#endif // FILTERPIPELINE_H
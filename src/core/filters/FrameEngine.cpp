@@ -0,0 +1,324 @@
+/**
+ * @file FrameEngine.cpp
+ * @brief Implementation of the frame styles and the border strip cache.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "FrameEngine.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t kCacheBytes = std::size_t(64) << 20;
+
+using Color = FrameEngine::Color;
+using Frame = FrameEngine::Frame;
+
+constexpr Color kWhite{255, 255, 255};
+
+Color scaled(Color color, double r, double g, double b)
+{
+    return {static_cast<unsigned char>(static_cast<int>(color.r * r)),
+            static_cast<unsigned char>(static_cast<int>(color.g * g)),
+            static_cast<unsigned char>(static_cast<int>(color.b * b))};
+}
+
+Frame uniform(FrameEngine::Style style, int margin)
+{
+    Frame frame;
+    frame.style = style;
+    frame.left = frame.top = frame.right = frame.bottom = margin;
+    frame.band = margin;
+    return frame;
+}
+
+Frame solid(int width, Color color)
+{
+    Frame frame = uniform(FrameEngine::Style::Solid, width);
+    frame.colors[0] = color;
+    return frame;
+}
+
+Frame simple(int width, int gap, int ring, Color color)
+{
+    Frame frame = uniform(FrameEngine::Style::Simple, width);
+    frame.gap = gap;
+    frame.ring = ring;
+    frame.colors[0] = color;
+    frame.colors[1] = kWhite;
+    return frame;
+}
+
+Frame doubleBorder(int outer, int gap, int inner, Color background, Color border)
+{
+    Frame frame = uniform(FrameEngine::Style::DoubleBorder, outer + gap + inner);
+    frame.band = outer;
+    frame.gap = gap;
+    frame.colors[0] = background;
+    frame.colors[1] = border;
+    return frame;
+}
+
+Frame shadow(int pad, int shadowWidth, int step, int maxShade, Color background, Color full)
+{
+    Frame frame;
+    frame.style = FrameEngine::Style::Shadow;
+    frame.left = frame.top = pad;
+    frame.right = frame.bottom = shadowWidth;
+    frame.shadeStep = step;
+    frame.shadeMax = maxShade;
+    frame.colors[0] = background;
+    frame.colors[1] = full;
+    return frame;
+}
+
+Frame patterned(FrameEngine::Style style, int width, Color outer, Color inner, Color accent)
+{
+    Frame frame = uniform(style, width);
+    frame.colors[0] = outer;
+    frame.colors[1] = inner;
+    frame.colors[2] = accent;
+    return frame;
+}
+
+inline void put(unsigned char* p, Color color)
+{
+    p[0] = color.r;
+    p[1] = color.g;
+    p[2] = color.b;
+}
+
+inline void fillSpan(unsigned char* p, int count, Color color)
+{
+    for (int x = 0; x < count; ++x, p += 3) put(p, color);
+}
+
+/**
+ * @brief Evaluates @p colorAt over the four border strips of a framed image.
+ *
+ * @p colorAt takes framed-image coordinates; the style is chosen once, before
+ * the loops, so the compiler inlines the pattern into each of them.
+ */
+template <typename ColorAt>
+void renderStrips(const Frame& frame, int imageWidth, int imageHeight, std::vector<unsigned char>* strips,
+                  ColorAt colorAt)
+{
+    const int width = frame.framedWidth(imageWidth);
+    const struct {
+        int x, y, w, h;
+    } areas[4] = {
+        {0, 0, width, frame.top},
+        {0, frame.top + imageHeight, width, frame.bottom},
+        {0, frame.top, frame.left, imageHeight},
+        {frame.left + imageWidth, frame.top, frame.right, imageHeight},
+    };
+    for (int i = 0; i < 4; ++i) {
+        strips[i].resize(static_cast<std::size_t>(areas[i].w) * areas[i].h * 3);
+        unsigned char* p = strips[i].data();
+        for (int y = areas[i].y; y < areas[i].y + areas[i].h; ++y) {
+            for (int x = areas[i].x; x < areas[i].x + areas[i].w; ++x, p += 3) put(p, colorAt(x, y));
+        }
+    }
+}
+
+} // namespace
+
+Frame FrameEngine::Frame::preset(const std::string& name)
+{
+    if (name == "Simple Frame") return simple(10, 5, 5, {0, 0, 255});
+    if (name == "Double Border - White") return doubleBorder(14, 4, 6, {20, 20, 20}, kWhite);
+    if (name == "Solid Frame - Blue") return solid(20, {0, 0, 255});
+    if (name == "Solid Frame - Red") return solid(20, {255, 0, 0});
+    if (name == "Solid Frame - Green") return solid(20, {0, 255, 0});
+    if (name == "Solid Frame - Black") return solid(20, {0, 0, 0});
+    if (name == "Solid Frame - White") return solid(20, kWhite);
+    // Grey shadow: 20 plus up to 60 levels, 6 per pixel (a "full" shadow of 100 makes the percent a level)
+    if (name == "Shadow Frame") return shadow(15, 18, 6, 60, {20, 20, 20}, {100, 100, 100});
+    if (name == "Gold Decorated Frame") {
+        return patterned(Style::Gold, 45, {180, 140, 40}, {240, 210, 120}, {200, 160, 60});
+    }
+    return patterned(Style::Decorated, 25, {100, 70, 50}, {235, 225, 210}, {180, 140, 80});
+}
+
+Frame FrameEngine::Frame::custom(const std::string& name, int width, Color color)
+{
+    width = std::max(1, width);
+    if (name == "Solid Frame") return solid(width, color);
+    if (name == "Simple Frame") return simple(width, 3, width / 2, color);
+    if (name == "Double Border") {
+        return doubleBorder(width * 2, width / 2, width, {static_cast<unsigned char>(color.r / 4),
+                            static_cast<unsigned char>(color.g / 4), static_cast<unsigned char>(color.b / 4)}, color);
+    }
+    if (name == "Shadow Frame") {
+        return shadow(width, width * 2, 4, 100, {static_cast<unsigned char>(color.r / 8),
+                      static_cast<unsigned char>(color.g / 8), static_cast<unsigned char>(color.b / 8)}, color);
+    }
+    if (name == "Gold Decorated Frame") {
+        return patterned(Style::Gold, width * 2, scaled(color, 0.7, 0.55, 0.16), scaled(color, 0.94, 0.82, 0.47),
+                         scaled(color, 0.78, 0.63, 0.24));
+    }
+    return patterned(Style::Decorated, width, scaled(color, 0.39, 0.27, 0.20), scaled(color, 0.92, 0.88, 0.82),
+                     scaled(color, 0.71, 0.55, 0.31));
+}
+
+std::shared_ptr<const FrameEngine::Strips> FrameEngine::render(const Frame& frame, int imageWidth, int imageHeight)
+{
+    auto strips = std::make_shared<Strips>();
+    std::vector<unsigned char> parts[4];
+    const int width = frame.framedWidth(imageWidth);
+    const int height = frame.framedHeight(imageHeight);
+    const Color* colors = frame.colors;
+    // Distance to the nearest edge of the framed image
+    auto edgeDistance = [=](int x, int y) { return std::min({x, y, width - 1 - x, height - 1 - y}); };
+
+    switch (frame.style) {
+    case Style::Solid:
+    case Style::Simple:
+        renderStrips(frame, imageWidth, imageHeight, parts, [=](int, int) { return colors[0]; });
+        break;
+    case Style::DoubleBorder:
+        // Outside the image everything past the gap is the inner border
+        renderStrips(frame, imageWidth, imageHeight, parts, [=](int x, int y) {
+            const int d = edgeDistance(x, y);
+            return d < frame.band || d >= frame.band + frame.gap ? colors[1] : colors[0];
+        });
+        break;
+    case Style::Shadow: {
+        const int imageRight = frame.left + imageWidth;
+        const int imageBottom = frame.top + imageHeight;
+        renderStrips(frame, imageWidth, imageHeight, parts, [=](int x, int y) {
+            const int dist = std::max(std::max(0, x - imageRight), std::max(0, y - imageBottom));
+            const int shade = std::min(frame.shadeMax, dist * frame.shadeStep);
+            return Color{static_cast<unsigned char>(std::min(255, colors[0].r + colors[1].r * shade / 100)),
+                         static_cast<unsigned char>(std::min(255, colors[0].g + colors[1].g * shade / 100)),
+                         static_cast<unsigned char>(std::min(255, colors[0].b + colors[1].b * shade / 100))};
+        });
+        break;
+    }
+    case Style::Gold: {
+        const int plate = std::max(0, frame.band - 6);
+        renderStrips(frame, imageWidth, imageHeight, parts, [=](int x, int y) {
+            if (x >= plate && x < width - plate && y >= plate && y < height - plate) return colors[1];
+            const bool stripe = ((x + y) % 11 == 0) || ((x - y + 1000) % 13 == 0);
+            return stripe && edgeDistance(x, y) >= 3 ? colors[2] : colors[0];
+        });
+        break;
+    }
+    case Style::Decorated:
+        renderStrips(frame, imageWidth, imageHeight, parts, [=](int x, int y) {
+            const int d = edgeDistance(x, y);
+            if (d < 3) return colors[0];
+            if (d == 9 || d == 12 || d == 15) return colors[2];
+            if (d < frame.band - 4) return (x + y) % 12 == 0 ? colors[2] : colors[1];
+            return d < frame.band - 1 ? colors[2] : colors[0];
+        });
+        break;
+    }
+    strips->top = std::move(parts[0]);
+    strips->bottom = std::move(parts[1]);
+    strips->left = std::move(parts[2]);
+    strips->right = std::move(parts[3]);
+    return strips;
+}
+
+std::shared_ptr<const FrameEngine::Strips> FrameEngine::cached(const Frame& frame, int imageWidth, int imageHeight)
+{
+    struct Entry {
+        Frame frame;
+        int width;
+        int height;
+        std::shared_ptr<const Strips> strips;
+    };
+    static std::mutex mutex;
+    static std::list<Entry> entries; // Most recently used first
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->frame == frame && it->width == imageWidth && it->height == imageHeight) {
+                entries.splice(entries.begin(), entries, it);
+                return it->strips;
+            }
+        }
+    }
+
+    // Rendered outside the lock: two threads missing together both render, one copy is kept
+    std::shared_ptr<const Strips> strips = render(frame, imageWidth, imageHeight);
+    if (strips->bytes() > kCacheBytes) return strips;
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_front(Entry{frame, imageWidth, imageHeight, strips});
+    std::size_t total = 0;
+    for (auto it = entries.begin(); it != entries.end();) {
+        total += it->strips->bytes();
+        it = total > kCacheBytes ? entries.erase(it) : std::next(it);
+    }
+    return strips;
+}
+
+bool FrameEngine::apply(const Frame& frame, const ConstImageView& src, const ImageView& dst,
+                        const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    if (src.channels != 3 || dst.channels != 3) throw std::invalid_argument("Frames need 3-channel images");
+    if (dst.width != frame.framedWidth(src.width) || dst.height != frame.framedHeight(src.height)) {
+        throw std::invalid_argument("Frame destination size does not match the framed image");
+    }
+    if (dst.empty()) return true;
+
+    const std::shared_ptr<const Strips> strips = cached(frame, src.width, src.height);
+    const std::size_t rowBytes = static_cast<std::size_t>(dst.rowBytes());
+    const std::size_t leftBytes = static_cast<std::size_t>(frame.left) * 3;
+    const std::size_t rightBytes = static_cast<std::size_t>(frame.right) * 3;
+    const std::size_t imageBytes = static_cast<std::size_t>(src.rowBytes());
+    const int imageBottom = frame.top + src.height;
+
+    // Simple frames paint a ring over the image, inset by frame.gap from its edges
+    const bool ring = frame.style == Style::Simple && frame.ring > 0;
+    const int ringBegin = frame.gap;
+    const int ringEndX = src.width - frame.gap;
+    const int ringEndY = src.height - frame.gap;
+
+    return ThreadPool::instance().parallelRows(dst.height, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            unsigned char* out = dst.row(y);
+            if (y < frame.top) {
+                std::memcpy(out, strips->top.data() + static_cast<std::size_t>(y) * rowBytes, rowBytes);
+                continue;
+            }
+            if (y >= imageBottom) {
+                std::memcpy(out, strips->bottom.data() + static_cast<std::size_t>(y - imageBottom) * rowBytes,
+                            rowBytes);
+                continue;
+            }
+            const int iy = y - frame.top;
+            if (leftBytes > 0) std::memcpy(out, strips->left.data() + static_cast<std::size_t>(iy) * leftBytes, leftBytes);
+            std::memcpy(out + leftBytes, src.row(iy), imageBytes);
+            if (rightBytes > 0) {
+                std::memcpy(out + leftBytes + imageBytes,
+                            strips->right.data() + static_cast<std::size_t>(iy) * rightBytes, rightBytes);
+            }
+            if (!ring || iy < ringBegin || iy >= ringEndY || ringEndX <= ringBegin) continue;
+            unsigned char* image = out + leftBytes;
+            if (iy < ringBegin + frame.ring || iy >= ringEndY - frame.ring) {
+                fillSpan(image + ringBegin * 3, ringEndX - ringBegin, frame.colors[1]);
+            } else {
+                const int side = std::min(frame.ring, ringEndX - ringBegin);
+                fillSpan(image + ringBegin * 3, side, frame.colors[1]);
+                fillSpan(image + (ringEndX - side) * 3, side, frame.colors[1]);
+            }
+        }
+    }, cancelRequested, progress);
+}
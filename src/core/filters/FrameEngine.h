@@ -0,0 +1,179 @@
+/**
+ * @file FrameEngine.h
+ * @brief Decorative frames rendered once per size and pasted as border strips.
+ *
+ * This file declares the FrameEngine class, which implements every frame
+ * style of ImageFilters::applyFrame(). A frame is resolved once from its menu
+ * name into a Frame: a style enum plus every width and color it uses. The
+ * pattern is then evaluated only over the border strips around the image,
+ * never over the image itself, and the rendered strips are cached by frame
+ * and image size. Framing further images of the same size copies the cached
+ * strips and the image rows, so batch framing costs little more than memcpy.
+ *
+ * @details The engine provides:
+ * - Solid, simple (with an inset ring), double border, drop shadow, gold and
+ *   decorated styles, with the preset palettes and custom colors
+ * - Frame::preset() and Frame::custom() as the only places names are compared
+ * - Border strips cached by frame and image size, least recently used first out
+ * - One pass over the framed image in parallel row bands, with progress and
+ *   cancellation
+ *
+ * @note The engine works on ImageView/ConstImageView and has no Qt dependency;
+ *       ImageFilters adapts it to the progress bar and cancel flag.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef FRAMEENGINE_H
+#define FRAMEENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../image/ImageView.h"
+
+/**
+ * @class FrameEngine
+ * @brief Static utility class rendering and caching frame borders.
+ *
+ * @code
+ * const FrameEngine::Frame frame = FrameEngine::Frame::preset("Gold Decorated Frame");
+ * Image framed(frame.framedWidth(image.width), frame.framedHeight(image.height));
+ * FrameEngine::apply(frame, image.constView(), framed.view());
+ * @endcode
+ *
+ * @see ImageFilters::applyFrame() for the reporting wrappers
+ */
+class FrameEngine {
+public:
+    /**
+     * @brief Progress callback, invoked on the calling thread between bands.
+     */
+    using RowProgress = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief Pattern drawn around the image.
+     */
+    enum class Style {
+        Solid,        ///< One color
+        Simple,       ///< One color, plus a ring painted over the image edge
+        DoubleBorder, ///< Two borders of one color on a background
+        Shadow,       ///< Background darkening into a shadow to the bottom right
+        Gold,         ///< Diagonal accent stripes around a lighter plate
+        Decorated     ///< Concentric bands with a diagonal accent pattern
+    };
+
+    /**
+     * @brief An RGB color.
+     */
+    struct Color {
+        unsigned char r = 0;
+        unsigned char g = 0;
+        unsigned char b = 0;
+
+        bool operator==(const Color&) const = default;
+    };
+
+    /**
+     * @brief Everything that determines a frame's pixels, apart from the image size.
+     */
+    struct Frame {
+        Style style = Style::Solid;
+        int left = 0;           ///< Margins around the image
+        int top = 0;
+        int right = 0;
+        int bottom = 0;
+        int band = 0;           ///< Double border: width of each border; gold and decorated: frame width
+        int gap = 0;            ///< Double border: background between the borders; simple: inset of the ring
+        int ring = 0;           ///< Simple: width of the ring over the image edge
+        int shadeStep = 0;      ///< Shadow: shade added per pixel away from the image, in percent
+        int shadeMax = 0;       ///< Shadow: largest shade, in percent
+        /// [0] frame or background, [1] inner plate, border, ring or full shadow, [2] accent
+        Color colors[3];
+
+        bool operator==(const Frame&) const = default;
+
+        /**
+         * @brief The frame of a preset menu entry ("Simple Frame", "Solid Frame - Blue", ...).
+         *
+         * Unknown names give the decorated frame.
+         */
+        static Frame preset(const std::string& name);
+
+        /**
+         * @brief The frame of style @p name ("Solid Frame", "Double Border", ...) in a custom color.
+         *
+         * Unknown names give the decorated frame.
+         *
+         * @param name Style name
+         * @param width Frame width in pixels (at least 1)
+         * @param color Frame color
+         */
+        static Frame custom(const std::string& name, int width, Color color);
+
+        /**
+         * @brief Width of the framed image.
+         */
+        int framedWidth(int imageWidth) const { return imageWidth + left + right; }
+
+        /**
+         * @brief Height of the framed image.
+         */
+        int framedHeight(int imageHeight) const { return imageHeight + top + bottom; }
+    };
+
+    /**
+     * @brief Writes @p src framed by @p frame into @p dst.
+     *
+     * The border strips come from the cache, or are rendered and cached on a
+     * miss; then each row copies its strips and the image row.
+     *
+     * @param frame Frame to draw
+     * @param src Image pixels (3 channels)
+     * @param dst Destination of frame.framedWidth(src.width) x frame.framedHeight(src.height); must not alias @p src
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback
+     * @return true on completion, false if cancelled
+     * @throws std::invalid_argument If the sizes do not match or an image is not 3-channel
+     */
+    static bool apply(const Frame& frame, const ConstImageView& src, const ImageView& dst,
+                      const std::atomic<bool>* cancelRequested = nullptr, const RowProgress& progress = {});
+
+private:
+    /**
+     * @brief Rendered border of one frame at one image size.
+     */
+    struct Strips {
+        std::vector<unsigned char> top;    ///< framed width x frame.top
+        std::vector<unsigned char> bottom; ///< framed width x frame.bottom
+        std::vector<unsigned char> left;   ///< frame.left x image height
+        std::vector<unsigned char> right;  ///< frame.right x image height
+
+        std::size_t bytes() const { return top.size() + bottom.size() + left.size() + right.size(); }
+    };
+
+    /**
+     * @brief Evaluates the frame over its border only.
+     */
+    static std::shared_ptr<const Strips> render(const Frame& frame, int imageWidth, int imageHeight);
+
+    /**
+     * @brief Returns the cached strips for a frame and size, rendering and caching them on a miss.
+     *
+     * Recently used strips are kept up to a fixed byte budget.
+     */
+    static std::shared_ptr<const Strips> cached(const Frame& frame, int imageWidth, int imageHeight);
+};
+
+#endif // FRAMEENGINE_H
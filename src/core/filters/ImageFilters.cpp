@@ -1,6 +1,6 @@
 /**
  * @file ImageFilters.cpp
- * @brief Implementation of image processing filters with Qt integration and cancellation support.
+ * @brief Implementation of image processing filters with progress reporting and cancellation support.
  * 
  * This file contains the complete implementation of the ImageFilters class, providing
  * a comprehensive suite of image processing operations. All implementations include
@@ -14,8 +14,8 @@
  * - Image combination (merge operations)
  * 
  * All long-running operations support:
- * - Real-time progress updates via QProgressBar
- * - Status updates via QStatusBar
+ * - Real-time progress updates via a ProgressReporter
+ * - Status updates via the same reporter
  * - Cancellation via atomic flags
  * - Exception safety and error handling
  * 
@@ -31,48 +31,93 @@
  */
 
 #include "ImageFilters.h"
-#include <QtWidgets/QProgressBar>
-#include <QtWidgets/QStatusBar>
-#include <QtWidgets/QApplication>
-#include <QtCore/QString>
+#include "ProgressReporter.h"
 #include "image/Image_Class.h"
+#include "BlurEngine.h"
+#include "FrameEngine.h"
+#include "OilPaintEngine.h"
+#include "WarpEngine.h"
+#include "FilterPipeline.h"
+#include "Stencil.h"
+#include "parallel/ThreadPool.h"
 #include <cmath>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief "r, g, b" for status messages.
+ */
+std::string rgbText(int r, int g, int b)
+{
+    return std::to_string(r) + ", " + std::to_string(g) + ", " + std::to_string(b);
+}
 
 /**
- * @brief Constructs an ImageFilters object with Qt UI components.
+ * @brief @p value with @p decimals digits after the point, for status messages.
+ */
+std::string fixedText(double value, int decimals)
+{
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.*f", decimals, value);
+    return text;
+}
+
+} // namespace
+
+/**
+ * @brief Constructs an ImageFilters object reporting to @p reporter.
  * 
- * @param progressBar Pointer to QProgressBar for progress tracking (can be nullptr)
- * @param statusBar Pointer to QStatusBar for status updates (can be nullptr)
+ * @param reporter Receiver of progress and status updates (can be nullptr)
  * 
- * @note Both parameters are optional. If nullptr, progress and status updates will be skipped.
+ * @note If nullptr, progress and status updates will be skipped.
  */
-ImageFilters::ImageFilters(QProgressBar* progressBar, QStatusBar* statusBar)
-    : progressBar(progressBar), statusBar(statusBar)
+ImageFilters::ImageFilters(ProgressReporter* reporter)
+    : reporter(reporter)
 {
 }
 
 /**
- * @brief Updates the progress bar with current progress.
- * 
- * This method safely updates the progress bar and processes Qt events to maintain
- * UI responsiveness during long-running operations.
+ * @brief Reports progress to the reporter, throttled to every @p updateInterval steps.
  * 
  * @param value Current progress value (0 to total)
  * @param total Maximum progress value
  * @param updateInterval Number of operations between UI updates (default: 50)
  * 
- * @note This method is thread-safe and can be called from any thread.
- * @see QApplication::processEvents() for UI responsiveness
+ * @note This method is thread-safe as long as the reporter is.
  */
 void ImageFilters::updateProgress(int value, int total, int updateInterval)
 {
-    if (progressBar) {
-        progressBar->setValue(value);
-        if (value % updateInterval == 0) {
-            QApplication::processEvents();
-        }
-    }
+    if (!reporter) return;
+    if (value % std::max(1, updateInterval) != 0 && value < total) return;
+    reporter->updateProgress(value, total);
+}
+
+void ImageFilters::beginProgress(int total)
+{
+    if (reporter) reporter->beginProgress(total);
+}
+
+void ImageFilters::endProgress()
+{
+    if (reporter) reporter->endProgress();
+}
+
+void ImageFilters::showStatus(const std::string& message)
+{
+    if (reporter) reporter->showStatus(message);
+}
+
+void ImageFilters::reportFailure(const std::exception& error)
+{
+    // Never empty, so an exception without a message still counts as a failure
+    lastError = *error.what() ? error.what() : "unknown error";
+    showStatus(std::string("Filter failed: ") + error.what());
 }
 
 /**
@@ -89,19 +134,53 @@ void ImageFilters::updateProgress(int value, int total, int updateInterval)
  * @note This method should be called periodically during long-running operations.
  * @see std::atomic for thread-safe cancellation
  */
-void ImageFilters::checkCancellation(std::atomic<bool>& cancelRequested, Image& currentImage, Image& preFilterImage, const QString& filterName)
+void ImageFilters::checkCancellation(std::atomic<bool>& cancelRequested, Image& currentImage, Image& preFilterImage, const std::string& filterName)
 {
     if (cancelRequested) {
         currentImage = preFilterImage;
-        if (statusBar) {
-            statusBar->showMessage(QString("%1 filter cancelled").arg(filterName));
-        }
-        if (progressBar) {
-            progressBar->setVisible(false);
-        }
+        showStatus(filterName + " filter cancelled");
+        endProgress();
     }
 }
 
+/**
+ * @brief Runs a row-band kernel on all cores through the shared ThreadPool.
+ * 
+ * Bands are claimed dynamically by the pool's workers and the calling thread.
+ * Only the calling thread reports progress, and updateProgress() queues it to
+ * the GUI thread, so this is safe to call from any thread.
+ * 
+ * @param height Number of rows to process
+ * @param band Kernel processing rows [rowBegin, rowEnd)
+ * @param cancelRequested Optional cancel flag checked by every worker between bands
+ * @return true if every row was processed, false if cancelled
+ */
+bool ImageFilters::runRows(int height, const std::function<void(int rowBegin, int rowEnd)>& band, std::atomic<bool>* cancelRequested)
+{
+    if (!cancelRequested) {
+        return ThreadPool::instance().parallelRows(height, band);
+    }
+    return ThreadPool::instance().parallelRows(height, band, cancelRequested, [this](int done, int total) {
+        updateProgress(done, total, 1);
+    });
+}
+
+/**
+ * @brief Applies a per-channel colour map to every row in place.
+ * 
+ * The image is detached from shared copies once, then each band maps its rows
+ * with the vectorized kernel.
+ */
+bool ImageFilters::mapRows(Image& image, const PointKernels::ChannelMap& map, std::atomic<bool>* cancelRequested)
+{
+    ImageView img = image.view();
+    return runRows(img.height, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            PointKernels::mapChannels(img.row(y), img.row(y), img.width, map);
+        }
+    }, cancelRequested);
+}
+
 /**
  * @brief Apply grayscale conversion to the image with progress tracking and cancellation support.
  * 
@@ -125,52 +204,35 @@ void ImageFilters::checkCancellation(std::atomic<bool>& cancelRequested, Image&
  */
 void ImageFilters::applyGrayscale(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Grayscale filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Grayscale filter... (Click Cancel to stop)");
     
     try {
+        if (currentImage.format() == PixelFormat::gray8()) {
+            // A one-channel image is already its own grayscale
+            showStatus("Grayscale filter applied");
+            endProgress();
+            return;
+        }
+        ImageView img = currentImage.view();
         // Simple grayscale conversion with cancellation support
-        for (int y = 0; y < currentImage.height; y++) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Grayscale");
-                return;
+        bool completed = runRows(img.height, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                PointKernels::grayscale(img.row(y), img.width);
             }
-            
-            for (int x = 0; x < currentImage.width; x++) {
-                int r = currentImage(x, y, 0);
-                int g = currentImage(x, y, 1);
-                int b = currentImage(x, y, 2);
-                int gray = (r + g + b) / 3;
-                currentImage.setPixel(x, y, 0, gray);
-                currentImage.setPixel(x, y, 1, gray);
-                currentImage.setPixel(x, y, 2, gray);
-            }
-            
-            // Update progress
-            updateProgress(y + 1, currentImage.height);
+        }, &cancelRequested);
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Grayscale");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Grayscale filter applied");
-        }
+        showStatus("Grayscale filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
 /**
@@ -182,11 +244,12 @@ void ImageFilters::applyGrayscale(Image& currentImage, Image& preFilterImage, st
  * @param currentImage Reference to the image to process (modified in-place)
  * @param preFilterImage Reference to store the original image state for cancellation
  * @param cancelRequested Atomic flag to check for cancellation requests
+ * @param seed Noise seed; equal seeds give equal results on any thread count
  * 
  * @details The TV/CRT effect includes:
  * - Horizontal scan lines (darker every 3rd row)
  * - Color temperature shifts (blue/purple for dark areas, warm orange for bright areas)
- * - Random noise for authentic TV feel
+ * - Random noise for authentic TV feel, a pure function of seed and pixel position
  * - Brightness-based color adjustments
  * - Processes pixels row by row for progress tracking
  * - Checks for cancellation after each row
@@ -195,95 +258,80 @@ void ImageFilters::applyGrayscale(Image& currentImage, Image& preFilterImage, st
  * @see updateProgress() for progress tracking
  * @see checkCancellation() for cancellation handling
  */
-void ImageFilters::applyTVFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
+void ImageFilters::applyTVFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                                 std::uint64_t seed)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying TV/CRT filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying TV/CRT filter... (Click Cancel to stop)");
     
     try {
-    // Initialize random number generator with time-based seed
-    auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    std::mt19937 rng(seed);
-    std::uniform_int_distribution<int> noise_dist(-10, 10);
+        // Noise is hashed from (seed, x, y), so rows can be processed on any thread in any order
+        const NoiseSource noise(seed);
 
-        for (int y = 0; y < currentImage.height; y++) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "TV/CRT");
-                return;
-            }
+        ImageView img = currentImage.view();
+        bool completed = runRows(img.height, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                unsigned char* p = img.row(y);
+                for (int x = 0; x < img.width; x++, p += 3) {
+                    // Get original pixel values
+                    int r = p[0];
+                    int g = p[1];
+                    int b = p[2];
             
-            for (int x = 0; x < currentImage.width; x++) {
-            // Get original pixel values
-                int r = currentImage(x, y, 0);
-                int g = currentImage(x, y, 1);
-                int b = currentImage(x, y, 2);
-            
-            // 1. Add horizontal scanlines (dark lines every few pixels)
-            float scanlineIntensity = 1.0f;
-            if (y % 3 == 0) {  // Every 3rd row gets darker
-                scanlineIntensity = 0.7f;
-            }
+                    // 1. Add horizontal scanlines (dark lines every few pixels)
+                    float scanlineIntensity = 1.0f;
+                    if (y % 3 == 0) {  // Every 3rd row gets darker
+                        scanlineIntensity = 0.7f;
+                    }
             
-            // 2. Color shift and glow effect
-            // Enhance blues and purples, add warm orange highlights
-            float brightness = (r + g + b) / 3.0f / 255.0f;
+                    // 2. Color shift and glow effect
+                    // Enhance blues and purples, add warm orange highlights
+                    float brightness = (r + g + b) / 3.0f / 255.0f;
             
-            // Add blue/purple tint to darker areas
-            if (brightness < 0.5f) {
-                r = std::min(255, static_cast<int>(r * 0.8f));
-                g = std::min(255, static_cast<int>(g * 0.7f));
-                b = std::min(255, static_cast<int>(b * 1.2f));
-            }
+                    // Add blue/purple tint to darker areas
+                    if (brightness < 0.5f) {
+                        r = std::min(255, static_cast<int>(r * 0.8f));
+                        g = std::min(255, static_cast<int>(g * 0.7f));
+                        b = std::min(255, static_cast<int>(b * 1.2f));
+                    }
             
-            // Add warm orange glow to bright areas
-            if (brightness > 0.7f) {
-                r = std::min(255, static_cast<int>(r * 1.3f));
-                g = std::min(255, static_cast<int>(g * 1.1f));
-                b = std::max(0, static_cast<int>(b * 0.9f));
-            }
+                    // Add warm orange glow to bright areas
+                    if (brightness > 0.7f) {
+                        r = std::min(255, static_cast<int>(r * 1.3f));
+                        g = std::min(255, static_cast<int>(g * 1.1f));
+                        b = std::max(0, static_cast<int>(b * 0.9f));
+                    }
 
-            // 3. Apply scanline effect
-            r = static_cast<int>(r * scanlineIntensity);
-            g = static_cast<int>(g * scanlineIntensity);
-            b = static_cast<int>(b * scanlineIntensity);
+                    // 3. Apply scanline effect
+                    r = static_cast<int>(r * scanlineIntensity);
+                    g = static_cast<int>(g * scanlineIntensity);
+                    b = static_cast<int>(b * scanlineIntensity);
             
-            // 4. Add slight noise/grain for authentic TV feel
-            int noise = noise_dist(rng); // -10 to +10
-            r = std::min(255, std::max(0, r + noise));
-            g = std::min(255, std::max(0, g + noise));
-            b = std::min(255, std::max(0, b + noise));
+                    // 4. Add slight noise/grain for authentic TV feel
+                    int grain = noise.uniform(x, y, -10, 10);
+                    r = std::min(255, std::max(0, r + grain));
+                    g = std::min(255, std::max(0, g + grain));
+                    b = std::min(255, std::max(0, b + grain));
             
-            // Set the final pixel
-                currentImage.setPixel(x, y, 0, r);
-                currentImage.setPixel(x, y, 1, g);
-                currentImage.setPixel(x, y, 2, b);
+                    // Set the final pixel
+                    p[0] = static_cast<unsigned char>(r);
+                    p[1] = static_cast<unsigned char>(g);
+                    p[2] = static_cast<unsigned char>(b);
+                }
             }
-            
-            // Update progress
-            updateProgress(y + 1, currentImage.height, 20);
+        }, &cancelRequested);
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "TV/CRT");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("TV/CRT filter applied");
-        }
+        showStatus("TV/CRT filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
 /**
@@ -310,53 +358,29 @@ void ImageFilters::applyTVFilter(Image& currentImage, Image& preFilterImage, std
  */
 void ImageFilters::applyBlackAndWhite(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Black & White filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Black & White filter... (Click Cancel to stop)");
     
     try {
+        ImageView img = currentImage.view();
         // Pure black and white conversion with cancellation support
-        for (int y = 0; y < currentImage.height; y++) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Black & White");
-                return;
+        bool completed = runRows(img.height, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                PointKernels::threshold(img.row(y), img.width, 127);
             }
-            
-            for (int x = 0; x < currentImage.width; x++) {
-                int r = currentImage(x, y, 0);
-                int g = currentImage(x, y, 1);
-                int b = currentImage(x, y, 2);
-                int gray = (r + g + b) / 3;
-                int bw = (gray > 127) ? 255 : 0;
-                currentImage.setPixel(x, y, 0, bw);
-                currentImage.setPixel(x, y, 1, bw);
-                currentImage.setPixel(x, y, 2, bw);
-            }
-            
-            // Update progress
-            updateProgress(y + 1, currentImage.height);
+        }, &cancelRequested);
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Black & White");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Black & White filter applied");
-        }
+        showStatus("Black & White filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
 /**
@@ -382,90 +406,64 @@ void ImageFilters::applyBlackAndWhite(Image& currentImage, Image& preFilterImage
  */
 void ImageFilters::applyInvert(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Invert filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Invert filter... (Click Cancel to stop)");
     
     try {
-        for (int y = 0; y < currentImage.height; y++) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Invert");
-                return;
-            }
-            
-            for (int x = 0; x < currentImage.width; x++) {
-                currentImage.setPixel(x, y, 0, 255 - currentImage(x, y, 0));
-                currentImage.setPixel(x, y, 1, 255 - currentImage(x, y, 1));
-                currentImage.setPixel(x, y, 2, 255 - currentImage(x, y, 2));
-            }
-            
-            // Update progress
-            updateProgress(y + 1, currentImage.height);
+        ImageView img = currentImage.view();
+        const std::size_t rowBytes = static_cast<std::size_t>(img.rowBytes());
+        bool completed = runRows(img.height, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                PointKernels::invert(img.row(y), rowBytes);
+            }
+        }, &cancelRequested);
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Invert");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Invert filter applied");
-        }
+        showStatus("Invert filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
 /**
- * @brief Merge the current image with another image by averaging pixel values.
+ * @brief Merge the current image with another image through BlendEngine.
  * 
- * Combines two images by averaging their corresponding pixel values.
- * The resulting image will have the dimensions of the smaller input image.
+ * Blends the merge image over the current image in place, in the chosen
+ * mode and at the chosen opacity. The result keeps the size of the current
+ * image: a merge image of another size is resampled to it band by band as
+ * it is blended, never cropped to the overlap.
  * 
- * @param currentImage Reference to the first image (modified in-place)
- * @param mergeImage Reference to the second image to merge with
+ * @param currentImage Reference to the base image (modified in-place)
+ * @param mergeImage Image blended over it
+ * @param mode Blend mode (normal, multiply, screen or overlay)
+ * @param opacity Strength of the merge image in percent (0-100)
  * 
  * @details The merge operation:
- * - Uses the smaller dimensions of both images
- * - Averages RGB values: new_value = (value1 + value2) / 2
- * - Processes all pixels in the overlapping area
- * - Updates status messages during processing
+ * - Streams row bands of the base through BlendEngine::composite()
+ * - Blends with PointKernels::blend() in fixed point (SIMD where available)
+ * - With the defaults (normal, 50%), averages the two images
+ * - Reports a channel-count mismatch or an empty merge image as a failure
  * 
  * @note This is an immediate operation without progress tracking.
- * @see Image class for pixel access and manipulation
+ * @see BlendEngine::composite() for the blend itself
  */
-void ImageFilters::applyMerge(Image& currentImage, Image& mergeImage)
+void ImageFilters::applyMerge(Image& currentImage, const Image& mergeImage, BlendEngine::Mode mode, int opacity)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Merge filter...");
-    }
-    QApplication::processEvents();
-    
-    int width = std::min(currentImage.width, mergeImage.width);
-    int height = std::min(currentImage.height, mergeImage.height);
+    showStatus("Applying Merge filter...");
     
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int r = (currentImage(x, y, 0) + mergeImage(x, y, 0)) / 2;
-            int g = (currentImage(x, y, 1) + mergeImage(x, y, 1)) / 2;
-            int b = (currentImage(x, y, 2) + mergeImage(x, y, 2)) / 2;
-            currentImage.setPixel(x, y, 0, r);
-            currentImage.setPixel(x, y, 1, g);
-            currentImage.setPixel(x, y, 2, b);
-        }
-    }
-    
-    if (statusBar) {
-        statusBar->showMessage("Merge filter applied");
+    try {
+        // Blended in place, streaming the merge image (scaled per band when the sizes differ)
+        BlendEngine::composite(currentImage.view(), mergeImage.constView(), mode, opacity);
+        
+        showStatus(std::string("Merge filter applied (") + BlendEngine::name(mode) + ", " + std::to_string(opacity) + "%)");
+    } catch (const std::exception& e) {
+        reportFailure(e);
     }
 }
 
@@ -488,996 +486,240 @@ void ImageFilters::applyMerge(Image& currentImage, Image& mergeImage)
  * @throws std::invalid_argument if direction is not "Horizontal" or "Vertical"
  * @see Image class for pixel access and manipulation
  */
-void ImageFilters::applyFlip(Image& currentImage, const QString& direction)
+void ImageFilters::applyFlip(Image& currentImage, const std::string& direction)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Flip filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Flip filter...");
     
     try {
+        ImageView img = currentImage.view();
         if (direction == "Horizontal") {
-        // Horizontal flip
-            for (int y = 0; y < currentImage.height; y++) {
-                for (int x = 0; x < currentImage.width / 2; x++) {
-                    int x2 = currentImage.width - 1 - x;
-                for (int c = 0; c < 3; c++) {
-                        int temp = currentImage(x, y, c);
-                        currentImage.setPixel(x, y, c, currentImage(x2, y, c));
-                        currentImage.setPixel(x2, y, c, temp);
-                }
-            }
-        }
-    } else {
-        // Vertical flip
-            for (int y = 0; y < currentImage.height / 2; y++) {
-                for (int x = 0; x < currentImage.width; x++) {
-                    int y2 = currentImage.height - 1 - y;
-                for (int c = 0; c < 3; c++) {
-                        int temp = currentImage(x, y, c);
-                        currentImage.setPixel(x, y, c, currentImage(x, y2, c));
-                        currentImage.setPixel(x, y2, c, temp);
+            // Horizontal flip: swap pixels from both ends of every row
+            const int channels = img.channels;
+            runRows(img.height, [&](int rowBegin, int rowEnd) {
+                for (int y = rowBegin; y < rowEnd; ++y) {
+                    unsigned char* left = img.row(y);
+                    unsigned char* right = left + (img.width - 1) * channels;
+                    if (channels == 3) {
+                        for (; left < right; left += 3, right -= 3) {
+                            std::swap(left[0], right[0]);
+                            std::swap(left[1], right[1]);
+                            std::swap(left[2], right[2]);
+                        }
+                    } else {
+                        for (; left < right; left += channels, right -= channels) {
+                            std::swap_ranges(left, left + channels, right);
+                        }
                     }
                 }
-            }
+            });
+        } else {
+            // Vertical flip: swap whole rows from top and bottom
+            runRows(img.height / 2, [&](int rowBegin, int rowEnd) {
+                for (int y = rowBegin; y < rowEnd; ++y) {
+                    unsigned char* top = img.row(y);
+                    unsigned char* bottom = img.row(img.height - 1 - y);
+                    std::swap_ranges(top, top + img.rowBytes(), bottom);
+                }
+            });
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Flip filter applied");
-        }
+        showStatus("Flip filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
 void ImageFilters::applyRotate(Image& currentImage, int angleDegrees)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Rotate filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Rotate filter...");
     
     try {
         // Normalize angle to 0-360 range
         angleDegrees = angleDegrees % 360;
         if (angleDegrees < 0) angleDegrees += 360;
         
-        Image tempImage = currentImage;
-        
-        // Optimized paths for common angles
+        // No rotation needed
         if (angleDegrees == 0 || angleDegrees == 360) {
-            // No rotation needed
             return;
-        } else if (angleDegrees == 90) {
-            currentImage = Image(tempImage.height, tempImage.width);
-            for (int y = 0; y < tempImage.height; y++) {
-                for (int x = 0; x < tempImage.width; x++) {
-                    int newX = tempImage.height - 1 - y;
-                    int newY = x;
-                    for (int c = 0; c < 3; c++) {
-                        currentImage.setPixel(newX, newY, c, tempImage(x, y, c));
-                    }
-                }
-            }
-        } else if (angleDegrees == 180) {
-            for (int y = 0; y < currentImage.height / 2; y++) {
-                for (int x = 0; x < currentImage.width; x++) {
-                    int y2 = currentImage.height - 1 - y;
-                    int x2 = currentImage.width - 1 - x;
-                    for (int c = 0; c < 3; c++) {
-                        int temp = currentImage(x, y, c);
-                        currentImage.setPixel(x, y, c, currentImage(x2, y2, c));
-                        currentImage.setPixel(x2, y2, c, temp);
-                    }
-                }
-            }
-        } else if (angleDegrees == 270) {
-            currentImage = Image(tempImage.height, tempImage.width);
-            for (int y = 0; y < tempImage.height; y++) {
-                for (int x = 0; x < tempImage.width; x++) {
-                    int newX = y;
-                    int newY = tempImage.width - 1 - x;
-                    for (int c = 0; c < 3; c++) {
-                        currentImage.setPixel(newX, newY, c, tempImage(x, y, c));
-                    }
-                }
-            }
-        } else {
-            // General rotation for arbitrary angles using rotation matrix
-            double angleRad = angleDegrees * M_PI / 180.0;
-            double cosAngle = std::cos(angleRad);
-            double sinAngle = std::sin(angleRad);
-            
-            // Calculate bounding box of rotated image
-            double centerX = tempImage.width / 2.0;
-            double centerY = tempImage.height / 2.0;
-            
-            // Calculate corners of rotated image
-            double corners[4][2];
-            corners[0][0] = -centerX; corners[0][1] = -centerY;
-            corners[1][0] = tempImage.width - centerX; corners[1][1] = -centerY;
-            corners[2][0] = tempImage.width - centerX; corners[2][1] = tempImage.height - centerY;
-            corners[3][0] = -centerX; corners[3][1] = tempImage.height - centerY;
-            
-            double minX = corners[0][0], maxX = corners[0][0];
-            double minY = corners[0][1], maxY = corners[0][1];
-            
-            for (int i = 0; i < 4; i++) {
-                double rotX = corners[i][0] * cosAngle - corners[i][1] * sinAngle;
-                double rotY = corners[i][0] * sinAngle + corners[i][1] * cosAngle;
-                minX = std::min(minX, rotX);
-                maxX = std::max(maxX, rotX);
-                minY = std::min(minY, rotY);
-                maxY = std::max(maxY, rotY);
-            }
-            
-            int newWidth = static_cast<int>(std::ceil(maxX - minX));
-            int newHeight = static_cast<int>(std::ceil(maxY - minY));
-            
-            // Create new image
-            Image rotatedImage(newWidth, newHeight);
-            
-            // Fill with black background
-            for (int y = 0; y < newHeight; y++) {
-                for (int x = 0; x < newWidth; x++) {
-                    for (int c = 0; c < 3; c++) {
-                        rotatedImage.setPixel(x, y, c, 0);
-                    }
-                }
-            }
-            
-            // Rotate each pixel using inverse rotation (map destination to source)
-            double newCenterX = newWidth / 2.0;
-            double newCenterY = newHeight / 2.0;
-            
-            for (int y = 0; y < newHeight; y++) {
-                for (int x = 0; x < newWidth; x++) {
-                    // Transform coordinates relative to new center
-                    double dx = x - newCenterX;
-                    double dy = y - newCenterY;
-                    
-                    // Apply inverse rotation
-                    double srcX = dx * cosAngle + dy * sinAngle + centerX;
-                    double srcY = -dx * sinAngle + dy * cosAngle + centerY;
-                    
-                    // Bilinear interpolation
-                    int x1 = static_cast<int>(std::floor(srcX));
-                    int y1 = static_cast<int>(std::floor(srcY));
-                    int x2 = x1 + 1;
-                    int y2 = y1 + 1;
-                    
-                    // Check bounds
-                    if (x1 >= 0 && x1 < tempImage.width && y1 >= 0 && y1 < tempImage.height) {
-                        double fx = srcX - x1;
-                        double fy = srcY - y1;
-                        
-                        for (int c = 0; c < 3; c++) {
-                            int p11 = (x1 >= 0 && x1 < tempImage.width && y1 >= 0 && y1 < tempImage.height) 
-                                     ? tempImage(x1, y1, c) : 0;
-                            int p21 = (x2 >= 0 && x2 < tempImage.width && y1 >= 0 && y1 < tempImage.height) 
-                                     ? tempImage(x2, y1, c) : 0;
-                            int p12 = (x1 >= 0 && x1 < tempImage.width && y2 >= 0 && y2 < tempImage.height) 
-                                     ? tempImage(x1, y2, c) : 0;
-                            int p22 = (x2 >= 0 && x2 < tempImage.width && y2 >= 0 && y2 < tempImage.height) 
-                                     ? tempImage(x2, y2, c) : 0;
-                            
-                            double interpolated = p11 * (1 - fx) * (1 - fy) +
-                                                 p21 * fx * (1 - fy) +
-                                                 p12 * (1 - fx) * fy +
-                                                 p22 * fx * fy;
-                            
-                            rotatedImage.setPixel(x, y, c, static_cast<unsigned char>(std::max(0, std::min(255, static_cast<int>(interpolated)))));
-                        }
-                    }
+        }
+        
+        // 180 degrees is an in-place swap and needs no source image
+        if (angleDegrees == 180) {
+            // Reversing the pixel order rotates by 180 degrees: row y swaps with row h - 1 - y, each reversed
+            ImageView img = currentImage.view();
+            const int channels = img.channels;
+            const int pairs = img.empty() ? 0 : (img.height + 1) / 2; // row pairs; an odd height's middle row pairs with itself
+            runRows(pairs, [&](int pairBegin, int pairEnd) {
+                for (int top = pairBegin; top < pairEnd; ++top) {
+                    const int bottom = img.height - 1 - top;
+                    unsigned char* first = img.row(top);
+                    unsigned char* last = img.pixelAt(img.width - 1, bottom);
+                    // The middle row is reversed onto itself, up to its centre
+                    const unsigned char* end = top == bottom ? first + (img.width / 2) * channels
+                                                             : first + static_cast<std::ptrdiff_t>(img.width) * channels;
+                    for (; first < end; first += channels, last -= channels) std::swap_ranges(first, first + channels, last);
                 }
-            }
-            
-            currentImage = rotatedImage;
+            });
+            showStatus("Rotate filter applied");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Rotate filter applied");
+        if (angleDegrees == 90 || angleDegrees == 270) {
+            // Quarter turns move whole pixels: a blocked transpose, no sampling
+            Image rotated(currentImage.height, currentImage.width);
+            WarpEngine::rotate90(currentImage.constView(), rotated.view(), angleDegrees == 90);
+            currentImage = std::move(rotated);
+        } else {
+            // Other angles sample the source bilinearly through a cached coordinate map
+            const std::shared_ptr<const WarpEngine::Map> map =
+                WarpEngine::rotation(currentImage.width, currentImage.height, angleDegrees);
+            Image rotatedImage(map->width, map->height);
+            WarpEngine::apply(*map, currentImage.constView(), rotatedImage.view(), 0); // black corners
+            currentImage = std::move(rotatedImage);
         }
+        
+        showStatus("Rotate filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
-void ImageFilters::applyDarkAndLight(Image& currentImage, const QString& choice)
+void ImageFilters::applyDarkAndLight(Image& currentImage, const std::string& choice)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Dark & Light filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Dark & Light filter...");
     
     try {
-        Image result(currentImage.width, currentImage.height);
-        for (int i = 0; i < currentImage.width; ++i) {
-            for (int j = 0; j < currentImage.height; ++j) {
-                for (int k = 0; k < 3; ++k) {
-                    int p = currentImage(i, j, k);
-                    if (choice == "dark") {
-                    p = p / 3;
-                } else { // light
-                    p = p * 2;
-                    if (p > 255) p = 255;
-                }
-                    result.setPixel(i, j, k, static_cast<unsigned char>(p));
-                }
-            }
-        }
-        currentImage = result;
+        const bool dark = (choice == "dark"); // compare once, not per channel
+        const PointKernels::ChannelMap map = PointKernels::makeChannelMap([dark](int, int p) {
+            return dark ? p / 3 : std::min(255, p * 2);
+        });
+        mapRows(currentImage, map);
         
-        if (statusBar) {
-            statusBar->showMessage("Dark & Light filter applied");
-        }
+        showStatus("Dark & Light filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
-void ImageFilters::applyDarkAndLight(Image& currentImage, const QString& choice, int percent)
+void ImageFilters::applyDarkAndLight(Image& currentImage, const std::string& choice, int percent)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Dark & Light (custom %) filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Dark & Light (custom %) filter...");
 
     percent = std::max(0, std::min(100, percent));
-    const double factor = (choice == "dark")
-        ? std::max(0.0, 1.0 - (percent / 100.0))
-        : (1.0 + (percent / 100.0));
 
     try {
-        Image result(currentImage.width, currentImage.height);
-        for (int i = 0; i < currentImage.width; ++i) {
-            for (int j = 0; j < currentImage.height; ++j) {
-                for (int k = 0; k < 3; ++k) {
-                    int p = currentImage(i, j, k);
-                    double v = p * factor;
-                    if (v < 0.0) v = 0.0;
-                    if (v > 255.0) v = 255.0;
-                    result.setPixel(i, j, k, static_cast<unsigned char>(v));
-                }
-            }
-        }
-        currentImage = result;
+        mapRows(currentImage, FilterPipeline::darkAndLightMap(choice == "dark", percent));
 
-        if (statusBar) {
-            statusBar->showMessage(QString("Dark & Light (%1%, %2) applied")
-                                   .arg(percent)
-                                   .arg(choice));
-        }
+        showStatus("Dark & Light (" + std::to_string(percent) + "%, " + choice + ") applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
+namespace {
+
+/**
+ * @brief Frame color from components clamped to 0-255.
+ */
+FrameEngine::Color frameColor(int r, int g, int b)
+{
+    auto clamp = [](int value) { return static_cast<unsigned char>(std::max(0, std::min(255, value))); };
+    return {clamp(r), clamp(g), clamp(b)};
+}
+
+} // namespace
+
 void ImageFilters::applyFrame(Image& currentImage, int frameWidth, int r, int g, int b)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Custom Frame filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Custom Frame filter...");
     
     try {
-        frameWidth = std::max(1, frameWidth);
-        int newWidth = currentImage.width + 2 * frameWidth;
-        int newHeight = currentImage.height + 2 * frameWidth;
-        Image result(newWidth, newHeight);
+        const FrameEngine::Frame frame = FrameEngine::Frame::custom("Solid Frame", scaledPixels(std::max(1, frameWidth)),
+                                                                    frameColor(r, g, b));
+        Image result(frame.framedWidth(currentImage.width), frame.framedHeight(currentImage.height));
+        FrameEngine::apply(frame, currentImage.constView(), result.view());
+        currentImage = std::move(result);
         
-        // Fill with frame color
-        for (int y = 0; y < newHeight; ++y) {
-            for (int x = 0; x < newWidth; ++x) {
-                result.setPixel(x, y, 0, r);
-                result.setPixel(x, y, 1, g);
-                result.setPixel(x, y, 2, b);
-            }
-        }
-        
-        // Copy original image
-        for (int y = 0; y < currentImage.height; ++y) {
-            for (int x = 0; x < currentImage.width; ++x) {
-                for (int c = 0; c < 3; ++c) {
-                    result.setPixel(x + frameWidth, y + frameWidth, c, currentImage(x, y, c));
-                }
-            }
-        }
-        
-        currentImage = result;
-        
-        if (statusBar) {
-            statusBar->showMessage(QString("Custom Frame filter applied (RGB: %1, %2, %3)").arg(r).arg(g).arg(b));
-        }
+        showStatus("Custom Frame filter applied (RGB: " + rgbText(r, g, b) + ")");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
-void ImageFilters::applyFrame(Image& currentImage, const QString& frameType)
+void ImageFilters::applyFrame(Image& currentImage, const std::string& frameType)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Frame filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Frame filter...");
     
     try {
-        if (frameType == "Simple Frame") {
-        // Simple frame with blue outer and inner white border
-        int frameSize = 10;
-        int innerFrame = 5;
-            Image result(currentImage.width + 2 * frameSize, currentImage.height + 2 * frameSize);
+        // The name is resolved once; the border comes from FrameEngine's cache for repeated sizes
+        const FrameEngine::Frame frame = FrameEngine::Frame::preset(frameType);
+        Image result(frame.framedWidth(currentImage.width), frame.framedHeight(currentImage.height));
+        FrameEngine::apply(frame, currentImage.constView(), result.view());
+        currentImage = std::move(result);
         
-        // Fill with blue frame
-        for (int y = 0; y < result.height; y++) {
-            for (int x = 0; x < result.width; x++) {
-                result.setPixel(x, y, 0, 0);
-                result.setPixel(x, y, 1, 0);
-                result.setPixel(x, y, 2, 255);
-            }
-        }
-        
-        // Copy original image
-            for (int y = 0; y < currentImage.height; y++) {
-                for (int x = 0; x < currentImage.width; x++) {
-                for (int c = 0; c < 3; c++) {
-                        result.setPixel(x + frameSize, y + frameSize, c, currentImage(x, y, c));
-                }
-            }
-        }
-        
-        // Add inner white border
-        int gap = 5;
-            for (int y = frameSize + gap; y < frameSize + currentImage.height - gap; y++) {
-                for (int x = frameSize + gap; x < frameSize + currentImage.width - gap; x++) {
-                bool isWhiteBorder =
-                    (x < frameSize + gap + innerFrame ||
-                         x >= frameSize + currentImage.width - gap - innerFrame ||
-                     y < frameSize + gap + innerFrame ||
-                         y >= frameSize + currentImage.height - gap - innerFrame);
-                if (isWhiteBorder) {
-                    result.setPixel(x, y, 0, 255);
-                    result.setPixel(x, y, 1, 255);
-                    result.setPixel(x, y, 2, 255);
-                }
-            }
-        }
-            currentImage = result;
-    } else if (frameType == "Double Border - White") {
-        // White double border frame
-        int outer = 14; int inner = 6; int gap = 4;
-        int newWidth = currentImage.width + 2 * (outer + inner + gap);
-        int newHeight = currentImage.height + 2 * (outer + inner + gap);
-        Image result(newWidth, newHeight);
-        // Fill with dark background
-        for (int y = 0; y < newHeight; ++y)
-            for (int x = 0; x < newWidth; ++x) {
-                result.setPixel(x, y, 0, 20); result.setPixel(x, y, 1, 20); result.setPixel(x, y, 2, 20);
-            }
-        // Outer white
-        for (int y = 0; y < newHeight; ++y)
-            for (int x = 0; x < newWidth; ++x) {
-                bool border = (x < outer || x >= newWidth - outer || y < outer || y >= newHeight - outer);
-                if (border) { result.setPixel(x, y, 0, 255); result.setPixel(x, y, 1, 255); result.setPixel(x, y, 2, 255); }
-            }
-        // Inner white
-        for (int y = outer + gap; y < newHeight - (outer + gap); ++y)
-            for (int x = outer + gap; x < newWidth - (outer + gap); ++x) {
-                bool border = (x < outer + gap + inner || x >= newWidth - (outer + gap + inner) || y < outer + gap + inner || y >= newHeight - (outer + gap + inner));
-                if (border) { result.setPixel(x, y, 0, 255); result.setPixel(x, y, 1, 255); result.setPixel(x, y, 2, 255); }
-            }
-        // Paste image
-        int ox = outer + gap + inner; int oy = outer + gap + inner;
-        for (int y = 0; y < currentImage.height; ++y)
-            for (int x = 0; x < currentImage.width; ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x + ox, y + oy, c, currentImage(x, y, c));
-        currentImage = result;
-    } else if (frameType == "Solid Frame - Blue" || frameType == "Solid Frame - Red" || frameType == "Solid Frame - Green" || frameType == "Solid Frame - Black" || frameType == "Solid Frame - White") {
-        int frame = 20;
-        int color[3] = {0,0,0};
-        if (frameType.endsWith("Blue")) { color[2] = 255; }
-        else if (frameType.endsWith("Red")) { color[0] = 255; }
-        else if (frameType.endsWith("Green")) { color[1] = 255; }
-        else if (frameType.endsWith("White")) { color[0]=color[1]=color[2]=255; }
-        // Black already default 0
-        Image result(currentImage.width + 2 * frame, currentImage.height + 2 * frame);
-        for (int y = 0; y < result.height; ++y)
-            for (int x = 0; x < result.width; ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x, y, c, color[c]);
-        for (int y = 0; y < currentImage.height; ++y)
-            for (int x = 0; x < currentImage.width; ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x + frame, y + frame, c, currentImage(x, y, c));
-        currentImage = result;
-    } else if (frameType == "Shadow Frame") {
-        int pad = 15; int shadow = 18;
-        int newW = currentImage.width + pad + shadow;
-        int newH = currentImage.height + pad + shadow;
-        Image result(newW, newH);
-        // Base dark
-        for (int y = 0; y < newH; ++y)
-            for (int x = 0; x < newW; ++x) {
-                result.setPixel(x, y, 0, 20); result.setPixel(x, y, 1, 20); result.setPixel(x, y, 2, 20);
-            }
-        // Soft shadow gradient bottom-right
-        for (int y = 0; y < newH; ++y)
-            for (int x = 0; x < newW; ++x) {
-                int dx = std::max(0, x - (pad + currentImage.width));
-                int dy = std::max(0, y - (pad + currentImage.height));
-                int dist = std::max(dx, dy);
-                int shade = std::min(60, dist * 6);
-                int r = 20 + shade, g = 20 + shade, b = 20 + shade;
-                result.setPixel(x, y, 0, r); result.setPixel(x, y, 1, g); result.setPixel(x, y, 2, b);
-            }
-        // Paste image with light top-left highlight border
-        for (int y = 0; y < currentImage.height; ++y)
-            for (int x = 0; x < currentImage.width; ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x + pad, y + pad, c, currentImage(x, y, c));
-        currentImage = result;
-    } else if (frameType == "Gold Decorated Frame") {
-        // Gold style decorative frame
-        int fw = 45;
-        int outer[3] = {180, 140, 40};
-        int inner[3] = {240, 210, 120};
-        int accent[3] = {200, 160, 60};
-        int newW = currentImage.width + 2 * fw;
-        int newH = currentImage.height + 2 * fw;
-        Image result(newW, newH);
-        // Fill outer gold
-        for (int y = 0; y < newH; ++y)
-            for (int x = 0; x < newW; ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x, y, c, outer[c]);
-        // Accent stripes
-        for (int y = 3; y < newH - 3; ++y)
-            for (int x = 3; x < newW - 3; ++x) {
-                bool stripe = ((x + y) % 11 == 0) || ((x - y + 1000) % 13 == 0);
-                if (stripe) for (int c = 0; c < 3; ++c) result.setPixel(x, y, c, accent[c]);
-            }
-        // Inner plate
-        for (int y = fw - 6; y < newH - (fw - 6); ++y)
-            for (int x = fw - 6; x < newW - (fw - 6); ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x, y, c, inner[c]);
-        // Paste image
-        for (int y = 0; y < currentImage.height; ++y)
-            for (int x = 0; x < currentImage.width; ++x)
-                for (int c = 0; c < 3; ++c)
-                    result.setPixel(x + fw, y + fw, c, currentImage(x, y, c));
-        currentImage = result;
-    } else {
-        // Existing decorated frame (brown/beige) as fallback
-        // Decorated frame with brown/beige design and accent patterns
-        int frameWidth = 25;
-        int outerColor[3] = {100, 70, 50};
-        int innerColor[3] = {235, 225, 210};
-        int accentColor[3] = {180, 140, 80};
-        
-            int originalWidth = currentImage.width;
-            int originalHeight = currentImage.height;
-        int newWidth = originalWidth + 2 * frameWidth;
-        int newHeight = originalHeight + 2 * frameWidth;
-        
-        Image result(newWidth, newHeight);
-        
-        // Copy original image
-        for (int y = 0; y < originalHeight; y++) {
-            for (int x = 0; x < originalWidth; x++) {
-                for (int c = 0; c < 3; c++) {
-                        result.setPixel(x + frameWidth, y + frameWidth, c, currentImage(x, y, c));
-                }
-            }
-        }
-        
-        // Create decorated frame
-        for (int y = 0; y < newHeight; y++) {
-            for (int x = 0; x < newWidth; x++) {
-                if (x < frameWidth || x >= newWidth - frameWidth ||
-                    y < frameWidth || y >= newHeight - frameWidth) {
-                    
-                    int distFromEdge = std::min({x, y, newWidth - 1 - x, newHeight - 1 - y});
-                    
-                    if (distFromEdge < 3) {
-                        for (int c = 0; c < 3; c++) {
-                            result.setPixel(x, y, c, outerColor[c]);
-                        }
-                    }
-                    else if (distFromEdge == 12 || distFromEdge == 15 || distFromEdge == 9) {
-                        for (int c = 0; c < 3; c++) {
-                            result.setPixel(x, y, c, accentColor[c]);
-                        }
-                    }
-                    else if (distFromEdge < frameWidth - 4) {
-                        for (int c = 0; c < 3; c++) {
-                            result.setPixel(x, y, c, innerColor[c]);
-                        }
-                        
-                        int cornerDist = std::min(std::min(x, newWidth - 1 - x),
-                                                 std::min(y, newHeight - 1 - y));
-                        
-                        if (cornerDist < frameWidth) {
-                            if ((x + y) % 12 == 0) {
-                                for (int c = 0; c < 3; c++) {
-                                    result.setPixel(x, y, c, accentColor[c]);
-                                }
-                            }
-                        }
-                    }
-                    else if (distFromEdge >= frameWidth - 4 && distFromEdge < frameWidth - 1) {
-                        for (int c = 0; c < 3; c++) {
-                            result.setPixel(x, y, c, accentColor[c]);
-                        }
-                    }
-                    else {
-                        for (int c = 0; c < 3; c++) {
-                            result.setPixel(x, y, c, outerColor[c]);
-                        }
-                    }
-                }
-            }
-        }
-            currentImage = result;
-        }
-        
-        if (statusBar) {
-            statusBar->showMessage("Frame filter applied");
-        }
+        showStatus("Frame filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
-void ImageFilters::applyFrame(Image& currentImage, const QString& frameType, int frameWidth, int r, int g, int b)
+void ImageFilters::applyFrame(Image& currentImage, const std::string& frameType, int frameWidth, int r, int g, int b)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Custom Colored Frame filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Custom Colored Frame filter...");
     
     try {
         // Clamp and validate inputs
         r = std::max(0, std::min(255, r));
         g = std::max(0, std::min(255, g));
         b = std::max(0, std::min(255, b));
-        frameWidth = std::max(1, frameWidth);
+        frameWidth = scaledPixels(std::max(1, frameWidth));
         
-        if (frameType == "Solid Frame") {
-            // Simple solid colored frame
-            int newWidth = currentImage.width + 2 * frameWidth;
-            int newHeight = currentImage.height + 2 * frameWidth;
-            Image result(newWidth, newHeight);
-            
-            // Fill with frame color
-            for (int y = 0; y < newHeight; ++y) {
-                for (int x = 0; x < newWidth; ++x) {
-                    result.setPixel(x, y, 0, r);
-                    result.setPixel(x, y, 1, g);
-                    result.setPixel(x, y, 2, b);
-                }
-            }
-            
-            // Copy original image
-            for (int y = 0; y < currentImage.height; ++y) {
-                for (int x = 0; x < currentImage.width; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        result.setPixel(x + frameWidth, y + frameWidth, c, currentImage(x, y, c));
-                    }
-                }
-            }
-            currentImage = result;
-        } else if (frameType == "Simple Frame") {
-            // Simple frame with colored outer and white inner border
-            int innerFrame = frameWidth / 2;
-            Image result(currentImage.width + 2 * frameWidth, currentImage.height + 2 * frameWidth);
-            
-            // Fill with frame color
-            for (int y = 0; y < result.height; y++) {
-                for (int x = 0; x < result.width; x++) {
-                    result.setPixel(x, y, 0, r);
-                    result.setPixel(x, y, 1, g);
-                    result.setPixel(x, y, 2, b);
-                }
-            }
-            
-            // Copy original image
-            for (int y = 0; y < currentImage.height; y++) {
-                for (int x = 0; x < currentImage.width; x++) {
-                    for (int c = 0; c < 3; c++) {
-                        result.setPixel(x + frameWidth, y + frameWidth, c, currentImage(x, y, c));
-                    }
-                }
-            }
-            
-            // Add inner white border
-            int gap = 3;
-            for (int y = frameWidth + gap; y < frameWidth + currentImage.height - gap; y++) {
-                for (int x = frameWidth + gap; x < frameWidth + currentImage.width - gap; x++) {
-                    bool isWhiteBorder =
-                        (x < frameWidth + gap + innerFrame ||
-                         x >= frameWidth + currentImage.width - gap - innerFrame ||
-                         y < frameWidth + gap + innerFrame ||
-                         y >= frameWidth + currentImage.height - gap - innerFrame);
-                    if (isWhiteBorder) {
-                        result.setPixel(x, y, 0, 255);
-                        result.setPixel(x, y, 1, 255);
-                        result.setPixel(x, y, 2, 255);
-                    }
-                }
-            }
-            currentImage = result;
-        } else if (frameType == "Double Border") {
-            // Double border with custom color
-            int outer = frameWidth * 2;
-            int inner = frameWidth;
-            int gap = frameWidth / 2;
-            int newWidth = currentImage.width + 2 * (outer + inner + gap);
-            int newHeight = currentImage.height + 2 * (outer + inner + gap);
-            Image result(newWidth, newHeight);
-            
-            // Fill with dark background
-            int bgR = r / 4, bgG = g / 4, bgB = b / 4;
-            for (int y = 0; y < newHeight; ++y) {
-                for (int x = 0; x < newWidth; ++x) {
-                    result.setPixel(x, y, 0, bgR);
-                    result.setPixel(x, y, 1, bgG);
-                    result.setPixel(x, y, 2, bgB);
-                }
-            }
-            
-            // Outer border
-            for (int y = 0; y < newHeight; ++y) {
-                for (int x = 0; x < newWidth; ++x) {
-                    bool border = (x < outer || x >= newWidth - outer || y < outer || y >= newHeight - outer);
-                    if (border) {
-                        result.setPixel(x, y, 0, r);
-                        result.setPixel(x, y, 1, g);
-                        result.setPixel(x, y, 2, b);
-                    }
-                }
-            }
-            
-            // Inner border
-            for (int y = outer + gap; y < newHeight - (outer + gap); ++y) {
-                for (int x = outer + gap; x < newWidth - (outer + gap); ++x) {
-                    bool border = (x < outer + gap + inner || x >= newWidth - (outer + gap + inner) ||
-                                 y < outer + gap + inner || y >= newHeight - (outer + gap + inner));
-                    if (border) {
-                        result.setPixel(x, y, 0, r);
-                        result.setPixel(x, y, 1, g);
-                        result.setPixel(x, y, 2, b);
-                    }
-                }
-            }
-            
-            // Paste image
-            int ox = outer + gap + inner;
-            int oy = outer + gap + inner;
-            for (int y = 0; y < currentImage.height; ++y) {
-                for (int x = 0; x < currentImage.width; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        result.setPixel(x + ox, y + oy, c, currentImage(x, y, c));
-                    }
-                }
-            }
-            currentImage = result;
-        } else if (frameType == "Shadow Frame") {
-            // Shadow frame with custom color
-            int pad = frameWidth;
-            int shadow = frameWidth * 2;
-            int newW = currentImage.width + pad + shadow;
-            int newH = currentImage.height + pad + shadow;
-            Image result(newW, newH);
-            
-            // Base dark
-            int bgR = r / 8, bgG = g / 8, bgB = b / 8;
-            for (int y = 0; y < newH; ++y) {
-                for (int x = 0; x < newW; ++x) {
-                    result.setPixel(x, y, 0, bgR);
-                    result.setPixel(x, y, 1, bgG);
-                    result.setPixel(x, y, 2, bgB);
-                }
-            }
-            
-            // Soft shadow gradient
-            for (int y = 0; y < newH; ++y) {
-                for (int x = 0; x < newW; ++x) {
-                    int dx = std::max(0, x - (pad + currentImage.width));
-                    int dy = std::max(0, y - (pad + currentImage.height));
-                    int dist = std::max(dx, dy);
-                    int shade = std::min(100, dist * 4);
-                    int shadeR = bgR + (r * shade / 100);
-                    int shadeG = bgG + (g * shade / 100);
-                    int shadeB = bgB + (b * shade / 100);
-                    result.setPixel(x, y, 0, std::min(255, shadeR));
-                    result.setPixel(x, y, 1, std::min(255, shadeG));
-                    result.setPixel(x, y, 2, std::min(255, shadeB));
-                }
-            }
-            
-            // Paste image
-            for (int y = 0; y < currentImage.height; ++y) {
-                for (int x = 0; x < currentImage.width; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        result.setPixel(x + pad, y + pad, c, currentImage(x, y, c));
-                    }
-                }
-            }
-            currentImage = result;
-        } else if (frameType == "Gold Decorated Frame") {
-            // Gold style frame with custom color
-            int fw = frameWidth * 2;
-            int outer[3] = {static_cast<int>(r * 0.7), static_cast<int>(g * 0.55), static_cast<int>(b * 0.16)};
-            int inner[3] = {static_cast<int>(r * 0.94), static_cast<int>(g * 0.82), static_cast<int>(b * 0.47)};
-            int accent[3] = {static_cast<int>(r * 0.78), static_cast<int>(g * 0.63), static_cast<int>(b * 0.24)};
-            int newW = currentImage.width + 2 * fw;
-            int newH = currentImage.height + 2 * fw;
-            Image result(newW, newH);
-            
-            // Fill outer
-            for (int y = 0; y < newH; ++y) {
-                for (int x = 0; x < newW; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        result.setPixel(x, y, c, outer[c]);
-                    }
-                }
-            }
-            
-            // Accent stripes
-            for (int y = 3; y < newH - 3; ++y) {
-                for (int x = 3; x < newW - 3; ++x) {
-                    bool stripe = ((x + y) % 11 == 0) || ((x - y + 1000) % 13 == 0);
-                    if (stripe) {
-                        for (int c = 0; c < 3; ++c) {
-                            result.setPixel(x, y, c, accent[c]);
-                        }
-                    }
-                }
-            }
-            
-            // Inner plate
-            for (int y = fw - 6; y < newH - (fw - 6); ++y) {
-                for (int x = fw - 6; x < newW - (fw - 6); ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        result.setPixel(x, y, c, inner[c]);
-                    }
-                }
-            }
-            
-            // Paste image
-            for (int y = 0; y < currentImage.height; ++y) {
-                for (int x = 0; x < currentImage.width; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        result.setPixel(x + fw, y + fw, c, currentImage(x, y, c));
-                    }
-                }
-            }
-            currentImage = result;
-        } else {
-            // Decorated Frame (default decorative style with custom colors)
-            int fw = std::max(1, frameWidth);
-            int outerColor[3] = {static_cast<int>(r * 0.39), static_cast<int>(g * 0.27), static_cast<int>(b * 0.20)};
-            int innerColor[3] = {static_cast<int>(r * 0.92), static_cast<int>(g * 0.88), static_cast<int>(b * 0.82)};
-            int accentColor[3] = {static_cast<int>(r * 0.71), static_cast<int>(g * 0.55), static_cast<int>(b * 0.31)};
-            
-            int originalWidth = currentImage.width;
-            int originalHeight = currentImage.height;
-            int newWidth = originalWidth + 2 * fw;
-            int newHeight = originalHeight + 2 * fw;
-            
-            Image result(newWidth, newHeight);
-            
-            // Copy original image
-            for (int y = 0; y < originalHeight; y++) {
-                for (int x = 0; x < originalWidth; x++) {
-                    for (int c = 0; c < 3; c++) {
-                        result.setPixel(x + fw, y + fw, c, currentImage(x, y, c));
-                    }
-                }
-            }
-            
-            // Create decorated frame
-            for (int y = 0; y < newHeight; y++) {
-                for (int x = 0; x < newWidth; x++) {
-                    if (x < fw || x >= newWidth - fw ||
-                        y < fw || y >= newHeight - fw) {
-                        
-                        int distFromEdge = std::min({x, y, newWidth - 1 - x, newHeight - 1 - y});
-                        
-                        if (distFromEdge < 3) {
-                            for (int c = 0; c < 3; c++) {
-                                result.setPixel(x, y, c, outerColor[c]);
-                            }
-                        } else if (distFromEdge == 12 || distFromEdge == 15 || distFromEdge == 9) {
-                            for (int c = 0; c < 3; c++) {
-                                result.setPixel(x, y, c, accentColor[c]);
-                            }
-                        } else if (distFromEdge < fw - 4) {
-                            for (int c = 0; c < 3; c++) {
-                                result.setPixel(x, y, c, innerColor[c]);
-                            }
-                            
-                            int cornerDist = std::min(std::min(x, newWidth - 1 - x),
-                                                     std::min(y, newHeight - 1 - y));
-                            
-                            if (cornerDist < fw) {
-                                if ((x + y) % 12 == 0) {
-                                    for (int c = 0; c < 3; c++) {
-                                        result.setPixel(x, y, c, accentColor[c]);
-                                    }
-                                }
-                            }
-                        } else if (distFromEdge >= fw - 4 && distFromEdge < fw - 1) {
-                            for (int c = 0; c < 3; c++) {
-                                result.setPixel(x, y, c, accentColor[c]);
-                            }
-                        } else {
-                            for (int c = 0; c < 3; c++) {
-                                result.setPixel(x, y, c, outerColor[c]);
-                            }
-                        }
-                    }
-                }
-            }
-            currentImage = result;
-        }
+        const FrameEngine::Frame frame = FrameEngine::Frame::custom(frameType, frameWidth,
+                                                                    frameColor(r, g, b));
+        Image result(frame.framedWidth(currentImage.width), frame.framedHeight(currentImage.height));
+        FrameEngine::apply(frame, currentImage.constView(), result.view());
+        currentImage = std::move(result);
         
-        if (statusBar) {
-            statusBar->showMessage(QString("Custom Colored Frame applied (%1, RGB: %2, %3, %4)").arg(frameType).arg(r).arg(g).arg(b));
-        }
+        showStatus("Custom Colored Frame applied (" + frameType + ", RGB: " + rgbText(r, g, b) + ")");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
-void ImageFilters::applyEdges(Image& currentImage)
+void ImageFilters::applyEdges(Image& currentImage, EdgeEngine::Output output, int threshold)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Edge Detection filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Edge Detection filter...");
     
     try {
-    // Convert to grayscale first
-        Image gray(currentImage.width, currentImage.height);
-        for (int y = 0; y < currentImage.height; y++) {
-            for (int x = 0; x < currentImage.width; x++) {
-                int r = currentImage(x, y, 0);
-                int g = currentImage(x, y, 1);
-                int b = currentImage(x, y, 2);
-            // Use weighted average for better grayscale conversion
-            int grayVal = (int)(0.299 * r + 0.587 * g + 0.114 * b);
-            gray.setPixel(x, y, 0, grayVal);
-            gray.setPixel(x, y, 1, grayVal);
-            gray.setPixel(x, y, 2, grayVal);
-        }
-    }
-
-    // Apply Gaussian blur to reduce noise
-        Image blurred(currentImage.width, currentImage.height);
-    int kernel[5][5] = {
-        {1, 4, 6, 4, 1},
-        {4, 16, 24, 16, 4},
-        {6, 24, 36, 24, 6},
-        {4, 16, 24, 16, 4},
-        {1, 4, 6, 4, 1}
-    };
-    int kernelSum = 256; // Sum of all kernel values
-
-        for (int y = 2; y < currentImage.height - 2; y++) {
-            for (int x = 2; x < currentImage.width - 2; x++) {
-            int sum = 0;
-            for (int ky = -2; ky <= 2; ky++) {
-                for (int kx = -2; kx <= 2; kx++) {
-                    sum += gray(x + kx, y + ky, 0) * kernel[ky + 2][kx + 2];
-                }
-            }
-            int blurredVal = sum / kernelSum;
-            blurred.setPixel(x, y, 0, blurredVal);
-            blurred.setPixel(x, y, 1, blurredVal);
-            blurred.setPixel(x, y, 2, blurredVal);
-        }
-    }
-
-    // Apply Sobel edge detection
         Image edge(currentImage.width, currentImage.height);
-    
-    // Sobel kernels
-    int sobelX[3][3] = {{-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1}};
-    int sobelY[3][3] = {{-1, -2, -1}, {0, 0, 0}, {1, 2, 1}};
-
-        for (int y = 1; y < currentImage.height - 1; y++) {
-            for (int x = 1; x < currentImage.width - 1; x++) {
-            int gx = 0, gy = 0;
-            
-            // Apply Sobel kernels
-            for (int ky = -1; ky <= 1; ky++) {
-                for (int kx = -1; kx <= 1; kx++) {
-                    int pixelVal = blurred(x + kx, y + ky, 0);
-                    gx += pixelVal * sobelX[ky + 1][kx + 1];
-                    gy += pixelVal * sobelY[ky + 1][kx + 1];
-                }
-            }
-            
-            // Calculate gradient magnitude
-            int magnitude = (int)std::sqrt(gx * gx + gy * gy);
-            
-            // Clamp to 0-255 range
-            magnitude = std::min(255, std::max(0, magnitude));
-            
-            // Apply threshold to enhance edges (white edges on black background)
-            int edgeVal = (magnitude > 50) ? 0 : 255;
-            
-            edge.setPixel(x, y, 0, edgeVal);
-            edge.setPixel(x, y, 1, edgeVal);
-            edge.setPixel(x, y, 2, edgeVal);
-        }
-    }
-    
-        currentImage = edge;
+        EdgeEngine::sobel(currentImage.constView(), edge.view(), output, threshold);
+        currentImage = std::move(edge);
         
-        if (statusBar) {
-            statusBar->showMessage("Edge Detection filter applied");
-        }
+        showStatus("Edge Detection filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
-void ImageFilters::applyResize(Image& currentImage, int width, int height)
+void ImageFilters::applyResize(Image& currentImage, int width, int height, Resampler::Filter filter)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Resize filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Resize filter...");
     
     try {
-        Image result(width, height);
-        
-        double xRatio = (double)currentImage.width / width;
-        double yRatio = (double)currentImage.height / height;
-        
-        for (int y = 0; y < height; y++) {
-            for (int x = 0; x < width; x++) {
-                int srcX = (int)(x * xRatio);
-                int srcY = (int)(y * yRatio);
-                
-                srcX = std::min(srcX, (int)currentImage.width - 1);
-                srcY = std::min(srcY, (int)currentImage.height - 1);
-                
-                result.setPixel(x, y, 0, currentImage(srcX, srcY, 0));
-                result.setPixel(x, y, 1, currentImage(srcX, srcY, 1));
-                result.setPixel(x, y, 2, currentImage(srcX, srcY, 2));
+        const PixelFormat format = currentImage.format();
+        Image result(width, height, format);
+        if (format.isPlanar()) {
+            for (int c = 0; c < format.channels; ++c) {
+                Resampler::resize(currentImage.constPlaneView(c), result.planeView(c), filter);
             }
+        } else {
+            Resampler::resize(currentImage.constView(), result.view(), filter);
         }
+        currentImage = std::move(result);
         
-        currentImage = result;
-        
-        if (statusBar) {
-            statusBar->showMessage(QString("Resize filter applied (%1x%2)").arg(width).arg(height));
-        }
+        showStatus("Resize filter applied (" + std::to_string(width) + "x" + std::to_string(height) + ")");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
@@ -1488,363 +730,199 @@ void ImageFilters::applyResize(Image& currentImage, int width, int height)
  */
 void ImageFilters::applySkew(Image& currentImage, double angleDegrees)
 {
-    if (statusBar) {
-        statusBar->showMessage("Applying Skew filter...");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Skew filter...");
 
     try {
-        const double angleRad = angleDegrees * M_PI / 180.0;
-        const double tanA = std::tan(angleRad);
-
-        // Compute horizontal shift range over all rows
-        int minShift = 0;
-        int maxShift = 0;
-        if (currentImage.height > 0) {
-            int shiftTop = static_cast<int>(std::floor(tanA * 0));
-            int shiftBottom = static_cast<int>(std::floor(tanA * (currentImage.height - 1)));
-            minShift = std::min(shiftTop, shiftBottom);
-            maxShift = std::max(shiftTop, shiftBottom);
-        }
+        // Each row shifts by a sub-pixel amount, so the edges are interpolated, not stepped
+        const std::shared_ptr<const WarpEngine::Map> map =
+            WarpEngine::skew(currentImage.width, currentImage.height, angleDegrees);
+        Image skewed(map->width, map->height);
+        WarpEngine::apply(*map, currentImage.constView(), skewed.view(), 255); // white background
 
-        const int newWidth = std::max(1, (int)currentImage.width + (maxShift - minShift));
-        const int newHeight = currentImage.height;
-
-        Image skewed(newWidth, newHeight);
-        // Fill background white
-        for (int y = 0; y < newHeight; ++y) {
-            for (int x = 0; x < newWidth; ++x) {
-                skewed.setPixel(x, y, 0, 255);
-                skewed.setPixel(x, y, 1, 255);
-                skewed.setPixel(x, y, 2, 255);
-            }
-        }
-
-        // Copy pixels with per-row shift, offset to keep within bounds
-        for (int y = 0; y < currentImage.height; ++y) {
-            int shift = static_cast<int>(std::floor(tanA * y));
-            int base = shift - minShift; // normalize so min lands at 0
-            for (int x = 0; x < currentImage.width; ++x) {
-                int nx = x + base;
-                if (nx >= 0 && nx < newWidth) {
-                    for (int c = 0; c < 3; ++c) {
-                        skewed.setPixel(nx, y, c, currentImage(x, y, c));
-                    }
-                }
-            }
-        }
-
-        currentImage = skewed;
-        if (statusBar) {
-            statusBar->showMessage(QString("Skew filter applied (%1°)").arg(angleDegrees));
-        }
+        currentImage = std::move(skewed);
+        showStatus("Skew filter applied (" + std::to_string(angleDegrees) + "°)");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
 }
 
 void ImageFilters::applyEmboss(Image& currentImage)
 {
-    if (statusBar) statusBar->showMessage("Applying Emboss...");
-    QApplication::processEvents();
+    showStatus("Applying Emboss...");
     Image embossed(currentImage.width, currentImage.height);
-    for (int y = 0; y < currentImage.height - 1; y++) {
-        for (int x = 0; x < currentImage.width - 1; x++) {
-            int r1 = currentImage(x, y, 0);
-            int g1 = currentImage(x, y, 1);
-            int b1 = currentImage(x, y, 2);
-            int r2 = currentImage(x + 1, y + 1, 0);
-            int g2 = currentImage(x + 1, y + 1, 1);
-            int b2 = currentImage(x + 1, y + 1, 2);
-            int diffR = std::clamp(r1 - r2 + 128, 0, 255);
-            int diffG = std::clamp(g1 - g2 + 128, 0, 255);
-            int diffB = std::clamp(b1 - b2 + 128, 0, 255);
-            int gray = (diffR + diffG + diffB) / 3;
-            for (int c = 0; c < 3; ++c) embossed.setPixel(x, y, c, gray);
-        }
-    }
-    currentImage = embossed;
-    if (statusBar) statusBar->showMessage("Emboss applied");
+    EdgeEngine::emboss(currentImage.constView(), embossed.view());
+    currentImage = std::move(embossed);
+    showStatus("Emboss applied");
 }
 
 void ImageFilters::applyEmboss(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) { progressBar->setVisible(true); progressBar->setRange(0, currentImage.height); progressBar->setValue(0); }
-    if (statusBar) statusBar->showMessage("Applying Emboss... (Click Cancel to stop)");
-    QApplication::processEvents();
+    beginProgress(currentImage.height);
+    showStatus("Applying Emboss... (Click Cancel to stop)");
     Image embossed(currentImage.width, currentImage.height);
-    for (int y = 0; y < currentImage.height - 1; y++) {
-        if (cancelRequested) { checkCancellation(cancelRequested, currentImage, preFilterImage, "Emboss"); return; }
-        for (int x = 0; x < currentImage.width - 1; x++) {
-            int r1 = currentImage(x, y, 0);
-            int g1 = currentImage(x, y, 1);
-            int b1 = currentImage(x, y, 2);
-            int r2 = currentImage(x + 1, y + 1, 0);
-            int g2 = currentImage(x + 1, y + 1, 1);
-            int b2 = currentImage(x + 1, y + 1, 2);
-            int diffR = std::clamp(r1 - r2 + 128, 0, 255);
-            int diffG = std::clamp(g1 - g2 + 128, 0, 255);
-            int diffB = std::clamp(b1 - b2 + 128, 0, 255);
-            int gray = (diffR + diffG + diffB) / 3;
-            for (int c = 0; c < 3; ++c) embossed.setPixel(x, y, c, gray);
-        }
-        updateProgress(y + 1, currentImage.height, 20);
+    bool completed = EdgeEngine::emboss(currentImage.constView(), embossed.view(), &cancelRequested,
+                                        [&](int done, int total) { updateProgress(done, total, 1); });
+    if (!completed) {
+        checkCancellation(cancelRequested, currentImage, preFilterImage, "Emboss");
+        return;
+    }
+    currentImage = std::move(embossed);
+    showStatus("Emboss applied");
+    endProgress();
+}
+
+namespace {
+
+using DoubleVisionKernel = Stencil::Kernel<6, 4>; // Tenths: 0.6 x the pixel + 0.4 x the one `offset` to its right
+
+/**
+ * @brief Double vision of rows [rowBegin, rowEnd), red brightened by 25.
+ *
+ * Pixels whose shifted neighbour exists read it straight from the row; the
+ * last `offset` pixels read a copy of the final pixel instead, so neither
+ * loop checks bounds.
+ */
+void doubleVisionRows(const ConstImageView& src, const ImageView& dst, int offset,
+                      const PointKernels::ChannelMap& redBoost, int rowBegin, int rowEnd)
+{
+    const int width = src.width;
+    const int inside = std::max(0, width - offset);
+    const std::size_t insideBytes = static_cast<std::size_t>(inside) * 3;
+    std::vector<unsigned char> edge(static_cast<std::size_t>(width - inside) * 3);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const unsigned char* s = src.row(y);
+        unsigned char* d = dst.row(y);
+        if (inside > 0) {
+            const unsigned char* const rows[2] = {s, s + static_cast<std::size_t>(offset) * 3};
+            Stencil::columnsToBytes<DoubleVisionKernel, 10>(rows, static_cast<int>(insideBytes), d);
+        }
+        const unsigned char* last = s + static_cast<std::size_t>(width - 1) * 3;
+        for (std::size_t i = 0; i < edge.size(); i += 3) std::memcpy(edge.data() + i, last, 3);
+        const unsigned char* const rows[2] = {s + insideBytes, edge.data()};
+        Stencil::columnsToBytes<DoubleVisionKernel, 10>(rows, static_cast<int>(edge.size()), d + insideBytes);
+        PointKernels::mapChannels(d, d, width, redBoost);
     }
-    currentImage = embossed;
-    if (statusBar) statusBar->showMessage("Emboss applied");
-    if (progressBar) progressBar->setVisible(false);
 }
 
+PointKernels::ChannelMap doubleVisionRedBoost()
+{
+    return PointKernels::makeChannelMap([](int channel, int value) { return channel == 0 ? value + 25 : value; });
+}
+
+} // namespace
+
 void ImageFilters::applyDoubleVision(Image& currentImage, int offset)
 {
-    if (statusBar) statusBar->showMessage("Applying Double Vision...");
-    QApplication::processEvents();
+    showStatus("Applying Double Vision...");
     offset = std::max(0, offset);
     Image out(currentImage.width, currentImage.height);
-    for (int y = 0; y < currentImage.height; ++y) {
-        for (int x = 0; x < currentImage.width; ++x) {
-            int nx = x + offset;
-            if (nx >= currentImage.width) nx = currentImage.width - 1;
-            int R1 = currentImage(x, y, 0);
-            int G1 = currentImage(x, y, 1);
-            int B1 = currentImage(x, y, 2);
-            int R2 = currentImage(nx, y, 0);
-            int G2 = currentImage(nx, y, 1);
-            int B2 = currentImage(nx, y, 2);
-            int R = std::min(255, int(R1 * 0.6 + R2 * 0.4) + 25);
-            int G = int(G1 * 0.6 + G2 * 0.4);
-            int B = int(B1 * 0.6 + B2 * 0.4);
-            out.setPixel(x, y, 0, R);
-            out.setPixel(x, y, 1, G);
-            out.setPixel(x, y, 2, B);
-        }
-    }
-    currentImage = out;
-    if (statusBar) statusBar->showMessage("Double Vision applied");
+    ConstImageView src = currentImage.constView();
+    ImageView dst = out.view();
+    const PointKernels::ChannelMap redBoost = doubleVisionRedBoost();
+    runRows(src.height, [&](int rowBegin, int rowEnd) {
+        doubleVisionRows(src, dst, offset, redBoost, rowBegin, rowEnd);
+    });
+    currentImage = std::move(out);
+    showStatus("Double Vision applied");
 }
 
 void ImageFilters::applyDoubleVision(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int offset)
 {
-    if (progressBar) { progressBar->setVisible(true); progressBar->setRange(0, currentImage.height); progressBar->setValue(0); }
-    if (statusBar) statusBar->showMessage("Applying Double Vision... (Click Cancel to stop)");
-    QApplication::processEvents();
+    beginProgress(currentImage.height);
+    showStatus("Applying Double Vision... (Click Cancel to stop)");
     offset = std::max(0, offset);
     Image out(currentImage.width, currentImage.height);
-    for (int y = 0; y < currentImage.height; ++y) {
-        if (cancelRequested) { checkCancellation(cancelRequested, currentImage, preFilterImage, "Double Vision"); return; }
-        for (int x = 0; x < currentImage.width; ++x) {
-            int nx = x + offset;
-            if (nx >= currentImage.width) nx = currentImage.width - 1;
-            int R1 = currentImage(x, y, 0);
-            int G1 = currentImage(x, y, 1);
-            int B1 = currentImage(x, y, 2);
-            int R2 = currentImage(nx, y, 0);
-            int G2 = currentImage(nx, y, 1);
-            int B2 = currentImage(nx, y, 2);
-            int R = std::min(255, int(R1 * 0.6 + R2 * 0.4) + 25);
-            int G = int(G1 * 0.6 + G2 * 0.4);
-            int B = int(B1 * 0.6 + B2 * 0.4);
-            out.setPixel(x, y, 0, R);
-            out.setPixel(x, y, 1, G);
-            out.setPixel(x, y, 2, B);
-        }
-        updateProgress(y + 1, currentImage.height, 20);
-    }
-    currentImage = out;
-    if (statusBar) statusBar->showMessage("Double Vision applied");
-    if (progressBar) progressBar->setVisible(false);
+    ConstImageView src = currentImage.constView();
+    ImageView dst = out.view();
+    const PointKernels::ChannelMap redBoost = doubleVisionRedBoost();
+    bool completed = runRows(src.height, [&](int rowBegin, int rowEnd) {
+        doubleVisionRows(src, dst, offset, redBoost, rowBegin, rowEnd);
+    }, &cancelRequested);
+    if (!completed) {
+        checkCancellation(cancelRequested, currentImage, preFilterImage, "Double Vision");
+        return;
+    }
+    currentImage = std::move(out);
+    showStatus("Double Vision applied");
+    endProgress();
 }
 
 void ImageFilters::applyOilPainting(Image& currentImage, int radius, int intensity)
 {
-    if (statusBar) statusBar->showMessage("Applying Oil Painting...");
-    QApplication::processEvents();
-    radius = std::max(1, radius);
-    intensity = std::max(1, std::min(255, intensity));
+    showStatus("Applying Oil Painting...");
     Image result(currentImage.width, currentImage.height);
-    for (int i = 0; i < currentImage.width; ++i) {
-        for (int j = 0; j < currentImage.height; ++j) {
-            int colorCount[256] = {0};
-            int redSum[256] = {0};
-            int greenSum[256] = {0};
-            int blueSum[256] = {0};
-            for (int dy = -radius; dy <= radius; ++dy) {
-                for (int dx = -radius; dx <= radius; ++dx) {
-                    int nx = i + dx, ny = j + dy;
-                    if (nx >= 0 && nx < currentImage.width && ny >= 0 && ny < currentImage.height) {
-                        int r = currentImage(nx, ny, 0);
-                        int g = currentImage(nx, ny, 1);
-                        int b = currentImage(nx, ny, 2);
-                        int avg = (r + g + b) / 3;
-                        int level = std::min(255, std::max(0, avg / std::max(1, intensity)));
-                        colorCount[level]++;
-                        redSum[level] += r;
-                        greenSum[level] += g;
-                        blueSum[level] += b;
-                    }
-                }
-            }
-            int maxCount = 0, maxLevel = 0;
-            for (int k = 0; k < 256; ++k) if (colorCount[k] > maxCount) { maxCount = colorCount[k]; maxLevel = k; }
-            int denom = std::max(1, colorCount[maxLevel]);
-            result.setPixel(i, j, 0, redSum[maxLevel] / denom);
-            result.setPixel(i, j, 1, greenSum[maxLevel] / denom);
-            result.setPixel(i, j, 2, blueSum[maxLevel] / denom);
-        }
-    }
-    currentImage = result;
-    if (statusBar) statusBar->showMessage("Oil Painting applied");
+    // Sliding histograms: cost per pixel does not depend on the radius
+    OilPaintEngine::apply(currentImage.constView(), result.view(), radius, intensity);
+    currentImage = std::move(result);
+    showStatus("Oil Painting applied");
 }
 
 void ImageFilters::applyOilPainting(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int radius, int intensity)
 {
-    if (progressBar) { progressBar->setVisible(true); progressBar->setRange(0, currentImage.height); progressBar->setValue(0); }
-    if (statusBar) statusBar->showMessage("Applying Oil Painting... (Click Cancel to stop)");
-    QApplication::processEvents();
-    radius = std::max(1, radius);
-    intensity = std::max(1, std::min(255, intensity));
-    Image result(currentImage.width, currentImage.height);
-    for (int j = 0; j < currentImage.height; ++j) {
-        if (cancelRequested) { checkCancellation(cancelRequested, currentImage, preFilterImage, "Oil Painting"); return; }
-        for (int i = 0; i < currentImage.width; ++i) {
-            int colorCount[256] = {0};
-            int redSum[256] = {0};
-            int greenSum[256] = {0};
-            int blueSum[256] = {0};
-            for (int dy = -radius; dy <= radius; ++dy) {
-                for (int dx = -radius; dx <= radius; ++dx) {
-                    int nx = i + dx, ny = j + dy;
-                    if (nx >= 0 && nx < currentImage.width && ny >= 0 && ny < currentImage.height) {
-                        int r = currentImage(nx, ny, 0);
-                        int g = currentImage(nx, ny, 1);
-                        int b = currentImage(nx, ny, 2);
-                        int avg = (r + g + b) / 3;
-                        int level = std::min(255, std::max(0, avg / std::max(1, intensity)));
-                        colorCount[level]++;
-                        redSum[level] += r;
-                        greenSum[level] += g;
-                        blueSum[level] += b;
-                    }
-                }
-            }
-            int maxCount = 0, maxLevel = 0;
-            for (int k = 0; k < 256; ++k) if (colorCount[k] > maxCount) { maxCount = colorCount[k]; maxLevel = k; }
-            int denom = std::max(1, colorCount[maxLevel]);
-            result.setPixel(i, j, 0, redSum[maxLevel] / denom);
-            result.setPixel(i, j, 1, greenSum[maxLevel] / denom);
-            result.setPixel(i, j, 2, blueSum[maxLevel] / denom);
+    beginProgress(currentImage.height);
+    showStatus("Applying Oil Painting... (Click Cancel to stop)");
+    try {
+        Image result(currentImage.width, currentImage.height);
+        bool completed = OilPaintEngine::apply(currentImage.constView(), result.view(), radius, intensity,
+                                               &cancelRequested, [&](int done, int total) {
+            updateProgress(done, total, 1);
+        });
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Oil Painting");
+            return;
         }
-        updateProgress(j + 1, currentImage.height, 5);
+        currentImage = std::move(result);
+        showStatus("Oil Painting applied (radius " + std::to_string(radius) + ", intensity " + std::to_string(intensity) + ")");
+    } catch (const std::exception& e) {
+        reportFailure(e);
     }
-    currentImage = result;
-    if (statusBar) statusBar->showMessage("Oil Painting applied");
-    if (progressBar) progressBar->setVisible(false);
+    endProgress();
 }
 
 void ImageFilters::applyEnhanceSunlight(Image& currentImage)
 {
-    if (statusBar) statusBar->showMessage("Enhancing Sunlight...");
-    QApplication::processEvents();
-    Image result(currentImage.width, currentImage.height);
-    for (int x = 0; x < currentImage.width; ++x) {
-        for (int y = 0; y < currentImage.height; ++y) {
-            for (int c = 0; c < currentImage.channels; ++c) {
-                int v = currentImage(x, y, c);
-                if (c == 0 || c == 1) v = std::min(255, int(v * 1.4)); // boost R and G
-                result.setPixel(x, y, c, v);
-            }
-        }
-    }
-    currentImage = result;
-    if (statusBar) statusBar->showMessage("Sunlight enhanced");
+    showStatus("Enhancing Sunlight...");
+    mapRows(currentImage, FilterPipeline::sunlightMap());
+    showStatus("Sunlight enhanced");
 }
 
 void ImageFilters::applyEnhanceSunlight(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) { progressBar->setVisible(true); progressBar->setRange(0, currentImage.height); progressBar->setValue(0); }
-    if (statusBar) statusBar->showMessage("Enhancing Sunlight... (Click Cancel to stop)");
-    QApplication::processEvents();
-    Image result(currentImage.width, currentImage.height);
-    for (int y = 0; y < currentImage.height; ++y) {
-        if (cancelRequested) { checkCancellation(cancelRequested, currentImage, preFilterImage, "Enhance Sunlight"); return; }
-        for (int x = 0; x < currentImage.width; ++x) {
-            for (int c = 0; c < 3; ++c) {
-                int v = currentImage(x, y, c);
-                if (c == 0 || c == 1) v = std::min(255, int(v * 1.4)); // boost R and G
-                result.setPixel(x, y, c, v);
-            }
-        }
-        updateProgress(y + 1, currentImage.height, 20);
-    }
-    currentImage = result;
-    if (statusBar) statusBar->showMessage("Sunlight enhanced");
-    if (progressBar) progressBar->setVisible(false);
+    beginProgress(currentImage.height);
+    showStatus("Enhancing Sunlight... (Click Cancel to stop)");
+    if (!mapRows(currentImage, FilterPipeline::sunlightMap(), &cancelRequested)) {
+        checkCancellation(cancelRequested, currentImage, preFilterImage, "Enhance Sunlight");
+        return;
+    }
+    showStatus("Sunlight enhanced");
+    endProgress();
 }
 
 void ImageFilters::applyFishEye(Image& currentImage)
 {
-    if (statusBar) statusBar->showMessage("Applying Fish-Eye...");
-    QApplication::processEvents();
+    showStatus("Applying Fish-Eye...");
+    const std::shared_ptr<const WarpEngine::Map> map = WarpEngine::fishEye(currentImage.width, currentImage.height);
     Image out(currentImage.width, currentImage.height);
-    float centerX = currentImage.width / 2.0f;
-    float centerY = currentImage.height / 2.0f;
-    float radius = std::min(centerX, centerY);
-    for (int y = 0; y < currentImage.height; ++y) {
-        for (int x = 0; x < currentImage.width; ++x) {
-            float dx = (x - centerX) / radius;
-            float dy = (y - centerY) / radius;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            if (dist < 1.0f && dist > 0.0f) {
-                float factor = 1.0f;
-                float newDist = std::pow(dist, factor * 0.75f);
-                float nx = centerX + (dx / dist) * newDist * radius;
-                float ny = centerY + (dy / dist) * newDist * radius;
-                int ix = std::clamp(int(nx), 0, (int)currentImage.width - 1);
-                int iy = std::clamp(int(ny), 0, (int)currentImage.height - 1);
-                for (int c = 0; c < 3; ++c) out.setPixel(x, y, c, currentImage(ix, iy, c));
-            } else {
-                for (int c = 0; c < 3; ++c) out.setPixel(x, y, c, currentImage(x, y, c));
-            }
-        }
-    }
-    currentImage = out;
-    if (statusBar) statusBar->showMessage("Fish-Eye applied");
+    WarpEngine::apply(*map, currentImage.constView(), out.view(), 0);
+    currentImage = std::move(out);
+    showStatus("Fish-Eye applied");
 }
 
 void ImageFilters::applyFishEye(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) { progressBar->setVisible(true); progressBar->setRange(0, currentImage.height); progressBar->setValue(0); }
-    if (statusBar) statusBar->showMessage("Applying Fish-Eye... (Click Cancel to stop)");
-    QApplication::processEvents();
+    beginProgress(currentImage.height);
+    showStatus("Applying Fish-Eye... (Click Cancel to stop)");
+    const std::shared_ptr<const WarpEngine::Map> map = WarpEngine::fishEye(currentImage.width, currentImage.height);
     Image out(currentImage.width, currentImage.height);
-    float centerX = currentImage.width / 2.0f;
-    float centerY = currentImage.height / 2.0f;
-    float radius = std::min(centerX, centerY);
-    for (int y = 0; y < currentImage.height; ++y) {
-        if (cancelRequested) { checkCancellation(cancelRequested, currentImage, preFilterImage, "Fish-Eye"); return; }
-        for (int x = 0; x < currentImage.width; ++x) {
-            float dx = (x - centerX) / radius;
-            float dy = (y - centerY) / radius;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            if (dist < 1.0f && dist > 0.0f) {
-                float factor = 1.0f;
-                float newDist = std::pow(dist, factor * 0.75f);
-                float nx = centerX + (dx / dist) * newDist * radius;
-                float ny = centerY + (dy / dist) * newDist * radius;
-                int ix = std::clamp(int(nx), 0, (int)currentImage.width - 1);
-                int iy = std::clamp(int(ny), 0, (int)currentImage.height - 1);
-                for (int c = 0; c < 3; ++c) out.setPixel(x, y, c, currentImage(ix, iy, c));
-            } else {
-                for (int c = 0; c < 3; ++c) out.setPixel(x, y, c, currentImage(x, y, c));
-            }
-        }
-        updateProgress(y + 1, currentImage.height, 10);
-    }
-    currentImage = out;
-    if (statusBar) statusBar->showMessage("Fish-Eye applied");
-    if (progressBar) progressBar->setVisible(false);
+    bool completed = WarpEngine::apply(*map, currentImage.constView(), out.view(), 0, &cancelRequested,
+                                       [&](int done, int total) { updateProgress(done, total, 1); });
+    if (!completed) {
+        checkCancellation(cancelRequested, currentImage, preFilterImage, "Fish-Eye");
+        return;
+    }
+    currentImage = std::move(out);
+    showStatus("Fish-Eye applied");
+    endProgress();
 }
 
 void ImageFilters::applyBlur(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
@@ -1853,232 +931,157 @@ void ImageFilters::applyBlur(Image& currentImage, Image& preFilterImage, std::at
 }
 void ImageFilters::applyBlur(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int strength)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Blur filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Blur filter... (Click Cancel to stop)");
 
     strength = std::max(0, std::min(100, strength));
     // Map 0..100 to radius 1..25 (0 becomes 1)
-    int blurSize = std::max(1, (strength * 24) / 100 + 1);
+    int blurSize = scaledPixels(std::max(1, (strength * 24) / 100 + 1));
     try {
         Image result(currentImage.width, currentImage.height);
+        ConstImageView src = currentImage.constView();
+        ImageView dst = result.view();
         
-        for (int y = 0; y < currentImage.height; y++) {
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Blur");
-                return;
-            }
-            for (int x = 0; x < currentImage.width; x++) {
-                int R = 0, G = 0, B = 0;
-                int count = 0;
-                for (int i = -blurSize; i <= blurSize; i++) {
-                    for (int j = -blurSize; j <= blurSize; j++) {
-                        int nx = x + j;
-                        int ny = y + i;
-                        if (nx >= 0 && nx < currentImage.width && ny >= 0 && ny < currentImage.height) {
-                            R += currentImage(nx, ny, 0);
-                            G += currentImage(nx, ny, 1);
-                            B += currentImage(nx, ny, 2);
-                            count++;
-                        }
-                    }
-                }
-                result.setPixel(x, y, 0, R / std::max(1, count));
-                result.setPixel(x, y, 1, G / std::max(1, count));
-                result.setPixel(x, y, 2, B / std::max(1, count));
-            }
-            updateProgress(y + 1, currentImage.height, 10);
-        }
-        currentImage = result;
-        if (statusBar) {
-            statusBar->showMessage(QString("Blur filter applied (radius %1)").arg(blurSize));
+        // Sliding-window sums: cost per pixel does not depend on blurSize
+        bool completed = BlurEngine::boxBlur(src, dst, blurSize, &cancelRequested, [&](int done, int total) {
+            updateProgress(done, total, 1);
+        });
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Blur");
+            return;
         }
+        currentImage = std::move(result);
+        showStatus("Blur filter applied (radius " + std::to_string(blurSize) + ")");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
-    if (progressBar) {
-        progressBar->setVisible(false);
+    endProgress();
+}
+
+void ImageFilters::applyGaussianBlur(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int strength)
+{
+    beginProgress(3 * currentImage.height);
+    
+    showStatus("Applying Gaussian Blur filter... (Click Cancel to stop)");
+
+    strength = std::max(0, std::min(100, strength));
+    // Same 1..25 scale as applyBlur(); a box of radius r has sigma ~ r / sqrt(3)
+    int blurSize = std::max(1, (strength * 24) / 100 + 1);
+    double sigma = blurSize * pixelScale / std::sqrt(3.0);
+    try {
+        Image result(currentImage.width, currentImage.height);
+        ConstImageView src = currentImage.constView();
+        ImageView dst = result.view();
+        
+        bool completed = BlurEngine::gaussianBlur(src, dst, sigma, &cancelRequested, [&](int done, int total) {
+            updateProgress(done, total, 1);
+        });
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Gaussian Blur");
+            return;
+        }
+        currentImage = std::move(result);
+        showStatus("Gaussian Blur filter applied (sigma " + fixedText(sigma, 1) + ")");
+    } catch (const std::exception& e) {
+        reportFailure(e);
     }
+    endProgress();
 }
 
 void ImageFilters::applyInfrared(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.width);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Infrared filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Infrared filter... (Click Cancel to stop)");
     
     try {
-        for (int x = 0; x < currentImage.width; ++x) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Infrared");
-                return;
-            }
-            
-            for (int y = 0; y < currentImage.height; ++y) {
-                int red   = currentImage(x, y, 0);
-                int green = currentImage(x, y, 1);
-                int blue  = currentImage(x, y, 2);
-
-                float brightness = (red + green + blue) / 3.0f;
-                float inverted = 255 - brightness;
-
-                int R = 255;
-                unsigned int G = int(inverted);
-                unsigned int B = int(inverted);
-
-                currentImage(x, y, 0) = R;
-                currentImage(x, y, 1) = G;
-                currentImage(x, y, 2) = B;
-            }
-            
-            // Update progress
-            updateProgress(x + 1, currentImage.width, 50);
+        ImageView img = currentImage.view();
+        // Row-major so each row is one contiguous sweep through memory
+        bool completed = runRows(img.height, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                PointKernels::infrared(img.row(y), img.width);
+            }
+        }, &cancelRequested);
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Infrared");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Infrared filter applied");
-        }
+        showStatus("Infrared filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
 void ImageFilters::applyPurpleFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Purple filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Purple filter... (Click Cancel to stop)");
     
     try {
-        for (int y = 0; y < currentImage.height; y++) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Purple");
-                return;
-            }
-            
-            for (int x = 0; x < currentImage.width; x++) {
-                int r = currentImage(x, y, 0);
-                int g = currentImage(x, y, 1);
-                int b = currentImage(x, y, 2);
-
-                r = std::min(255, (int)(r * 1.3));
-                g = std::max(0,   (int)(g * 0.5));
-                b = std::min(255, (int)(b * 1.3));
-
-                currentImage.setPixel(x, y, 0, r);
-                currentImage.setPixel(x, y, 1, g);
-                currentImage.setPixel(x, y, 2, b);
-            }
-            
-            // Update progress
-            updateProgress(y + 1, currentImage.height);
+        if (!mapRows(currentImage, FilterPipeline::purpleMap(), &cancelRequested)) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Purple");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage("Purple filter applied");
-        }
+        showStatus("Purple filter applied");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
 void ImageFilters::applyColorTint(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, 
                                  int r, int g, int b, double intensity)
 {
-    if (progressBar) {
-        progressBar->setVisible(true);
-        progressBar->setRange(0, currentImage.height);
-        progressBar->setValue(0);
-    }
+    beginProgress(currentImage.height);
     
-    if (statusBar) {
-        statusBar->showMessage("Applying Color Tint filter... (Click Cancel to stop)");
-    }
-    QApplication::processEvents();
+    showStatus("Applying Color Tint filter... (Click Cancel to stop)");
     
     // Clamp intensity to [0.0, 1.0]
     intensity = std::max(0.0, std::min(1.0, intensity));
     
     try {
-        for (int y = 0; y < currentImage.height; y++) {
-            // Check for cancellation
-            if (cancelRequested) {
-                checkCancellation(cancelRequested, currentImage, preFilterImage, "Color Tint");
-                return;
-            }
-            
-            for (int x = 0; x < currentImage.width; x++) {
-                int origR = currentImage(x, y, 0);
-                int origG = currentImage(x, y, 1);
-                int origB = currentImage(x, y, 2);
-                
-                // Blend the tint color with the original pixel
-                int newR = static_cast<int>(origR * (1.0 - intensity) + r * intensity);
-                int newG = static_cast<int>(origG * (1.0 - intensity) + g * intensity);
-                int newB = static_cast<int>(origB * (1.0 - intensity) + b * intensity);
-                
-                newR = std::max(0, std::min(255, newR));
-                newG = std::max(0, std::min(255, newG));
-                newB = std::max(0, std::min(255, newB));
-                
-                currentImage.setPixel(x, y, 0, newR);
-                currentImage.setPixel(x, y, 1, newG);
-                currentImage.setPixel(x, y, 2, newB);
-            }
-            
-            // Update progress
-            updateProgress(y + 1, currentImage.height);
+        // Blend the tint color with the original pixel, one table per channel
+        if (!mapRows(currentImage, FilterPipeline::colorTintMap(r, g, b, intensity), &cancelRequested)) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Color Tint");
+            return;
         }
         
-        if (statusBar) {
-            statusBar->showMessage(QString("Color Tint filter applied (RGB: %1, %2, %3)").arg(r).arg(g).arg(b));
-        }
+        showStatus("Color Tint filter applied (RGB: " + rgbText(r, g, b) + ")");
     } catch (const std::exception& e) {
-        if (statusBar) {
-            statusBar->showMessage(QString("Filter failed: %1").arg(e.what()));
-        }
+        reportFailure(e);
     }
     
-    if (progressBar) {
-        progressBar->setVisible(false);
-    }
+    endProgress();
 }
 
-
+void ImageFilters::applyPipeline(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                                 const FilterPipeline& pipeline)
+{
+    beginProgress(currentImage.height);
+    
+    const std::string description = pipeline.description();
+    showStatus("Applying " + description + "... (Click Cancel to stop)");
+    
+    try {
+        bool completed = pipeline.apply(currentImage.view(), &cancelRequested, [&](int done, int total) {
+            updateProgress(done, total, 1);
+        });
+        if (!completed) {
+            checkCancellation(cancelRequested, currentImage, preFilterImage, "Filter Chain");
+            return;
+        }
+        
+        showStatus("Filter chain applied (" + description + ")");
+    } catch (const std::exception& e) {
+        reportFailure(e);
+    }
+    
+    endProgress();
+}
@@ -1,6 +1,6 @@
 /**
  * @file ImageFilters.h
- * @brief Image processing filters with Qt integration, progress tracking, and cancellation support.
+ * @brief Image processing filters with progress tracking and cancellation support.
  * 
  * This file contains the declaration of the ImageFilters class, which provides a comprehensive
  * set of image processing operations including basic filters (grayscale, invert), geometric
@@ -8,15 +8,16 @@
  * and special filters (TV/CRT, purple tint). All filters support progress tracking and
  * cancellation for long-running operations.
  * 
- * @details The ImageFilters class is designed to work seamlessly with Qt's GUI framework,
- * providing real-time progress updates and the ability to cancel operations mid-execution.
- * It uses atomic operations for thread-safe cancellation and integrates with Qt's progress
- * bar and status bar components.
+ * @details The ImageFilters class reports real-time progress through the toolkit-independent
+ * ProgressReporter interface and can cancel operations mid-execution. It uses atomic
+ * operations for thread-safe cancellation; the GUI adapts the reports to its progress bar
+ * and status bar, and the command-line tool to the console. The filters use no Qt at
+ * all, so they run without a GUI.
  * 
  * @features
  * - Progress tracking for all long-running operations
  * - Cancellation support using atomic flags
- * - Qt integration with progress bars and status updates
+ * - Progress and status updates through a ProgressReporter
  * - Comprehensive error handling and exception safety
  * - Support for various image formats through the Image class
  * - Memory-efficient processing with in-place operations where possible
@@ -38,21 +39,27 @@
 // Forward declaration to avoid including the full Image_Class.h implementation
 class Image;
 #undef pixel  // Undefine the pixel macro to avoid conflicts with Qt
-class QProgressBar; // forward declaration to avoid heavy Qt includes in header
-class QStatusBar;   // forward declaration
-class QString;      // forward declaration
+class ProgressReporter; // forward declaration
+class FilterPipeline; // forward declaration
 #include <atomic>
+#include <functional>
 #include <cmath>
 #include <algorithm>
-#include <random>
-#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include "../simd/PointKernels.h"
+#include "../image/Resampler.h"
+#include "BlendEngine.h"
+#include "EdgeEngine.h"
+#include "NoiseSource.h"
 
 /**
  * @class ImageFilters
- * @brief Comprehensive image processing class with Qt integration and cancellation support.
+ * @brief Comprehensive image processing class with progress reporting and cancellation support.
  * 
  * The ImageFilters class provides a complete suite of image processing operations designed
- * to work seamlessly with Qt applications. It supports progress tracking, cancellation,
+ * to work in the GUI and in headless tools alike. It supports progress tracking, cancellation,
  * and real-time status updates for all operations.
  * 
  * @details This class implements various image processing algorithms including:
@@ -62,26 +69,66 @@ class QString;      // forward declaration
  * - Special effects (TV/CRT simulation, purple tint, frame addition)
  * - Image combination (merge operations)
  * 
- * All long-running operations support cancellation and progress tracking through Qt's
- * progress bar and status bar components.
+ * All long-running operations support cancellation and progress tracking through a
+ * ProgressReporter.
  * 
- * @note This class is designed to work with the Image class and requires Qt 6.8.1 or later.
+ * Filters work on 8-bit RGB images unless their documentation lists other
+ * formats; Recipe declares the same per filter and converts with
+ * PixelConverter only when a step needs it.
+ * 
+ * Results are written into new images whose buffers come from the BufferPool,
+ * so a chain of filters ping-pongs between two frames: each result reuses the
+ * buffer the image before it released.
+ * 
+ * @note This class is designed to work with the Image class and needs only the standard library.
  * @see Image class for image data structure and basic operations
- * @see QProgressBar for progress tracking
- * @see QStatusBar for status updates
+ * @see ProgressReporter for progress and status updates
  */
 class ImageFilters
 {
 public:
     /**
-     * @brief Constructs an ImageFilters object with Qt UI components.
+     * @brief Constructs an ImageFilters object reporting to @p reporter.
+     * 
+     * @param reporter Receiver of progress and status updates (can be nullptr);
+     *        must outlive this object and be thread-safe
+     * 
+     * @note If nullptr, progress and status updates will be skipped.
+     */
+    explicit ImageFilters(ProgressReporter* reporter = nullptr);
+    
+    /**
+     * @brief Sets the scale applied to parameters measured in pixels.
+     * 
+     * Blur radii and custom frame widths are multiplied by @p scale, so a filter
+     * run on a reduced proxy of an image (scale = proxy width / image width)
+     * looks like the full-resolution result scaled down. The default is 1.
+     * 
+     * @param scale Proxy-to-original size ratio (must be positive)
+     * @see PhotoSmith::beginPreview() for the live preview that uses it
+     */
+    void setPixelScale(double scale) { pixelScale = scale > 0.0 ? scale : 1.0; }
+    
+    /**
+     * @brief Returns the scale applied to parameters measured in pixels.
+     */
+    double getPixelScale() const { return pixelScale; }
+    
+    /**
+     * @brief Returns why the last failed filter call failed, or an empty string.
      * 
-     * @param progressBar Pointer to QProgressBar for progress tracking (can be nullptr)
-     * @param statusBar Pointer to QStatusBar for status updates (can be nullptr)
+     * Filters catch their own errors and report them as a status message, so
+     * without a reporter a failure is otherwise silent. The message stays set
+     * until clearLastError(), across later successful calls.
      * 
-     * @note Both parameters are optional. If nullptr, progress and status updates will be skipped.
+     * @see Recipe::apply() for the batch tool, which fails the file on it
      */
-    ImageFilters(QProgressBar* progressBar, QStatusBar* statusBar);
+    const std::string& getLastError() const { return lastError; }
+    
+    /**
+     * @brief Forgets the last failure (see getLastError()).
+     */
+    void clearLastError() { lastError.clear(); }
     
     // ============================================================================
     // BASIC COLOR FILTERS (with progress tracking and cancellation)
@@ -92,6 +139,7 @@ public:
      * 
      * Applies a simple grayscale conversion by averaging RGB values for each pixel.
      * This operation supports progress tracking and cancellation.
+     * Handles 8-bit gray images too, which are left unchanged.
      * 
      * @param currentImage Reference to the image to process (modified in-place)
      * @param preFilterImage Reference to store the original image state for cancellation
@@ -112,16 +160,19 @@ public:
      * @param currentImage Reference to the image to process (modified in-place)
      * @param preFilterImage Reference to store the original image state for cancellation
      * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param seed Noise seed; the same seed and image always give the same result
+     *        (NoiseSource::randomSeed() for a different one every run)
      * 
      * @details The effect includes:
      * - Horizontal scan lines (darker every 3rd row)
      * - Color temperature shifts (blue/purple for dark areas, warm orange for bright areas)
-     * - Random noise for authentic TV feel
+     * - Random noise for authentic TV feel, from a NoiseSource keyed by pixel position
      * - Brightness-based color adjustments
      * 
      * @note This is a long-running operation that can be cancelled.
      */
-    void applyTVFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
+    void applyTVFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                       std::uint64_t seed);
     
     /**
      * @brief Converts the image to pure black and white (binary).
@@ -142,6 +193,7 @@ public:
      * 
      * Subtracts each RGB component from 255 to create a negative effect.
      * This operation supports progress tracking and cancellation.
+     * Handles 8-bit gray images too.
      * 
      * @param currentImage Reference to the image to process (modified in-place)
      * @param preFilterImage Reference to store the original image state for cancellation
@@ -158,26 +210,32 @@ public:
     /**
      * @brief Merges the current image with another image.
      * 
-     * Combines two images by averaging their pixel values. The resulting image
-     * will have the dimensions of the smaller input image.
+     * Blends @p mergeImage over the current image with BlendEngine. The result
+     * keeps the size of the current image; a merge image of another size is
+     * scaled to it band by band as it is blended, not cropped.
      * 
-     * @param currentImage Reference to the first image (modified in-place)
-     * @param mergeImage Reference to the second image to merge with
+     * @param currentImage Reference to the base image (modified in-place)
+     * @param mergeImage Image blended over it
+     * @param mode Blend mode (the default averages the two images)
+     * @param opacity Strength of the merge image in percent (0-100)
      * 
      * @note This is an immediate operation without progress tracking.
      */
-    void applyMerge(Image& currentImage, Image& mergeImage);
+    void applyMerge(Image& currentImage, const Image& mergeImage,
+                    BlendEngine::Mode mode = BlendEngine::Mode::Normal, int opacity = 50);
     
     /**
      * @brief Flips the image horizontally or vertically.
      * 
+     * Handles 8-bit gray, RGB and RGBA images.
+     * 
      * @param currentImage Reference to the image to flip (modified in-place)
      * @param direction String specifying flip direction: "Horizontal" or "Vertical"
      * 
      * @note This is an immediate operation without progress tracking.
      * @throws std::invalid_argument if direction is not "Horizontal" or "Vertical"
      */
-    void applyFlip(Image& currentImage, const QString& direction);
+    void applyFlip(Image& currentImage, const std::string& direction);
     
     /**
      * @brief Rotates the image by the specified angle.
@@ -187,6 +245,7 @@ public:
      * 
      * @note This is an immediate operation without progress tracking.
      * @note For best performance with 90°, 180°, and 270°, special optimized paths are used.
+     * @note Other angles are sampled bilinearly through a WarpEngine map, cached per size and angle.
      */
     void applyRotate(Image& currentImage, int angleDegrees);
     
@@ -203,7 +262,7 @@ public:
      * @note This is an immediate operation without progress tracking.
      * @throws std::invalid_argument if choice is not "dark" or "light"
      */
-    void applyDarkAndLight(Image& currentImage, const QString& choice);
+    void applyDarkAndLight(Image& currentImage, const std::string& choice);
     /**
      * @brief Adjusts image brightness by a given percentage.
      *
@@ -211,22 +270,27 @@ public:
      * @param choice "dark" to darken, "light" to lighten
      * @param percent Percentage in [0, 100]; 0 = no change, 100 = full effect
      */
-    void applyDarkAndLight(Image& currentImage, const QString& choice, int percent);
+    void applyDarkAndLight(Image& currentImage, const std::string& choice, int percent);
     
     /**
      * @brief Adds a decorative frame around the image.
      * 
      * @param currentImage Reference to the image to frame (modified in-place)
-     * @param frameType String specifying frame style: "Simple Frame" or "Decorated Frame"
+     * @param frameType Preset name (see FrameEngine::Frame::preset())
      * 
      * @details:
      * - "Simple Frame": Blue outer border with white inner border
-     * - "Decorated Frame": Brown/beige decorative frame with accent patterns
+     * - "Double Border - White", "Solid Frame - Blue/Red/Green/Black/White",
+     *   "Shadow Frame" and "Gold Decorated Frame"
+     * - "Decorated Frame": Brown/beige decorative frame with accent patterns (also
+     *   used for unknown names)
+     * 
+     * The border is rendered by FrameEngine only around the image and cached
+     * per frame and image size, so framing many images of one size mostly copies.
      * 
      * @note This is an immediate operation without progress tracking.
-     * @throws std::invalid_argument if frameType is not "Simple Frame" or "Decorated Frame"
      */
-    void applyFrame(Image& currentImage, const QString& frameType);
+    void applyFrame(Image& currentImage, const std::string& frameType);
     
     /**
      * @brief Adds a custom colored frame around the image.
@@ -252,46 +316,56 @@ public:
      * @param b Blue component of the frame color (0-255)
      * 
      * @note This is an immediate operation without progress tracking.
+     * @see FrameEngine for the rendering and the border cache
      */
-    void applyFrame(Image& currentImage, const QString& frameType, int frameWidth, int r, int g, int b);
+    void applyFrame(Image& currentImage, const std::string& frameType, int frameWidth, int r, int g, int b);
     
     /**
      * @brief Detects and highlights edges in the image.
      * 
      * Applies Sobel edge detection algorithm with Gaussian blur preprocessing.
-     * The result shows white edges on a black background.
+     * The result shows black edges on a white background.
      * 
      * @param currentImage Reference to the image to process (modified in-place)
+     * @param output Hard threshold, or the gradient magnitude as shades of grey
+     * @param threshold Magnitude (0-255) above which a pixel is an edge (threshold output only)
      * 
-     * @details The algorithm:
-     * 1. Converts to grayscale using weighted average (0.299R + 0.587G + 0.114B)
+     * @details The algorithm (EdgeEngine, streamed through row buffers):
+     * 1. Converts to luma in integer math ((77R + 150G + 29B + 128) >> 8)
      * 2. Applies 5x5 Gaussian blur to reduce noise
      * 3. Uses 3x3 Sobel kernels for edge detection
      * 4. Calculates gradient magnitude and applies threshold
      * 
      * @note This is an immediate operation without progress tracking.
      */
-    void applyEdges(Image& currentImage);
+    void applyEdges(Image& currentImage, EdgeEngine::Output output = EdgeEngine::Output::Threshold,
+                    int threshold = 50);
     
     /**
      * @brief Resizes the image to specified dimensions.
      * 
-     * Uses nearest-neighbor interpolation for resizing. The aspect ratio is not preserved.
+     * Resamples with the chosen filter (Resampler), widened on downscales so
+     * detail averages out instead of aliasing. The aspect ratio is not preserved.
+     * Handles 8-bit gray, RGB and RGBA images, interleaved or planar (each
+     * plane is resampled on its own), and keeps their format.
      * 
      * @param currentImage Reference to the image to resize (modified in-place)
      * @param width New width in pixels
      * @param height New height in pixels
+     * @param filter Resampling filter; Lanczos3 is the sharpest, Box the fastest for downscales
      * 
      * @note This is an immediate operation without progress tracking.
      * @throws std::invalid_argument if width or height is less than 1
      */
-    void applyResize(Image& currentImage, int width, int height);
+    void applyResize(Image& currentImage, int width, int height,
+                     Resampler::Filter filter = Resampler::Filter::Lanczos3);
     
     /**
      * @brief Skews the image horizontally by a given angle in degrees.
      * 
      * Creates a shearing effect along the X axis. The resulting canvas width
      * increases to accommodate the skewed content and is filled with white.
+     * Rows move by their exact sub-pixel shift (WarpEngine, bilinear).
      * 
      * @param currentImage Reference to the image to skew (modified in-place)
      * @param angleDegrees Skew angle in degrees (positive skews right, negative left)
@@ -303,13 +377,13 @@ public:
     // ===================== ADDITIONAL EFFECT FILTERS (immediate) =====================
     /** Emboss effect producing a relief-like grayscale. */
     void applyEmboss(Image& currentImage);
-    /** Double vision horizontal offset blend. */
+    /** Double vision horizontal offset blend (integer 6:4 weights on Stencil). */
     void applyDoubleVision(Image& currentImage, int offset = 15);
-    /** Oil painting effect (radius/intensity). */
+    /** Oil painting effect (radius/intensity) using sliding histograms, see OilPaintEngine. */
     void applyOilPainting(Image& currentImage, int radius = 3, int intensity = 30);
     /** Enhance sunlight (boost warm channels). */
     void applyEnhanceSunlight(Image& currentImage);
-    /** Fish-eye lens distortion effect. */
+    /** Fish-eye lens distortion effect, bilinear through a cached WarpEngine map. */
     void applyFishEye(Image& currentImage);
     
     // ============================================================================
@@ -319,7 +393,8 @@ public:
     /**
      * @brief Applies a blur effect to the image.
      * 
-     * Uses a 15x15 average blur kernel to create a soft, blurred effect.
+     * Averages each pixel over a square window using BlurEngine's sliding-window
+     * sums, so the cost does not grow with the radius.
      * This operation supports progress tracking and cancellation.
      * 
      * @param currentImage Reference to the image to process (modified in-place)
@@ -334,6 +409,12 @@ public:
      * @param strength Percent in [0,100], mapped to kernel radius.
      */
     void applyBlur(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int strength);
+    /**
+     * @brief Applies a Gaussian blur approximated by three stacked box passes.
+     * @param strength Percent in [0,100], mapped to the same radius scale as applyBlur().
+     * @see BlurEngine::gaussianBlur() for the kernel
+     */
+    void applyGaussianBlur(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int strength);
     
     /**
      * @brief Applies an infrared photography simulation effect.
@@ -393,6 +474,25 @@ public:
      */
     void applyColorTint(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, 
                        int r, int g, int b, double intensity = 0.5);
+    
+    /**
+     * @brief Applies a chain of point operations in one fused pass.
+     * 
+     * Adjacent per-channel stages are composed into a single lookup table and
+     * every row runs through the whole chain while it is in cache. The result
+     * equals applying the stages one after another.
+     * This operation supports progress tracking and cancellation.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param pipeline Stages to apply, in order
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     * @see FilterPipeline for building chains without Qt
+     */
+    void applyPipeline(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                       const FilterPipeline& pipeline);
 
     // New filters with progress and cancellation
     void applyEmboss(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
@@ -402,21 +502,52 @@ public:
     void applyFishEye(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
 
 private:
-    QProgressBar* progressBar;  ///< Pointer to Qt progress bar for progress tracking
-    QStatusBar* statusBar;      ///< Pointer to Qt status bar for status updates
+    ProgressReporter* reporter; ///< Receiver of progress and status updates (may be nullptr)
+    double pixelScale = 1.0;    ///< Multiplier for pixel-sized parameters (see setPixelScale())
+    std::string lastError;      ///< Message of the last caught failure (see getLastError())
+    
+    /**
+     * @brief Scales a size in pixels by pixelScale, keeping it at least 1.
+     */
+    int scaledPixels(int pixels) const { return std::max(1, static_cast<int>(std::lround(pixels * pixelScale))); }
     
     /**
-     * @brief Updates the progress bar with current progress.
+     * @brief Reports current progress, at most every @p updateInterval steps.
      * 
      * @param value Current progress value (0 to total)
      * @param total Maximum progress value
      * @param updateInterval Number of operations between UI updates (default: 50)
      * 
      * @note This method is thread-safe and can be called from any thread.
-     * @see QApplication::processEvents() for UI responsiveness
      */
     void updateProgress(int value, int total, int updateInterval = 50);
     
+    /**
+     * @brief Reports the start of an operation of @p total steps.
+     * 
+     * @note Safe to call from any thread.
+     */
+    void beginProgress(int total);
+    
+    /**
+     * @brief Reports that an operation finished or was cancelled.
+     * 
+     * @note Safe to call from any thread.
+     */
+    void endProgress();
+    
+    /**
+     * @brief Reports the status message @p message.
+     * 
+     * @note Safe to call from any thread.
+     */
+    void showStatus(const std::string& message);
+    
+    /**
+     * @brief Records @p error as the last failure and reports it as a status message.
+     */
+    void reportFailure(const std::exception& error);
+    
     /**
      * @brief Checks for cancellation and restores previous image state if cancelled.
      * 
@@ -428,7 +559,33 @@ private:
      * @note This method should be called periodically during long-running operations.
      * @see std::atomic for thread-safe cancellation
      */
-    void checkCancellation(std::atomic<bool>& cancelRequested, Image& currentImage, Image& preFilterImage, const QString& filterName);
+    void checkCancellation(std::atomic<bool>& cancelRequested, Image& currentImage, Image& preFilterImage, const std::string& filterName);
+    
+    /**
+     * @brief Runs a row-band kernel on all cores through the shared ThreadPool.
+     * 
+     * @param height Number of rows to process
+     * @param band Kernel processing rows [rowBegin, rowEnd); must only write its own rows
+     * @param cancelRequested Optional cancel flag; when given, workers stop between bands
+     *        once it is set and progress is reported through updateProgress()
+     * @return true if every row was processed, false if cancelled
+     * 
+     * @note Progress updates happen on the calling thread only.
+     * @see ThreadPool::parallelRows() for scheduling details
+     */
+    bool runRows(int height, const std::function<void(int rowBegin, int rowEnd)>& band, std::atomic<bool>* cancelRequested = nullptr);
+    
+    /**
+     * @brief Applies a per-channel colour map to every row of the image in place.
+     * 
+     * @param image Image to transform
+     * @param map Per-channel transform built with PointKernels::makeChannelMap()
+     * @param cancelRequested Optional cancel flag, forwarded to runRows()
+     * @return true if every row was processed, false if cancelled
+     * 
+     * @see PointKernels::mapChannels() for the vectorized kernel
+     */
+    bool mapRows(Image& image, const PointKernels::ChannelMap& map, std::atomic<bool>* cancelRequested = nullptr);
 };
 
 #endif // IMAGEFILTERS_H
@@ -0,0 +1,113 @@
+/**
+ * @file NoiseSource.h
+ * @brief Counter-based random numbers keyed by seed and pixel position.
+ *
+ * This file declares the NoiseSource class, the shared noise of the filters
+ * that add randomness (TV/CRT noise, and grain or dithering effects). Instead
+ * of a generator whose state advances with every draw, each value is a hash
+ * of (seed, x, y, stream): the same pixel gets the same noise whichever
+ * thread, band or SIMD lane computes it, and in whatever order. Output
+ * depends only on the seed, so a fixed seed reproduces a result exactly.
+ *
+ * @details The source provides:
+ * - 64 random bits per (x, y, stream), from two rounds of the SplitMix64
+ *   finalizer; streams give independent values for the same pixel (one per
+ *   channel, say)
+ * - Uniform integers in a closed range and uniform floats in [0, 1)
+ * - randomSeed() for callers that want a different result every run
+ *
+ * @note A NoiseSource is a single 64-bit key, cheap to copy into lambdas and
+ *       safe to share between threads; every call is const.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef NOISESOURCE_H
+#define NOISESOURCE_H
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+/**
+ * @class NoiseSource
+ * @brief Stateless noise: a pure function of seed and position.
+ *
+ * @code
+ * const NoiseSource noise(seed);
+ * ThreadPool::instance().parallelRows(img.height, [&](int rowBegin, int rowEnd) {
+ *     for (int y = rowBegin; y < rowEnd; ++y)
+ *         for (int x = 0; x < img.width; ++x) grain[y][x] = noise.uniform(x, y, -10, 10);
+ * });
+ * @endcode
+ */
+class NoiseSource {
+public:
+    /**
+     * @brief Creates the source for @p seed; equal seeds give equal noise.
+     */
+    explicit constexpr NoiseSource(std::uint64_t seed) : key(mix(seed + kGolden)) {}
+
+    /**
+     * @brief 64 random bits for pixel (@p x, @p y) in @p stream.
+     */
+    constexpr std::uint64_t bits(int x, int y, std::uint32_t stream = 0) const
+    {
+        const std::uint64_t counter = (std::uint64_t(std::uint32_t(y)) << 32) | std::uint32_t(x);
+        return mix(key ^ mix(counter + std::uint64_t(stream) * kGolden));
+    }
+
+    /**
+     * @brief Uniform integer in [@p low, @p high] for pixel (@p x, @p y).
+     *
+     * Scales the top 32 bits by the range width (multiply and shift, no
+     * division); the bias is below 2^-32 * width.
+     */
+    constexpr int uniform(int x, int y, int low, int high, std::uint32_t stream = 0) const
+    {
+        const std::uint64_t width = std::uint64_t(std::int64_t(high) - low + 1);
+        return low + static_cast<int>(((bits(x, y, stream) >> 32) * width) >> 32);
+    }
+
+    /**
+     * @brief Uniform float in [0, 1) for pixel (@p x, @p y).
+     */
+    constexpr float unit(int x, int y, std::uint32_t stream = 0) const
+    {
+        return static_cast<float>(bits(x, y, stream) >> 40) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * @brief A seed that differs between calls and runs, for unseeded effects.
+     */
+    static std::uint64_t randomSeed()
+    {
+        const auto ticks = static_cast<std::uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+        return mix(ticks ^ (std::uint64_t(std::random_device{}()) << 32));
+    }
+
+private:
+    static constexpr std::uint64_t kGolden = 0x9e3779b97f4a7c15ULL; ///< 2^64 / golden ratio
+
+    /**
+     * @brief SplitMix64 finalizer: a bijective mix in which every input bit affects every output bit.
+     */
+    static constexpr std::uint64_t mix(std::uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    std::uint64_t key; ///< Mixed seed
+};
+
+#endif // NOISESOURCE_H
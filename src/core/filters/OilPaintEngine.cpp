@@ -0,0 +1,136 @@
+/**
+ * @file OilPaintEngine.cpp
+ * @brief Implementation of the sliding-histogram oil painting kernel.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "OilPaintEngine.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+
+int OilPaintEngine::levelCount(int intensity)
+{
+    intensity = std::max(1, std::min(255, intensity));
+    return 255 / intensity + 1;
+}
+
+void OilPaintEngine::paintBand(const ConstImageView& src, const ImageView& dst, int radius,
+                               int intensity, int rowBegin, int rowEnd)
+{
+    const int width = src.width;
+    const int height = src.height;
+    const int levels = levelCount(intensity);
+
+    // One histogram per column over the vertical window, plus the window histogram
+    std::vector<Bin> columns(static_cast<std::size_t>(width) * levels);
+    std::vector<Bin> window(levels);
+
+    auto addRow = [&](int y) {
+        const unsigned char* p = src.row(y);
+        Bin* column = columns.data();
+        for (int x = 0; x < width; ++x, p += 3, column += levels) {
+            Bin& bin = column[((p[0] + p[1] + p[2]) / 3) / intensity];
+            ++bin.count;
+            bin.r += p[0];
+            bin.g += p[1];
+            bin.b += p[2];
+        }
+    };
+    auto removeRow = [&](int y) {
+        const unsigned char* p = src.row(y);
+        Bin* column = columns.data();
+        for (int x = 0; x < width; ++x, p += 3, column += levels) {
+            Bin& bin = column[((p[0] + p[1] + p[2]) / 3) / intensity];
+            --bin.count;
+            bin.r -= p[0];
+            bin.g -= p[1];
+            bin.b -= p[2];
+        }
+    };
+    auto addColumn = [&](int x) {
+        const Bin* column = columns.data() + static_cast<std::size_t>(x) * levels;
+        for (int k = 0; k < levels; ++k) {
+            window[k].count += column[k].count;
+            window[k].r += column[k].r;
+            window[k].g += column[k].g;
+            window[k].b += column[k].b;
+        }
+    };
+    auto removeColumn = [&](int x) {
+        const Bin* column = columns.data() + static_cast<std::size_t>(x) * levels;
+        for (int k = 0; k < levels; ++k) {
+            window[k].count -= column[k].count;
+            window[k].r -= column[k].r;
+            window[k].g -= column[k].g;
+            window[k].b -= column[k].b;
+        }
+    };
+
+    // Prime the column histograms for the first output row (clipped), halo rows included
+    const int primeBegin = std::max(0, rowBegin - radius);
+    const int primeEnd = std::min(height - 1, rowBegin + radius);
+    for (int k = primeBegin; k <= primeEnd; ++k) addRow(k);
+
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        if (y > rowBegin) {
+            // Slide the column histograms down: row y - radius - 1 leaves, y + radius enters
+            const int leave = y - radius - 1;
+            const int enter = y + radius;
+            if (leave >= 0) removeRow(leave);
+            if (enter < height) addRow(enter);
+        }
+
+        // Prime the window with columns [0, radius] (clipped)
+        std::fill(window.begin(), window.end(), Bin{});
+        const int primeColumns = std::min(radius, width - 1);
+        for (int x = 0; x <= primeColumns; ++x) addColumn(x);
+
+        unsigned char* d = dst.row(y);
+        for (int x = 0; x < width; ++x, d += 3) {
+            // Most frequent level; the lowest one wins ties
+            std::uint32_t maxCount = 0;
+            int maxLevel = 0;
+            for (int k = 0; k < levels; ++k) {
+                if (window[k].count > maxCount) {
+                    maxCount = window[k].count;
+                    maxLevel = k;
+                }
+            }
+            const Bin& bin = window[maxLevel];
+            const std::uint32_t denom = std::max<std::uint32_t>(1, bin.count);
+            d[0] = static_cast<unsigned char>(bin.r / denom);
+            d[1] = static_cast<unsigned char>(bin.g / denom);
+            d[2] = static_cast<unsigned char>(bin.b / denom);
+
+            // Slide the window right: column x + radius + 1 enters, column x - radius leaves
+            const int enter = x + radius + 1;
+            const int leave = x - radius;
+            if (enter < width) addColumn(enter);
+            if (leave >= 0) removeColumn(leave);
+        }
+    }
+}
+
+bool OilPaintEngine::apply(const ConstImageView& src, const ImageView& dst, int radius, int intensity,
+                           const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    if (src.empty()) return true;
+    radius = std::max(1, radius);
+    intensity = std::max(1, std::min(255, intensity));
+    ThreadPool& pool = ThreadPool::instance();
+
+    // Each band re-reads about 2r+1 halo rows, so keep bands several times taller
+    const int grain = std::max(4 * (radius + 1), src.height / (pool.concurrency() * 4));
+    return pool.parallelRows(src.height, [&](int rowBegin, int rowEnd) {
+        paintBand(src, dst, radius, intensity, rowBegin, rowEnd);
+    }, cancelRequested, progress, grain);
+}
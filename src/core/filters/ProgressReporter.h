@@ -0,0 +1,61 @@
+/**
+ * @file ProgressReporter.h
+ * @brief Toolkit-independent interface for filter progress and status reports.
+ *
+ * This file declares the ProgressReporter interface through which ImageFilters
+ * reports progress and status messages. The core library only sees this
+ * interface; the GUI implements it on top of its progress bar and status bar
+ * (QtProgressReporter), and the command-line tool on top of the console.
+ *
+ * @details Reporters must be thread-safe: filters run on worker threads and
+ * report from there. Cancellation stays a std::atomic<bool> flag passed to each
+ * filter, so it needs no reporter at all.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef PROGRESSREPORTER_H
+#define PROGRESSREPORTER_H
+
+#include <string>
+
+/**
+ * @class ProgressReporter
+ * @brief Receives progress and status updates from running filters.
+ *
+ * @note Every method may be called from any thread.
+ */
+class ProgressReporter {
+public:
+    virtual ~ProgressReporter() = default;
+
+    /**
+     * @brief An operation of @p total steps has started.
+     */
+    virtual void beginProgress(int total) = 0;
+
+    /**
+     * @brief @p value of @p total steps are done.
+     */
+    virtual void updateProgress(int value, int total) = 0;
+
+    /**
+     * @brief The operation finished or was cancelled.
+     */
+    virtual void endProgress() = 0;
+
+    /**
+     * @brief A human-readable status message (UTF-8).
+     */
+    virtual void showStatus(const std::string& message) = 0;
+};
+
+#endif // PROGRESSREPORTER_H
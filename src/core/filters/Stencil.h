@@ -0,0 +1,475 @@
+/**
+ * @file Stencil.h
+ * @brief Compile-time convolution kernels and the row passes that apply them.
+ *
+ * This file declares the Stencil class, the shared core of the neighbourhood
+ * filters (edge detection, emboss, double vision). A kernel is a type whose
+ * integer taps are template arguments, so every pass is unrolled at compile
+ * time: zero taps disappear, unit and power-of-two taps become adds and
+ * shifts, and only the remaining taps are multiplied.
+ *
+ * @details The core provides:
+ * - Stencil::Kernel, a 1-D kernel with its taps, radius and tap sums
+ * - Vertical passes over byte rows (columns) and horizontal passes over
+ *   16-bit rows (along), with 16-bit or normalised byte output
+ * - Scalar and SSE2 implementations with identical results, selected at
+ *   runtime by the top-level passes (PHOTOSMITH_SIMD=scalar forces the former)
+ * - Stencil::RowRing, which keeps the last rows of a plane padded with copies
+ *   of their edge entries: borders are handled once when a row is loaded, and
+ *   the inner loops have no bounds checks
+ *
+ * @note Normalisation by a divisor that is not a power of two multiplies by a
+ *       16-bit reciprocal; a static_assert proves it exact for every sum the
+ *       kernel can produce.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef STENCIL_H
+#define STENCIL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "../simd/PointKernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define STENCIL_SIMD_X86 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * @class Stencil
+ * @brief Static templates applying compile-time kernels to rows.
+ *
+ * @code
+ * using Smooth = Stencil::Kernel<1, 2, 1>;
+ * const unsigned char* rows[3] = {above, centre, below};
+ * Stencil::columns<Smooth>(rows, width * 3, sums);        // 16-bit sums
+ * Stencil::columnsToBytes<Smooth, 4>(rows, width * 3, out); // normalised
+ * @endcode
+ *
+ * @see EdgeEngine for the Gaussian and Sobel passes built on it
+ */
+class Stencil {
+public:
+    /**
+     * @brief True if the SSE2 passes are in use: on x86, unless PHOTOSMITH_SIMD=scalar.
+     */
+    static bool simd()
+    {
+#if defined(STENCIL_SIMD_X86)
+        static const bool enabled = std::strcmp(PointKernels::activeIsa(), "scalar") != 0;
+        return enabled;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief 1-D kernel with integer taps.
+     *
+     * Vertical passes weight row i by tap i. Horizontal passes need an odd
+     * number of taps and centre the kernel on the output entry.
+     */
+    template <int... Taps>
+    struct Kernel {
+        static constexpr int size = sizeof...(Taps);
+        static constexpr int radius = size / 2;
+        static constexpr std::array<int, sizeof...(Taps)> taps = {Taps...};
+        static constexpr int positive = ((Taps > 0 ? Taps : 0) + ...); ///< Sum of the positive taps
+        static constexpr int negative = ((Taps < 0 ? -Taps : 0) + ...); ///< Magnitude of the negative taps
+    };
+
+    /**
+     * @brief Portable passes; the reference the SIMD passes match exactly.
+     */
+    struct Scalar {
+        /**
+         * @brief out[x] = sum of K::taps[i] * rows[i][x], for @p count entries.
+         */
+        template <class K>
+        static void columns(const unsigned char* const* rows, int count, std::int16_t* out)
+        {
+            checkColumns<K>();
+            for (int x = 0; x < count; ++x) {
+                out[x] = static_cast<std::int16_t>(dotRows<K>(rows, x, std::make_index_sequence<K::size>()));
+            }
+        }
+
+        /**
+         * @brief out[x] = clamp(floor(column sum / Divisor) + Bias, 0, 255).
+         */
+        template <class K, int Divisor = 1, int Bias = 0>
+        static void columnsToBytes(const unsigned char* const* rows, int count, unsigned char* out)
+        {
+            checkColumns<K>();
+            checkDivisor<K, Divisor, 255 * K::positive>();
+            checkBias<K, Divisor, Bias>();
+            for (int x = 0; x < count; ++x) {
+                const int sum = dotRows<K>(rows, x, std::make_index_sequence<K::size>());
+                out[x] = toByte(floorDivide<Divisor>(sum) + Bias);
+            }
+        }
+
+        /**
+         * @brief out[x] = sum of K::taps[i] * in[x - radius + i], for @p count entries.
+         *
+         * @p in must be readable from -radius to count + radius - 1.
+         * Sums wrap modulo 2^16 like the SIMD lanes; the caller keeps them in range.
+         */
+        template <class K>
+        static void along(const std::int16_t* in, int count, std::int16_t* out)
+        {
+            checkAlong<K>();
+            for (int x = 0; x < count; ++x) {
+                out[x] = static_cast<std::int16_t>(dotAlong<K>(in + x - K::radius, std::make_index_sequence<K::size>()));
+            }
+        }
+
+        /**
+         * @brief out[x] = min(255, horizontal sum / Divisor) for a kernel without negative taps.
+         *
+         * @p in holds non-negative values read as unsigned 16-bit, and every sum must be below 65536.
+         */
+        template <class K, int Divisor>
+        static void alongToBytes(const std::int16_t* in, int count, unsigned char* out)
+        {
+            checkAlong<K>();
+            checkDivisor<K, Divisor, 65535>();
+            const std::uint16_t* values = reinterpret_cast<const std::uint16_t*>(in);
+            for (int x = 0; x < count; ++x) {
+                const int sum = dotAlong<K>(values + x - K::radius, std::make_index_sequence<K::size>());
+                out[x] = toByte(sum / Divisor);
+            }
+        }
+    };
+
+#if defined(STENCIL_SIMD_X86)
+    /**
+     * @brief SSE2 passes: 16 entries per step, then the scalar pass for the tail.
+     */
+    struct Sse2 {
+        template <class K>
+        static void columns(const unsigned char* const* rows, int count, std::int16_t* out)
+        {
+            checkColumns<K>();
+            int x = 0;
+            for (; x + 16 <= count; x += 16) {
+                __m128i lo, hi;
+                columnSums16<K>(rows, x, lo, hi);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), lo);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x + 8), hi);
+            }
+            Scalar::columns<K>(offsetRows<K>(rows, x).data(), count - x, out + x);
+        }
+
+        template <class K, int Divisor = 1, int Bias = 0>
+        static void columnsToBytes(const unsigned char* const* rows, int count, unsigned char* out)
+        {
+            checkColumns<K>();
+            checkDivisor<K, Divisor, 255 * K::positive>();
+            checkBias<K, Divisor, Bias>();
+            const __m128i bias = _mm_set1_epi16(Bias);
+            int x = 0;
+            for (; x + 16 <= count; x += 16) {
+                __m128i lo, hi;
+                columnSums16<K>(rows, x, lo, hi);
+                lo = _mm_add_epi16(divide<K, Divisor>(lo), bias);
+                hi = _mm_add_epi16(divide<K, Divisor>(hi), bias);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_packus_epi16(lo, hi));
+            }
+            Scalar::columnsToBytes<K, Divisor, Bias>(offsetRows<K>(rows, x).data(), count - x, out + x);
+        }
+
+        template <class K>
+        static void along(const std::int16_t* in, int count, std::int16_t* out)
+        {
+            checkAlong<K>();
+            int x = 0;
+            for (; x + 8 <= count; x += 8) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), alongSums8<K>(in + x - K::radius));
+            }
+            Scalar::along<K>(in + x, count - x, out + x);
+        }
+
+        template <class K, int Divisor>
+        static void alongToBytes(const std::int16_t* in, int count, unsigned char* out)
+        {
+            checkAlong<K>();
+            checkDivisor<K, Divisor, 65535>();
+            int x = 0;
+            for (; x + 16 <= count; x += 16) {
+                const __m128i lo = unsignedDivide<Divisor>(alongSums8<K>(in + x - K::radius));
+                const __m128i hi = unsignedDivide<Divisor>(alongSums8<K>(in + x + 8 - K::radius));
+                // Quotients above 32767 (Divisor 1 only) would saturate to 0; clamp to 255 first
+                const __m128i cap = _mm_set1_epi16(255);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+                                 _mm_packus_epi16(minUnsigned(lo, cap), minUnsigned(hi, cap)));
+            }
+            Scalar::alongToBytes<K, Divisor>(in + x, count - x, out + x);
+        }
+
+    private:
+        /// acc + Tap * v, with the multiply reduced to shifts where possible.
+        template <int Tap>
+        static __m128i accumulate(__m128i acc, __m128i v)
+        {
+            if constexpr (Tap == 0) {
+                return acc;
+            } else if constexpr (Tap < 0) {
+                return _mm_sub_epi16(acc, scaled<-Tap>(v));
+            } else {
+                return _mm_add_epi16(acc, scaled<Tap>(v));
+            }
+        }
+
+        template <int Factor>
+        static __m128i scaled(__m128i v)
+        {
+            if constexpr (Factor == 1) {
+                return v;
+            } else if constexpr (isPowerOfTwo(Factor)) {
+                return _mm_slli_epi16(v, log2(Factor));
+            } else {
+                return _mm_mullo_epi16(v, _mm_set1_epi16(static_cast<short>(Factor)));
+            }
+        }
+
+        template <class K, std::size_t... I>
+        static __m128i fold(const __m128i* values, std::index_sequence<I...>)
+        {
+            __m128i acc = _mm_setzero_si128();
+            ((acc = accumulate<K::taps[I]>(acc, values[I])), ...);
+            return acc;
+        }
+
+        template <class K>
+        static void columnSums16(const unsigned char* const* rows, int x, __m128i& lo, __m128i& hi)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i low[K::size], high[K::size];
+            for (int i = 0; i < K::size; ++i) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[i] + x));
+                low[i] = _mm_unpacklo_epi8(v, zero);
+                high[i] = _mm_unpackhi_epi8(v, zero);
+            }
+            lo = fold<K>(low, std::make_index_sequence<K::size>());
+            hi = fold<K>(high, std::make_index_sequence<K::size>());
+        }
+
+        template <class K>
+        static __m128i alongSums8(const std::int16_t* first)
+        {
+            __m128i values[K::size];
+            for (int i = 0; i < K::size; ++i) {
+                values[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+            }
+            return fold<K>(values, std::make_index_sequence<K::size>());
+        }
+
+        /// floor(v / Divisor) of signed sums (power-of-two divisors) or non-negative ones.
+        template <class K, int Divisor>
+        static __m128i divide(__m128i v)
+        {
+            if constexpr (K::negative > 0) {
+                return Divisor == 1 ? v : _mm_srai_epi16(v, log2(Divisor));
+            } else {
+                return unsignedDivide<Divisor>(v);
+            }
+        }
+
+        template <int Divisor>
+        static __m128i unsignedDivide(__m128i v)
+        {
+            if constexpr (Divisor == 1) {
+                return v;
+            } else if constexpr (isPowerOfTwo(Divisor)) {
+                return _mm_srli_epi16(v, log2(Divisor));
+            } else {
+                return _mm_mulhi_epu16(v, _mm_set1_epi16(static_cast<short>(reciprocal(Divisor))));
+            }
+        }
+
+        /// Unsigned 16-bit minimum (SSE2 only has the signed one).
+        static __m128i minUnsigned(__m128i v, __m128i cap)
+        {
+            const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+            return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(v, flip), _mm_xor_si128(cap, flip)), flip);
+        }
+    };
+#endif // STENCIL_SIMD_X86
+
+    /**
+     * @brief Scalar::columns() or Sse2::columns(), as simd() selects; the other passes dispatch the same way.
+     */
+    template <class K>
+    static void columns(const unsigned char* const* rows, int count, std::int16_t* out)
+    {
+#if defined(STENCIL_SIMD_X86)
+        if (simd()) return Sse2::columns<K>(rows, count, out);
+#endif
+        Scalar::columns<K>(rows, count, out);
+    }
+
+    template <class K, int Divisor = 1, int Bias = 0>
+    static void columnsToBytes(const unsigned char* const* rows, int count, unsigned char* out)
+    {
+#if defined(STENCIL_SIMD_X86)
+        if (simd()) return Sse2::columnsToBytes<K, Divisor, Bias>(rows, count, out);
+#endif
+        Scalar::columnsToBytes<K, Divisor, Bias>(rows, count, out);
+    }
+
+    template <class K>
+    static void along(const std::int16_t* in, int count, std::int16_t* out)
+    {
+#if defined(STENCIL_SIMD_X86)
+        if (simd()) return Sse2::along<K>(in, count, out);
+#endif
+        Scalar::along<K>(in, count, out);
+    }
+
+    template <class K, int Divisor>
+    static void alongToBytes(const std::int16_t* in, int count, unsigned char* out)
+    {
+#if defined(STENCIL_SIMD_X86)
+        if (simd()) return Sse2::alongToBytes<K, Divisor>(in, count, out);
+#endif
+        Scalar::alongToBytes<K, Divisor>(in, count, out);
+    }
+
+    /**
+     * @brief The last Rows rows of a plane, each padded with copies of its edge entries.
+     *
+     * Rows are addressed by image row and filled on first use, so a stencil
+     * asks for rows y - r .. y + r and only the new one is computed. Row
+     * pointers stay valid until Rows newer rows have been fetched.
+     */
+    template <typename T, int Rows>
+    class RowRing {
+    public:
+        RowRing(int width, int pad)
+            : width(width), pad(pad), stride(static_cast<std::size_t>(width) + 2 * static_cast<std::size_t>(pad)),
+              storage(stride * Rows)
+        {
+            std::fill(std::begin(loaded), std::end(loaded), -1);
+        }
+
+        /**
+         * @brief Row @p y (not negative), calling @p fill(row) with its first entry if it is not loaded.
+         */
+        template <typename Fill>
+        T* fetch(int y, const Fill& fill)
+        {
+            const int slot = y % Rows;
+            T* row = storage.data() + stride * static_cast<std::size_t>(slot) + pad;
+            if (loaded[slot] != y) {
+                fill(row);
+                for (int i = 1; i <= pad; ++i) {
+                    row[-i] = row[0];
+                    row[width - 1 + i] = row[width - 1];
+                }
+                loaded[slot] = y;
+            }
+            return row;
+        }
+
+    private:
+        int width;
+        int pad;
+        std::size_t stride;
+        std::vector<T> storage;
+        int loaded[Rows];
+    };
+
+private:
+    static constexpr bool isPowerOfTwo(int value) { return value > 0 && (value & (value - 1)) == 0; }
+
+    static constexpr int log2(int value) { return value > 1 ? 1 + log2(value / 2) : 0; }
+
+    /// 16-bit multiplier m with (v * m) >> 16 == v / divisor for the sums checkDivisor() allows.
+    static constexpr int reciprocal(int divisor) { return (65536 + divisor - 1) / divisor; }
+
+    static constexpr bool reciprocalExact(int divisor, int maxSum)
+    {
+        for (int v = 0; v <= maxSum; ++v) {
+            if (((static_cast<long long>(v) * reciprocal(divisor)) >> 16) != v / divisor) return false;
+        }
+        return true;
+    }
+
+    template <class K>
+    static constexpr void checkColumns()
+    {
+        static_assert(255 * (K::positive + K::negative) <= 32767, "Column sums of bytes must fit 16 bits");
+    }
+
+    template <class K>
+    static constexpr void checkAlong()
+    {
+        static_assert(K::size % 2 == 1, "Horizontal kernels need an odd number of taps");
+    }
+
+    template <class K, int Divisor, int Bias>
+    static constexpr void checkBias()
+    {
+        static_assert(255 * K::positive / Divisor + Bias <= 32767 && Bias - 255 * K::negative / Divisor >= -32768,
+                      "Biased quotients must fit 16 bits");
+    }
+
+    template <class K, int Divisor, int MaxSum>
+    static constexpr void checkDivisor()
+    {
+        static_assert(Divisor >= 1, "Divisor must be positive");
+        static_assert(isPowerOfTwo(Divisor) || (K::negative == 0 && reciprocalExact(Divisor, MaxSum)),
+                      "Divisors other than powers of two need non-negative sums and an exact reciprocal");
+    }
+
+    template <int Divisor>
+    static int floorDivide(int sum)
+    {
+        if constexpr (isPowerOfTwo(Divisor)) {
+            return sum >> log2(Divisor); // arithmetic shift: floor for negative sums too
+        } else {
+            return sum / Divisor;        // sums are non-negative here
+        }
+    }
+
+    static unsigned char toByte(int value) { return static_cast<unsigned char>(std::clamp(value, 0, 255)); }
+
+    template <class K, std::size_t... I>
+    static int dotRows(const unsigned char* const* rows, int x, std::index_sequence<I...>)
+    {
+        return ((K::taps[I] * rows[I][x]) + ...);
+    }
+
+    template <class K, typename T, std::size_t... I>
+    static int dotAlong(const T* first, std::index_sequence<I...>)
+    {
+        return ((K::taps[I] * first[I]) + ...);
+    }
+
+    template <class K>
+    static std::array<const unsigned char*, K::size> offsetRows(const unsigned char* const* rows, int x)
+    {
+        std::array<const unsigned char*, K::size> moved{};
+        for (int i = 0; i < K::size; ++i) moved[static_cast<std::size_t>(i)] = rows[i] + x;
+        return moved;
+    }
+};
+
+#endif // STENCIL_H
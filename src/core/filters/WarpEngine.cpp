@@ -0,0 +1,509 @@
+/**
+ * @file WarpEngine.cpp
+ * @brief Implementation of the coordinate-map warps and quarter-turn rotation.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "WarpEngine.h"
+#include "../parallel/ThreadPool.h"
+#include "../simd/PointKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PHOTOSMITH_SIMD_X86 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PHOTOSMITH_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PHOTOSMITH_TARGET(isa)
+#endif
+
+namespace {
+
+constexpr int kFractionBits = 7;                // Tap weights in 1/128 pixel
+constexpr int kOne = 1 << kFractionBits;
+constexpr std::size_t kCacheBytes = std::size_t(128) << 20;
+constexpr int kBlock = 32;                      // rotate90() block edge in pixels
+
+enum MapKind { RotationMap, SkewMap, FishEyeMap };
+
+/**
+ * @brief Splits a source coordinate in 1/128 pixel (not negative) into a clamped tap and its fraction.
+ */
+inline void fixedTap(std::int64_t position, int size, int& tap, int& fraction)
+{
+    tap = static_cast<int>(position >> kFractionBits);
+    fraction = static_cast<int>(position & (kOne - 1));
+    if (size == 1) {
+        tap = 0;
+        fraction = 0;
+    } else if (tap >= size - 1) {
+        // Past the last pixel centre: both taps on the edge pixel
+        tap = size - 2;
+        fraction = kOne;
+    }
+}
+
+/**
+ * @brief Writes the table entries of one destination pixel.
+ */
+inline void tableEntry(std::int64_t x, std::int64_t y, int sourceWidth, int sourceHeight, std::uint32_t& offset,
+                       std::uint16_t& fractions)
+{
+    int tapX, tapY, fx, fy;
+    fixedTap(x, sourceWidth, tapX, fx);
+    fixedTap(y, sourceHeight, tapY, fy);
+    offset = (static_cast<std::uint32_t>(tapY) * static_cast<std::uint32_t>(sourceWidth)
+              + static_cast<std::uint32_t>(tapX)) * 3;
+    fractions = static_cast<std::uint16_t>(fx | (fy << 8));
+}
+
+/**
+ * @brief Expands one row of an affine map into table entries.
+ */
+void expandRow(const WarpEngine::Map& map, int y, std::uint32_t* offsets, std::uint16_t* fractions)
+{
+    constexpr int toFraction = 32 - kFractionBits;
+    constexpr std::int64_t half = std::int64_t(1) << (toFraction - 1);
+    const WarpEngine::Map::Row& row = map.rows[static_cast<std::size_t>(y)];
+    const std::int64_t limitX = static_cast<std::int64_t>(map.sourceWidth) << 32;
+    const std::int64_t limitY = static_cast<std::int64_t>(map.sourceHeight) << 32;
+    std::int64_t sx = row.x;
+    std::int64_t sy = row.y;
+    for (int x = 0; x < map.width; ++x, sx += row.stepX, sy += row.stepY) {
+        if (sx < 0 || sx >= limitX || sy < 0 || sy >= limitY) {
+            offsets[x] = WarpEngine::Map::outside;
+            fractions[x] = 0;
+            continue;
+        }
+        tableEntry((sx + half) >> toFraction, (sy + half) >> toFraction, map.sourceWidth, map.sourceHeight,
+                   offsets[x], fractions[x]);
+    }
+}
+
+/**
+ * @brief Bilinear blend of one pixel; the reference the SIMD kernel matches exactly.
+ */
+inline void samplePixel(const unsigned char* p, std::ptrdiff_t stepX, std::ptrdiff_t stepY, int fx, int fy,
+                        unsigned char* out)
+{
+    for (int c = 0; c < 3; ++c) {
+        const int top = p[c] * (kOne - fx) + p[c + stepX] * fx;
+        const int bottom = p[c + stepY] * (kOne - fx) + p[c + stepY + stepX] * fx;
+        out[c] = static_cast<unsigned char>((top * (kOne - fy) + bottom * fy + (1 << 13)) >> 14);
+    }
+}
+
+struct RowJob {
+    const unsigned char* base;
+    std::size_t sourceBytes;
+    std::ptrdiff_t stepX;
+    std::ptrdiff_t stepY;
+    unsigned char background;
+};
+
+void sampleRowScalar(const RowJob& job, const std::uint32_t* offsets, const std::uint16_t* fractions, int count,
+                     unsigned char* out)
+{
+    for (int x = 0; x < count; ++x, out += 3) {
+        if (offsets[x] == WarpEngine::Map::outside) {
+            out[0] = out[1] = out[2] = job.background;
+            continue;
+        }
+        samplePixel(job.base + offsets[x], job.stepX, job.stepY, fractions[x] & 0xFF, fractions[x] >> 8, out);
+    }
+}
+
+#if defined(PHOTOSMITH_SIMD_X86)
+inline std::uint32_t load32(const unsigned char* p)
+{
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief SSE2 bilinear sampling: the four taps of a pixel in one register.
+ *
+ * Each tap is loaded as 4 bytes (RGB plus the next byte, ignored), so pixels
+ * whose last tap ends the buffer fall back to samplePixel().
+ */
+PHOTOSMITH_TARGET("sse2")
+void sampleRowSse2(const RowJob& job, const std::uint32_t* offsets, const std::uint16_t* fractions, int count,
+                   unsigned char* out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << 13);
+    const std::size_t reach = static_cast<std::size_t>(job.stepX + job.stepY) + 4;
+    const bool tiny = job.sourceBytes < reach;
+    const std::size_t lastSafe = tiny ? 0 : job.sourceBytes - reach;
+    for (int x = 0; x < count; ++x, out += 3) {
+        const std::uint32_t offset = offsets[x];
+        const int fx = fractions[x] & 0xFF;
+        const int fy = fractions[x] >> 8;
+        if (offset == WarpEngine::Map::outside) {
+            out[0] = out[1] = out[2] = job.background;
+            continue;
+        }
+        const unsigned char* p = job.base + offset;
+        if (tiny || offset > lastSafe) {
+            samplePixel(p, job.stepX, job.stepY, fx, fy, out);
+            continue;
+        }
+        // 16-bit lanes: [left r g b _ right r g b _] for the top and bottom tap pairs
+        __m128i top = _mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(load32(p))),
+                                         _mm_cvtsi32_si128(static_cast<int>(load32(p + job.stepX))));
+        __m128i bottom = _mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(load32(p + job.stepY))),
+                                            _mm_cvtsi32_si128(static_cast<int>(load32(p + job.stepY + job.stepX))));
+        const __m128i wx = _mm_set_epi16(static_cast<short>(fx), static_cast<short>(fx), static_cast<short>(fx),
+                                         static_cast<short>(fx), static_cast<short>(kOne - fx),
+                                         static_cast<short>(kOne - fx), static_cast<short>(kOne - fx),
+                                         static_cast<short>(kOne - fx));
+        top = _mm_mullo_epi16(_mm_unpacklo_epi8(top, zero), wx);
+        bottom = _mm_mullo_epi16(_mm_unpacklo_epi8(bottom, zero), wx);
+        top = _mm_add_epi16(top, _mm_srli_si128(top, 8));          // at most 255 * 128, fits int16
+        bottom = _mm_add_epi16(bottom, _mm_srli_si128(bottom, 8));
+        __m128i sum = _mm_madd_epi16(_mm_unpacklo_epi16(top, bottom), _mm_set1_epi32((fy << 16) | (kOne - fy)));
+        sum = _mm_srli_epi32(_mm_add_epi32(sum, round), 14);
+        sum = _mm_packs_epi32(sum, sum);
+        const std::uint32_t rgb = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(sum, sum)));
+        out[0] = static_cast<unsigned char>(rgb);
+        out[1] = static_cast<unsigned char>(rgb >> 8);
+        out[2] = static_cast<unsigned char>(rgb >> 16);
+    }
+}
+#endif
+
+/**
+ * @brief Fast path for affine rows that are a pure horizontal shift (skew).
+ *
+ * With one source pixel per destination pixel and no vertical fraction, the
+ * row is a single 1-D blend of contiguous bytes with one weight, which the
+ * compiler vectorises. Bit-exact with the general kernel.
+ *
+ * @return false if the row is not a pure shift and needs the general path
+ */
+bool shiftRow(const WarpEngine::Map& map, int y, const RowJob& job, std::ptrdiff_t stride, unsigned char* out)
+{
+    constexpr std::int64_t one = std::int64_t(1) << 32;
+    constexpr int toFraction = 32 - kFractionBits;
+    constexpr std::int64_t half = std::int64_t(1) << (toFraction - 1);
+    const WarpEngine::Map::Row& row = map.rows[static_cast<std::size_t>(y)];
+    if (row.stepX != one || row.stepY != 0) return false;
+    const std::int64_t positionY = (row.y + half) >> toFraction;
+    if ((positionY & (kOne - 1)) != 0) return false;
+
+    const std::size_t rowBytes = static_cast<std::size_t>(map.width) * 3;
+    if (row.y < 0 || row.y >= (static_cast<std::int64_t>(map.sourceHeight) << 32)) {
+        std::memset(out, job.background, rowBytes);
+        return true;
+    }
+    const unsigned char* source = job.base + (positionY >> kFractionBits) * stride;
+
+    // Destination pixels whose source point lies in [0, sourceWidth)
+    const auto ceilDiv = [](std::int64_t value) { return value >= 0 ? (value + one - 1) / one : -((-value) / one); };
+    const int first = static_cast<int>(std::clamp<std::int64_t>(ceilDiv(-row.x), 0, map.width));
+    const int end = static_cast<int>(
+        std::clamp<std::int64_t>(ceilDiv((static_cast<std::int64_t>(map.sourceWidth) << 32) - row.x), first, map.width));
+    // Source tap of destination pixel x is firstTap + x; from lastTapAt on both taps are the edge pixel
+    const std::int64_t positionX = (row.x + half) >> toFraction;
+    const int fx = static_cast<int>(positionX & (kOne - 1));
+    const std::int64_t firstTap = positionX >> kFractionBits;
+    const int lastTapAt = static_cast<int>(std::clamp<std::int64_t>(map.sourceWidth - 1 - firstTap, first, end));
+
+    std::memset(out, job.background, static_cast<std::size_t>(first) * 3);
+    const unsigned char* s = source + (firstTap + first) * 3;
+    unsigned char* d = out + static_cast<std::size_t>(first) * 3;
+    const int blended = (lastTapAt - first) * 3;
+    if (fx == 0) {
+        std::memcpy(d, s, static_cast<std::size_t>(blended));
+    } else {
+        for (int i = 0; i < blended; ++i) {
+            d[i] = static_cast<unsigned char>((s[i] * (kOne - fx) + s[i + 3] * fx + kOne / 2) >> kFractionBits);
+        }
+    }
+    const unsigned char* edge = source + static_cast<std::size_t>(map.sourceWidth - 1) * 3;
+    for (int x = lastTapAt; x < end; ++x) std::memcpy(out + static_cast<std::size_t>(x) * 3, edge, 3);
+    std::memset(out + static_cast<std::size_t>(end) * 3, job.background, rowBytes - static_cast<std::size_t>(end) * 3);
+    return true;
+}
+
+using SampleRow = void (*)(const RowJob&, const std::uint32_t*, const std::uint16_t*, int, unsigned char*);
+
+SampleRow sampleRow()
+{
+#if defined(PHOTOSMITH_SIMD_X86)
+    // PHOTOSMITH_SIMD=scalar disables this kernel too; any x86 level PointKernels picks includes SSE2
+    static const SampleRow kernel = std::strcmp(PointKernels::activeIsa(), "scalar") == 0 ? sampleRowScalar
+                                                                                          : sampleRowSse2;
+    return kernel;
+#else
+    return sampleRowScalar;
+#endif
+}
+
+} // namespace
+
+std::shared_ptr<const WarpEngine::Map> WarpEngine::build(int width, int height, int sourceWidth, int sourceHeight,
+                                                         const SourceRow& sourceRow)
+{
+    if (static_cast<std::uint64_t>(sourceWidth) * sourceHeight * 3 >= Map::outside) {
+        throw std::length_error("Image too large to warp (over 4 GB)");
+    }
+    auto map = std::make_shared<Map>();
+    map->width = std::max(0, width);
+    map->height = std::max(0, height);
+    map->sourceWidth = sourceWidth;
+    map->sourceHeight = sourceHeight;
+    const std::size_t count = static_cast<std::size_t>(map->width) * map->height;
+    map->offsets.resize(count);
+    map->fractions.resize(count);
+
+    ThreadPool::instance().parallelRows(map->height, [&](int rowBegin, int rowEnd) {
+        std::vector<double> xs(static_cast<std::size_t>(map->width));
+        std::vector<double> ys(static_cast<std::size_t>(map->width));
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            sourceRow(y, xs.data(), ys.data());
+            std::uint32_t* offsets = map->offsets.data() + static_cast<std::size_t>(y) * map->width;
+            std::uint16_t* fractions = map->fractions.data() + static_cast<std::size_t>(y) * map->width;
+            for (int x = 0; x < map->width; ++x) {
+                const double sx = xs[x];
+                const double sy = ys[x];
+                if (!(sx >= 0.0 && sx < sourceWidth && sy >= 0.0 && sy < sourceHeight)) {
+                    offsets[x] = Map::outside;
+                    fractions[x] = 0;
+                    continue;
+                }
+                tableEntry(static_cast<std::int64_t>(sx * kOne + 0.5), static_cast<std::int64_t>(sy * kOne + 0.5),
+                           sourceWidth, sourceHeight, offsets[x], fractions[x]);
+            }
+        }
+    });
+    return map;
+}
+
+std::shared_ptr<const WarpEngine::Map> WarpEngine::affine(int width, int height, int sourceWidth, int sourceHeight,
+                                                          const double matrix[6])
+{
+    if (static_cast<std::uint64_t>(sourceWidth) * sourceHeight * 3 >= Map::outside) {
+        throw std::length_error("Image too large to warp (over 4 GB)");
+    }
+    auto map = std::make_shared<Map>();
+    map->width = std::max(0, width);
+    map->height = std::max(0, height);
+    map->sourceWidth = sourceWidth;
+    map->sourceHeight = sourceHeight;
+    map->rows.resize(static_cast<std::size_t>(map->height));
+
+    // 32 fractional bits: the steps summed across even a very wide row drift far below 1/128 pixel
+    const double unit = 4294967296.0;
+    for (int y = 0; y < map->height; ++y) {
+        Map::Row& row = map->rows[static_cast<std::size_t>(y)];
+        row.x = std::llround((matrix[1] * y + matrix[2]) * unit);
+        row.y = std::llround((matrix[4] * y + matrix[5]) * unit);
+        row.stepX = std::llround(matrix[0] * unit);
+        row.stepY = std::llround(matrix[3] * unit);
+    }
+    return map;
+}
+
+std::shared_ptr<const WarpEngine::Map> WarpEngine::cached(int kind, int sourceWidth, int sourceHeight,
+                                                          double parameter,
+                                                          const std::function<std::shared_ptr<const Map>()>& make)
+{
+    struct Entry {
+        int kind;
+        int width;
+        int height;
+        double parameter;
+        std::shared_ptr<const Map> map;
+    };
+    static std::mutex mutex;
+    static std::list<Entry> entries; // Most recently used first
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->kind == kind && it->width == sourceWidth && it->height == sourceHeight
+                && it->parameter == parameter) {
+                entries.splice(entries.begin(), entries, it);
+                return it->map;
+            }
+        }
+    }
+
+    // Built outside the lock: two threads missing together both build, one copy is kept
+    std::shared_ptr<const Map> map = make();
+    if (map->bytes() > kCacheBytes) return map;
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_front(Entry{kind, sourceWidth, sourceHeight, parameter, map});
+    std::size_t total = 0;
+    for (auto it = entries.begin(); it != entries.end();) {
+        total += it->map->bytes();
+        it = total > kCacheBytes ? entries.erase(it) : std::next(it);
+    }
+    return map;
+}
+
+std::shared_ptr<const WarpEngine::Map> WarpEngine::rotation(int sourceWidth, int sourceHeight, double degrees)
+{
+    return cached(RotationMap, sourceWidth, sourceHeight, degrees, [=]() {
+        const double angleRad = degrees * M_PI / 180.0;
+        const double cosAngle = std::cos(angleRad);
+        const double sinAngle = std::sin(angleRad);
+        const double centerX = sourceWidth / 2.0;
+        const double centerY = sourceHeight / 2.0;
+
+        // Bounding box of the rotated corners
+        const double corners[4][2] = {{-centerX, -centerY}, {sourceWidth - centerX, -centerY},
+                                      {sourceWidth - centerX, sourceHeight - centerY}, {-centerX, sourceHeight - centerY}};
+        double minX = 0, maxX = 0, minY = 0, maxY = 0;
+        for (int i = 0; i < 4; ++i) {
+            const double rotX = corners[i][0] * cosAngle - corners[i][1] * sinAngle;
+            const double rotY = corners[i][0] * sinAngle + corners[i][1] * cosAngle;
+            minX = i == 0 ? rotX : std::min(minX, rotX);
+            maxX = i == 0 ? rotX : std::max(maxX, rotX);
+            minY = i == 0 ? rotY : std::min(minY, rotY);
+            maxY = i == 0 ? rotY : std::max(maxY, rotY);
+        }
+        const int newWidth = static_cast<int>(std::ceil(maxX - minX));
+        const int newHeight = static_cast<int>(std::ceil(maxY - minY));
+        const double newCenterX = newWidth / 2.0;
+        const double newCenterY = newHeight / 2.0;
+
+        // Inverse rotation about the centres: destination pixel to source point
+        const double matrix[6] = {cosAngle, sinAngle, centerX - cosAngle * newCenterX - sinAngle * newCenterY,
+                                  -sinAngle, cosAngle, centerY + sinAngle * newCenterX - cosAngle * newCenterY};
+        return affine(newWidth, newHeight, sourceWidth, sourceHeight, matrix);
+    });
+}
+
+std::shared_ptr<const WarpEngine::Map> WarpEngine::skew(int sourceWidth, int sourceHeight, double degrees)
+{
+    return cached(SkewMap, sourceWidth, sourceHeight, degrees, [=]() {
+        const double tanA = std::tan(degrees * M_PI / 180.0);
+
+        // Whole-pixel shift range over all rows sizes the canvas
+        int minShift = 0;
+        int maxShift = 0;
+        if (sourceHeight > 0) {
+            const int shiftBottom = static_cast<int>(std::floor(tanA * (sourceHeight - 1)));
+            minShift = std::min(0, shiftBottom);
+            maxShift = std::max(0, shiftBottom);
+        }
+        const int newWidth = std::max(1, sourceWidth + (maxShift - minShift));
+
+        // Each row moves by its exact, sub-pixel shift
+        const double matrix[6] = {1.0, -tanA, static_cast<double>(minShift), 0.0, 1.0, 0.0};
+        return affine(newWidth, sourceHeight, sourceWidth, sourceHeight, matrix);
+    });
+}
+
+std::shared_ptr<const WarpEngine::Map> WarpEngine::fishEye(int width, int height)
+{
+    return cached(FishEyeMap, width, height, 0.0, [=]() {
+        const double centerX = width / 2.0;
+        const double centerY = height / 2.0;
+        const double radius = std::min(centerX, centerY);
+        return build(width, height, width, height, [=](int y, double* xs, double* ys) {
+            const double dy = (y - centerY) / radius;
+            for (int x = 0; x < width; ++x) {
+                const double dx = (x - centerX) / radius;
+                const double squared = dx * dx + dy * dy;
+                if (squared < 1.0 && squared > 0.0) {
+                    // Radial distance r becomes r^0.75, i.e. scaled by r^-0.25: the centre is magnified, the rim kept
+                    const double scale = radius / std::sqrt(std::sqrt(std::sqrt(squared)));
+                    xs[x] = std::clamp(centerX + dx * scale, 0.0, width - 1.0);
+                    ys[x] = std::clamp(centerY + dy * scale, 0.0, height - 1.0);
+                } else {
+                    xs[x] = x;
+                    ys[x] = y;
+                }
+            }
+        });
+    });
+}
+
+bool WarpEngine::apply(const Map& map, const ConstImageView& src, const ImageView& dst, unsigned char background,
+                       const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    if (src.width != map.sourceWidth || src.height != map.sourceHeight || dst.width != map.width
+        || dst.height != map.height) {
+        throw std::invalid_argument("Warp map does not match the image size");
+    }
+    if (src.channels != 3 || dst.channels != 3) throw std::invalid_argument("Warps need 3-channel images");
+    if (dst.empty()) return true;
+    if (src.empty()) {
+        for (int y = 0; y < dst.height; ++y) std::memset(dst.row(y), background, static_cast<std::size_t>(dst.rowBytes()));
+        return true;
+    }
+    if (!src.isContiguous()) throw std::invalid_argument("Warp source rows must be contiguous");
+
+    const RowJob job{src.data, static_cast<std::size_t>(src.stride) * src.height, src.width > 1 ? 3 : 0,
+                     src.height > 1 ? src.stride : 0, background};
+    const SampleRow kernel = sampleRow();
+    return ThreadPool::instance().parallelRows(map.height, [&](int rowBegin, int rowEnd) {
+        if (map.affine()) {
+            // Expanded a row at a time into a small table that stays in cache
+            std::vector<std::uint32_t> offsets(static_cast<std::size_t>(map.width));
+            std::vector<std::uint16_t> fractions(static_cast<std::size_t>(map.width));
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                if (shiftRow(map, y, job, src.stride, dst.row(y))) continue;
+                expandRow(map, y, offsets.data(), fractions.data());
+                kernel(job, offsets.data(), fractions.data(), map.width, dst.row(y));
+            }
+            return;
+        }
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const std::size_t first = static_cast<std::size_t>(y) * map.width;
+            kernel(job, map.offsets.data() + first, map.fractions.data() + first, map.width, dst.row(y));
+        }
+    }, cancelRequested, progress);
+}
+
+void WarpEngine::rotate90(const ConstImageView& src, const ImageView& dst, bool clockwise)
+{
+    if (dst.width != src.height || dst.height != src.width) {
+        throw std::invalid_argument("Quarter-turn destination must be src.height x src.width");
+    }
+    if (src.channels != 3 || dst.channels != 3) throw std::invalid_argument("Quarter turns need 3-channel images");
+    if (src.empty()) return;
+
+    // One band is a row of blocks; each block reads kBlock source rows and writes kBlock destination rows
+    ThreadPool::instance().parallelRows(dst.height, [&](int rowBegin, int rowEnd) {
+        for (int blockY = rowBegin; blockY < rowEnd; blockY += kBlock) {
+            const int blockYEnd = std::min(blockY + kBlock, rowEnd);
+            for (int blockX = 0; blockX < dst.width; blockX += kBlock) {
+                const int blockXEnd = std::min(blockX + kBlock, dst.width);
+                for (int y = blockY; y < blockYEnd; ++y) {
+                    unsigned char* d = dst.pixelAt(blockX, y);
+                    // Clockwise: dst(x, y) = src(y, h - 1 - x); counter-clockwise: src(w - 1 - y, x)
+                    const unsigned char* s = clockwise ? src.pixelAt(y, src.height - 1 - blockX)
+                                                       : src.pixelAt(src.width - 1 - y, blockX);
+                    const std::ptrdiff_t step = clockwise ? -src.stride : src.stride;
+                    for (int x = blockX; x < blockXEnd; ++x, d += 3, s += step) {
+                        d[0] = s[0];
+                        d[1] = s[1];
+                        d[2] = s[2];
+                    }
+                }
+            }
+        }
+    }, nullptr, {}, kBlock);
+}
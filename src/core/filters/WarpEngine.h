@@ -0,0 +1,191 @@
+/**
+ * @file WarpEngine.h
+ * @brief Geometric warps through precomputed coordinate maps.
+ *
+ * This file declares the WarpEngine class, which implements rotation by
+ * arbitrary angles, skew and fish-eye as one operation: every destination
+ * pixel reads the source at a point given by a coordinate map. The map is
+ * computed once per image size and parameters, in fixed point, and reused;
+ * applying it is then pure bilinear interpolation with no trigonometry.
+ *
+ * @details The engine provides:
+ * - Maps for rotate(), skew() and fishEye(), cached by size and parameters
+ * - apply(): bilinear sampling, SSE2 on x86 and scalar elsewhere, in
+ *   parallel row bands with progress and cancellation
+ * - rotate90(): quarter turns as a cache-blocked transpose
+ *
+ * @note The engine works on ImageView/ConstImageView and has no Qt dependency;
+ *       ImageFilters adapts it to the progress bar and cancel flag.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef WARPENGINE_H
+#define WARPENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../image/ImageView.h"
+
+/**
+ * @class WarpEngine
+ * @brief Static utility class building and applying warp coordinate maps.
+ *
+ * @code
+ * auto map = WarpEngine::rotation(image.width, image.height, 30.0);
+ * Image rotated(map->width, map->height);
+ * WarpEngine::apply(*map, image.constView(), rotated.view(), 0);
+ * @endcode
+ *
+ * @see ImageFilters::applyRotate(), ImageFilters::applySkew() and
+ *      ImageFilters::applyFishEye() for the reporting wrappers
+ */
+class WarpEngine {
+public:
+    /**
+     * @brief Progress callback, invoked on the calling thread between bands.
+     */
+    using RowProgress = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief Source position of every destination pixel, in fixed point.
+     *
+     * Affine warps (rotation, skew) store one source point and step per row,
+     * so the map is tiny and applying it only adds integers. Other warps store
+     * a table: per pixel, the top-left of the four source pixels around the
+     * sample point and its distance to them in 1/128 pixel. Taps are clamped
+     * to the image, so the four pixels always exist.
+     */
+    struct Map {
+        static constexpr std::uint32_t outside = 0xFFFFFFFFu; ///< Offset of pixels left as background
+
+        /**
+         * @brief Source point of a row's first pixel and the step per pixel, in 1/2^32 pixel.
+         */
+        struct Row {
+            std::int64_t x = 0;
+            std::int64_t y = 0;
+            std::int64_t stepX = 0;
+            std::int64_t stepY = 0;
+        };
+
+        int width = 0;        ///< Destination size
+        int height = 0;
+        int sourceWidth = 0;  ///< Source size the offsets were computed for
+        int sourceHeight = 0;
+        std::vector<Row> rows;                ///< Affine maps: one entry per destination row
+        std::vector<std::uint32_t> offsets;   ///< Table maps: byte offset of the top-left tap, or outside
+        std::vector<std::uint16_t> fractions; ///< Table maps: x fraction (0-128) in the low byte, y in the high byte
+
+        /**
+         * @brief True if the map is stored per row rather than per pixel.
+         */
+        bool affine() const { return !rows.empty(); }
+
+        /**
+         * @brief Memory held by the map.
+         */
+        std::size_t bytes() const
+        {
+            return rows.size() * sizeof(Row) + offsets.size() * sizeof(std::uint32_t)
+                   + fractions.size() * sizeof(std::uint16_t);
+        }
+    };
+
+    /**
+     * @brief Fills the source coordinates of destination row @p y.
+     *
+     * Points outside [0, sourceWidth) x [0, sourceHeight) become background.
+     */
+    using SourceRow = std::function<void(int y, double* sourceX, double* sourceY)>;
+
+    /**
+     * @brief Rotation by @p degrees around the centre, on a canvas fitting the rotated corners.
+     */
+    static std::shared_ptr<const Map> rotation(int sourceWidth, int sourceHeight, double degrees);
+
+    /**
+     * @brief Horizontal skew by @p degrees, on a canvas widened to fit every row.
+     */
+    static std::shared_ptr<const Map> skew(int sourceWidth, int sourceHeight, double degrees);
+
+    /**
+     * @brief Fish-eye magnification of the centre circle; the corners stay in place.
+     */
+    static std::shared_ptr<const Map> fishEye(int width, int height);
+
+    /**
+     * @brief Builds an uncached affine map: source = (m[0] x + m[1] y + m[2], m[3] x + m[4] y + m[5]).
+     *
+     * @param width Destination width
+     * @param height Destination height
+     * @param sourceWidth Width of the images the map will be applied to
+     * @param sourceHeight Height of the images the map will be applied to
+     * @param matrix Destination-to-source transform, row-major 2 x 3
+     * @throws std::length_error If the source is too large for 32-bit offsets (over 4 GB)
+     */
+    static std::shared_ptr<const Map> affine(int width, int height, int sourceWidth, int sourceHeight,
+                                             const double matrix[6]);
+
+    /**
+     * @brief Builds an uncached table map from an arbitrary per-row coordinate function.
+     *
+     * @param width Destination width
+     * @param height Destination height
+     * @param sourceWidth Width of the images the map will be applied to
+     * @param sourceHeight Height of the images the map will be applied to
+     * @param sourceRow Computes the source points of one row; called in parallel
+     * @throws std::length_error If the source is too large for 32-bit offsets (over 4 GB)
+     */
+    static std::shared_ptr<const Map> build(int width, int height, int sourceWidth, int sourceHeight,
+                                            const SourceRow& sourceRow);
+
+    /**
+     * @brief Samples @p src through @p map into @p dst.
+     *
+     * @param map Map built for the size of @p src
+     * @param src Source pixels (3 channels, contiguous rows)
+     * @param dst Destination of map.width x map.height; must not alias @p src
+     * @param background Grey level of pixels that map outside the source
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback
+     * @return true on completion, false if cancelled
+     * @throws std::invalid_argument If the sizes do not match the map, or either image is not 3-channel
+     */
+    static bool apply(const Map& map, const ConstImageView& src, const ImageView& dst, unsigned char background,
+                      const std::atomic<bool>* cancelRequested = nullptr, const RowProgress& progress = {});
+
+    /**
+     * @brief Rotates @p src by a quarter turn into @p dst (src.height x src.width).
+     *
+     * Copies square blocks so both the rows read and the columns written stay
+     * in cache, instead of striding through the whole destination per pixel.
+     *
+     * @param clockwise true for 90 degrees, false for 270
+     * @throws std::invalid_argument If @p dst is not src.height x src.width, or either image is not 3-channel
+     */
+    static void rotate90(const ConstImageView& src, const ImageView& dst, bool clockwise);
+
+private:
+    /**
+     * @brief Returns the cached map for a key, building and caching it on a miss.
+     *
+     * Recently used maps are kept up to a fixed byte budget.
+     */
+    static std::shared_ptr<const Map> cached(int kind, int sourceWidth, int sourceHeight, double parameter,
+                                             const std::function<std::shared_ptr<const Map>()>& make);
+};
+
+#endif // WARPENGINE_H
@@ -0,0 +1,143 @@
+/**
+ * @file CommandHistory.cpp
+ * @brief Implementation of the command-log undo/redo history.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "CommandHistory.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+CommandHistory::CommandHistory(std::size_t checkpointInterval, std::size_t byteBudget)
+    : interval(std::max<std::size_t>(1, checkpointInterval)), budget(byteBudget) {}
+
+void CommandHistory::clear()
+{
+    steps.clear();
+    checkpoints.clear();
+    checkpointBytes = 0;
+    first = 0;
+    cursor = 0;
+}
+
+void CommandHistory::record(const Image& before, Step step, const Image& after)
+{
+    if (checkpoints.empty()) {
+        clear();
+        addCheckpoint(0, before);
+    }
+
+    // A new edit discards the redo branch
+    steps.resize(cursor - first);
+    for (auto it = checkpoints.upper_bound(cursor); it != checkpoints.end();) {
+        checkpointBytes -= it->second.byteSize();
+        it = checkpoints.erase(it);
+    }
+
+    const bool replayable = static_cast<bool>(step.apply);
+    steps.push_back(std::move(step));
+    ++cursor;
+
+    const std::size_t lastCheckpoint = checkpoints.rbegin()->first;
+    if (!replayable || cursor - lastCheckpoint >= interval) {
+        addCheckpoint(cursor, after);
+    }
+    enforceBudget();
+}
+
+Image CommandHistory::stateAt(std::size_t index, const Image& current) const
+{
+    if (index < first || index > lastPosition()) {
+        throw std::out_of_range("History position out of range");
+    }
+    if (index == cursor) return current;
+
+    const auto exact = checkpoints.find(index);
+    if (exact != checkpoints.end()) return exact->second;
+
+    // One step back with an exact inverse, or one step forward: no replay needed
+    if (index + 1 == cursor && stepTo(cursor).inverse) {
+        Image image = current;
+        stepTo(cursor).inverse(image);
+        return image;
+    }
+    if (index == cursor + 1) {
+        Image image = current;
+        stepTo(index).apply(image);
+        return image;
+    }
+
+    // Replay from the nearest checkpoint at or before index, or from the current
+    // state if it lies in between (every step after a checkpoint is replayable)
+    auto base = std::prev(checkpoints.upper_bound(index));
+    std::size_t from = base->first;
+    Image image = base->second;
+    if (cursor < index && cursor > from) {
+        from = cursor;
+        image = current;
+    }
+    for (std::size_t i = from + 1; i <= index; ++i) {
+        stepTo(i).apply(image);
+    }
+    return image;
+}
+
+void CommandHistory::moveTo(std::size_t index, const Image& state)
+{
+    if (index < first || index > lastPosition()) {
+        throw std::out_of_range("History position out of range");
+    }
+    cursor = index;
+    // The caller holds this image anyway, so caching it costs nothing until it moves on
+    if (checkpoints.find(index) == checkpoints.end()) {
+        addCheckpoint(index, state);
+        enforceBudget();
+    }
+}
+
+void CommandHistory::addCheckpoint(std::size_t index, const Image& state)
+{
+    auto [it, inserted] = checkpoints.emplace(index, state); // O(1): shares the buffer copy-on-write
+    if (!inserted) {
+        checkpointBytes -= it->second.byteSize();
+        it->second = state;
+    }
+    checkpointBytes += state.byteSize();
+}
+
+void CommandHistory::enforceBudget()
+{
+    // First thin out checkpoints that only shorten replays, oldest first
+    for (auto it = checkpoints.begin(); checkpointBytes > budget && it != checkpoints.end();) {
+        const bool optional = it->first > first && it->first != cursor && stepTo(it->first).apply;
+        if (!optional) {
+            ++it;
+            continue;
+        }
+        checkpointBytes -= it->second.byteSize();
+        it = checkpoints.erase(it);
+    }
+
+    // Then drop the oldest part of the history, one checkpoint span at a time
+    while (checkpointBytes > budget && checkpoints.size() > 1) {
+        const auto oldest = checkpoints.begin();
+        const std::size_t next = std::next(oldest)->first;
+        if (next > cursor) break;
+
+        checkpointBytes -= oldest->second.byteSize();
+        checkpoints.erase(oldest);
+        steps.erase(steps.begin(), steps.begin() + static_cast<std::ptrdiff_t>(next - first));
+        first = next;
+    }
+}
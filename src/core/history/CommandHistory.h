@@ -0,0 +1,197 @@
+/**
+ * @file CommandHistory.h
+ * @brief Undo/redo history that records operations instead of pixels.
+ *
+ * This file declares the CommandHistory class, the command-log alternative to
+ * HistoryManager. Every edit is stored as the operation that produced it (a
+ * deterministic function of the previous image and its captured parameters),
+ * plus a full checkpoint image every few steps. Any state in the history is
+ * rebuilt by replaying the operations from the nearest checkpoint, and edits
+ * with an exact inverse (flip, invert, quarter-turn rotations) are undone by
+ * applying the inverse to the current image.
+ *
+ * @details The command history provides:
+ * - Memory proportional to the checkpoints, not the number of steps, so
+ *   hundreds of undo steps fit where a few full copies would
+ * - Checkpoints every N steps and after operations that cannot be replayed
+ *   (random output, external input), bounded by a byte budget; when over
+ *   budget, optional checkpoints are thinned before any step is forgotten
+ * - Exact inverses applied directly, with no replay
+ * - A const stateAt() that can rebuild a state on a worker thread
+ *
+ * @note Operations must produce the same output for the same input every time;
+ *       otherwise record them as not replayable so their result is kept.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef COMMANDHISTORY_H
+#define COMMANDHISTORY_H
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include "../image/Image_Class.h"
+
+/**
+ * @class CommandHistory
+ * @brief Linear history of operations with periodic checkpoints.
+ *
+ * States are numbered by absolute position: position() is the current one,
+ * undo targets position() - 1 and redo targets position() + 1. The caller
+ * keeps the current image; the history only rebuilds other states.
+ *
+ * @code
+ * CommandHistory::Step step;
+ * step.apply = [](Image& image) { flipHorizontally(image); };
+ * step.inverse = step.apply; // flipping twice restores the image
+ * Image before = currentImage;
+ * step.apply(currentImage);
+ * commands.record(before, step, currentImage);
+ *
+ * // Undo
+ * const std::size_t target = commands.position() - 1;
+ * currentImage = commands.stateAt(target, currentImage);
+ * commands.moveTo(target, currentImage);
+ * @endcode
+ */
+class CommandHistory {
+public:
+    /// Transforms an image in place.
+    using Operation = std::function<void(Image& image)>;
+
+    /// Default byte budget for checkpoint images (512 MiB).
+    static constexpr std::size_t DefaultByteBudget = std::size_t(512) << 20;
+
+    /**
+     * @brief One recorded edit.
+     */
+    struct Step {
+        Operation apply;   ///< Rebuilds the result from the previous state; empty if not replayable
+        Operation inverse; ///< Optional exact inverse, rebuilding the previous state from the result
+    };
+
+    /**
+     * @brief Constructs an empty command history.
+     *
+     * @param checkpointInterval Steps between checkpoints (at least 1); the
+     *        longest replay is one step shorter than this
+     * @param byteBudget Bytes of checkpoint images to keep before the oldest
+     *        part of the history is dropped
+     */
+    explicit CommandHistory(std::size_t checkpointInterval = 10, std::size_t byteBudget = DefaultByteBudget);
+
+    /**
+     * @brief Removes every step and checkpoint.
+     */
+    void clear();
+
+    /**
+     * @brief Appends an edit after the current position, dropping any redo steps.
+     *
+     * @param before The current image before the edit
+     * @param step How to replay (and optionally invert) the edit
+     * @param after The edited image, kept as a checkpoint when needed
+     */
+    void record(const Image& before, Step step, const Image& after);
+
+    /**
+     * @brief True if the current position has an earlier state.
+     */
+    bool canUndo() const { return cursor > first; }
+
+    /**
+     * @brief True if the current position has a later state.
+     */
+    bool canRedo() const { return cursor < lastPosition(); }
+
+    /**
+     * @brief Absolute position of the current state.
+     */
+    std::size_t position() const { return cursor; }
+
+    /**
+     * @brief Number of states available to undo.
+     */
+    std::size_t undoCount() const { return cursor - first; }
+
+    /**
+     * @brief Number of states available to redo.
+     */
+    std::size_t redoCount() const { return lastPosition() - cursor; }
+
+    /**
+     * @brief Rebuilds the state at @p index.
+     *
+     * Uses, in order of preference: a checkpoint at @p index, the inverse of
+     * the step just undone, the step just redone applied to @p current, or a
+     * replay from the nearest checkpoint (or from @p current when closer).
+     *
+     * @param index Absolute position in [position() - undoCount(), position() + redoCount()]
+     * @param current The image at position()
+     * @return The image at @p index
+     *
+     * @note Does not modify the history, so it may run on a worker thread while
+     *       the owner makes no other calls.
+     */
+    Image stateAt(std::size_t index, const Image& current) const;
+
+    /**
+     * @brief Makes @p index the current position.
+     *
+     * @param index Absolute position, as passed to stateAt()
+     * @param state The image returned by stateAt(); kept as a checkpoint so
+     *        that stepping further back replays from here
+     */
+    void moveTo(std::size_t index, const Image& state);
+
+    /**
+     * @brief Bytes held by checkpoint images.
+     */
+    std::size_t memoryUsage() const { return checkpointBytes; }
+
+private:
+    /**
+     * @brief Absolute position of the latest state.
+     */
+    std::size_t lastPosition() const { return first + steps.size(); }
+
+    /**
+     * @brief The step that turns state index - 1 into state @p index.
+     */
+    const Step& stepTo(std::size_t index) const { return steps[index - 1 - first]; }
+
+    /**
+     * @brief Stores @p state as the checkpoint at @p index.
+     */
+    void addCheckpoint(std::size_t index, const Image& state);
+
+    /**
+     * @brief Frees checkpoint memory while over budget.
+     *
+     * Checkpoints after replayable steps are dropped first (oldest first),
+     * which lengthens replays but keeps every step. Only then is the oldest
+     * part of the history dropped, up to the next checkpoint. The history
+     * always starts at a checkpoint, and the current position is never dropped.
+     */
+    void enforceBudget();
+
+    std::size_t interval;                     ///< Steps between checkpoints
+    std::size_t budget;                       ///< Maximum checkpoint bytes
+    std::size_t checkpointBytes = 0;          ///< Bytes held by checkpoints
+    std::size_t first = 0;                    ///< Absolute position of the oldest state
+    std::size_t cursor = 0;                   ///< Absolute position of the current state
+    std::deque<Step> steps;                   ///< steps[k] turns state first + k into first + k + 1
+    std::map<std::size_t, Image> checkpoints; ///< Full states by absolute position
+};
+
+#endif // COMMANDHISTORY_H
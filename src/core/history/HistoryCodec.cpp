@@ -0,0 +1,239 @@
+/**
+ * @file HistoryCodec.cpp
+ * @brief Implementation of the history block codec.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "HistoryCodec.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+constexpr std::size_t kMinMatch = 4;
+constexpr std::size_t kMaxOffset = 65535;
+constexpr int kHashBits = 16;
+
+std::uint32_t read32(const unsigned char* p)
+{
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+std::uint32_t hash32(std::uint32_t v)
+{
+    return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+/// Writes the 255-continuation bytes of a length that did not fit its nibble.
+void writeLength(std::vector<unsigned char>& out, std::size_t length)
+{
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<unsigned char>(length));
+}
+
+/// Emits one sequence: literals [anchor, anchor + literals), then an optional match.
+void writeSequence(std::vector<unsigned char>& out, const unsigned char* anchor, std::size_t literals,
+                   std::size_t offset, std::size_t matchLength)
+{
+    const std::size_t matchCode = matchLength ? matchLength - kMinMatch : 0;
+    const unsigned char token = static_cast<unsigned char>((std::min<std::size_t>(literals, 15) << 4)
+                                                           | std::min<std::size_t>(matchCode, 15));
+    out.push_back(token);
+    if (literals >= 15) writeLength(out, literals - 15);
+    out.insert(out.end(), anchor, anchor + literals);
+    if (matchLength == 0) return;
+    out.push_back(static_cast<unsigned char>(offset & 0xFF));
+    out.push_back(static_cast<unsigned char>(offset >> 8));
+    if (matchCode >= 15) writeLength(out, matchCode - 15);
+}
+
+/// Reads the continuation bytes of an extended length; false on truncated input.
+bool readLength(const unsigned char*& ip, const unsigned char* end, std::size_t& length)
+{
+    unsigned char byte;
+    do {
+        if (ip >= end) return false;
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+} // namespace
+
+std::size_t HistoryCodec::Packed::byteSize() const
+{
+    std::size_t total = 0;
+    for (const Block& block : blocks) total += block.data.size();
+    return total;
+}
+
+void HistoryCodec::compress(const unsigned char* src, std::size_t size, std::vector<unsigned char>& out)
+{
+    // Positions are stored + 1 so that 0 means "empty"
+    std::vector<std::uint32_t> table(std::size_t(1) << kHashBits, 0);
+    std::size_t ip = 0;
+    std::size_t anchor = 0;
+    unsigned misses = 0;
+
+    while (ip + kMinMatch <= size) {
+        const std::uint32_t sequence = read32(src + ip);
+        const std::uint32_t h = hash32(sequence);
+        const std::size_t candidate = table[h];
+        table[h] = static_cast<std::uint32_t>(ip + 1);
+
+        if (candidate != 0 && ip - (candidate - 1) <= kMaxOffset && read32(src + candidate - 1) == sequence) {
+            const std::size_t ref = candidate - 1;
+            std::size_t length = kMinMatch;
+            while (ip + length < size && src[ref + length] == src[ip + length]) ++length;
+            writeSequence(out, src + anchor, ip - anchor, ip - ref, length);
+            ip += length;
+            anchor = ip;
+            misses = 0;
+            continue;
+        }
+        // Skip ahead faster through data that does not compress
+        ip += 1 + (misses++ >> 6);
+    }
+    writeSequence(out, src + anchor, size - anchor, 0, 0);
+}
+
+bool HistoryCodec::decompress(const unsigned char* src, std::size_t size, unsigned char* dst, std::size_t rawSize)
+{
+    const unsigned char* ip = src;
+    const unsigned char* const end = src + size;
+    unsigned char* op = dst;
+    unsigned char* const outEnd = dst + rawSize;
+
+    while (ip < end) {
+        const unsigned char token = *ip++;
+        std::size_t literals = token >> 4;
+        if (literals == 15 && !readLength(ip, end, literals)) return false;
+        if (static_cast<std::size_t>(end - ip) < literals || static_cast<std::size_t>(outEnd - op) < literals) return false;
+        std::memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+        if (ip == end) break; // the final sequence carries literals only
+
+        if (end - ip < 2) return false;
+        const std::size_t offset = ip[0] | (std::size_t(ip[1]) << 8);
+        ip += 2;
+        std::size_t length = token & 15;
+        if (length == 15 && !readLength(ip, end, length)) return false;
+        length += kMinMatch;
+        if (offset == 0 || offset > static_cast<std::size_t>(op - dst)) return false;
+        if (static_cast<std::size_t>(outEnd - op) < length) return false;
+
+        // An overlapping match repeats the last `offset` bytes (runs of zeros use offset 1);
+        // copy it in chunks that double, each one reading only bytes already written
+        std::size_t distance = offset;
+        while (length > 0) {
+            const std::size_t chunk = std::min(distance, length);
+            std::memcpy(op, op - distance, chunk);
+            op += chunk;
+            length -= chunk;
+            distance += chunk;
+        }
+    }
+    return op == outEnd;
+}
+
+HistoryCodec::Packed HistoryCodec::pack(const unsigned char* data, std::size_t bytes, const unsigned char* reference,
+                                        const ChangedBytes& changed)
+{
+    Packed packed;
+    packed.rawBytes = bytes;
+    const std::size_t blockCount = (bytes + BlockSize - 1) / BlockSize;
+    packed.blocks.resize(blockCount);
+
+    ThreadPool::instance().parallelRows(static_cast<int>(blockCount), [&](int blockBegin, int blockEnd) {
+        std::vector<unsigned char> delta;
+        std::vector<unsigned char> candidate;
+        for (int b = blockBegin; b < blockEnd; ++b) {
+            const std::size_t begin = static_cast<std::size_t>(b) * BlockSize;
+            const std::size_t length = std::min(BlockSize, bytes - begin);
+            const unsigned char* raw = data + begin;
+            Block& block = packed.blocks[b];
+
+            if (reference && changed && !changed(begin, begin + length)) {
+                block.method = BlockMethod::Unchanged;
+                continue;
+            }
+            if (reference) {
+                delta.resize(length);
+                const unsigned char* ref = reference + begin;
+                for (std::size_t i = 0; i < length; ++i) delta[i] = static_cast<unsigned char>(raw[i] ^ ref[i]);
+                compress(delta.data(), length, block.data);
+                block.method = BlockMethod::LzDelta;
+            }
+            // Dense changes leave little to gain from the delta; try the pixels themselves
+            if (!reference || block.data.size() > length / 2) {
+                candidate.clear();
+                compress(raw, length, candidate);
+                if (!reference || candidate.size() < block.data.size()) {
+                    block.data.swap(candidate);
+                    block.method = BlockMethod::Lz;
+                }
+            }
+            if (block.data.size() >= length) {
+                block.data.assign(raw, raw + length);
+                block.method = BlockMethod::Stored;
+            }
+            block.data.shrink_to_fit();
+        }
+    });
+    return packed;
+}
+
+bool HistoryCodec::unpack(const Packed& packed, unsigned char* out, const unsigned char* reference)
+{
+    std::atomic<bool> ok{true};
+    ThreadPool::instance().parallelRows(static_cast<int>(packed.blocks.size()), [&](int blockBegin, int blockEnd) {
+        for (int b = blockBegin; b < blockEnd; ++b) {
+            const std::size_t begin = static_cast<std::size_t>(b) * BlockSize;
+            const std::size_t length = std::min(BlockSize, packed.rawBytes - begin);
+            const Block& block = packed.blocks[b];
+            unsigned char* dst = out + begin;
+
+            switch (block.method) {
+            case BlockMethod::Stored:
+                if (block.data.size() != length) { ok = false; break; }
+                std::memcpy(dst, block.data.data(), length);
+                break;
+            case BlockMethod::Lz:
+                if (!decompress(block.data.data(), block.data.size(), dst, length)) ok = false;
+                break;
+            case BlockMethod::LzDelta: {
+                if (!reference || !decompress(block.data.data(), block.data.size(), dst, length)) {
+                    ok = false;
+                    break;
+                }
+                const unsigned char* ref = reference + begin;
+                for (std::size_t i = 0; i < length; ++i) dst[i] = static_cast<unsigned char>(dst[i] ^ ref[i]);
+                break;
+            }
+            case BlockMethod::Unchanged:
+                if (!reference) { ok = false; break; }
+                std::memcpy(dst, reference + begin, length);
+                break;
+            }
+        }
+    });
+    return ok;
+}
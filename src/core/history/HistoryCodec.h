@@ -0,0 +1,130 @@
+/**
+ * @file HistoryCodec.h
+ * @brief Compact encoding of cold undo/redo states.
+ *
+ * This file declares the HistoryCodec class used by HistoryManager to shrink
+ * history entries that are not at the top of a stack. An image is split into
+ * fixed-size blocks; each block is stored XOR-ed against the neighbouring
+ * history state (so unchanged pixels become runs of zeros), compressed with a
+ * small LZ77 coder, or kept verbatim, whichever is smallest.
+ *
+ * @details The codec provides:
+ * - A dependency-free LZ77 block format in the style of LZ4 (literal runs and
+ *   back-references inside a 64 KiB window), fast on both compressible and
+ *   incompressible data
+ * - XOR deltas against a reference image of the same size
+ * - Blocks the caller knows to be unchanged (from a DirtyRegion) stored as
+ *   references to the same block of the reference, with no data
+ * - Independent blocks encoded and decoded in parallel on the ThreadPool
+ * - Bounds-checked decoding that rejects corrupt input
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef HISTORYCODEC_H
+#define HISTORYCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @class HistoryCodec
+ * @brief Block-wise delta and LZ compression of pixel buffers.
+ *
+ * @code
+ * HistoryCodec::Packed packed = HistoryCodec::pack(older, olderBytes, newer);
+ * std::vector<unsigned char> restored(olderBytes);
+ * HistoryCodec::unpack(packed, restored.data(), newer);
+ * @endcode
+ */
+class HistoryCodec {
+public:
+    /// Bytes per independently coded block.
+    static constexpr std::size_t BlockSize = 1u << 20;
+
+    /**
+     * @brief How one block is stored.
+     */
+    enum class BlockMethod : std::uint8_t {
+        Stored,    ///< Raw bytes
+        Lz,        ///< LZ-compressed raw bytes
+        LzDelta,   ///< LZ-compressed XOR against the reference buffer
+        Unchanged  ///< Equal to the reference buffer; no data
+    };
+
+    /**
+     * @brief One coded block.
+     */
+    struct Block {
+        BlockMethod method = BlockMethod::Stored;
+        std::vector<unsigned char> data;
+    };
+
+    /**
+     * @brief A buffer coded as a sequence of blocks.
+     */
+    struct Packed {
+        std::size_t rawBytes = 0;  ///< Size of the original buffer
+        std::vector<Block> blocks; ///< ceil(rawBytes / BlockSize) blocks
+
+        /**
+         * @brief Bytes held by the coded blocks.
+         */
+        std::size_t byteSize() const;
+    };
+
+    /**
+     * @brief Reports whether bytes [begin, end) of the buffer may differ from the reference.
+     */
+    using ChangedBytes = std::function<bool(std::size_t begin, std::size_t end)>;
+
+    /**
+     * @brief Codes @p bytes bytes of @p data.
+     *
+     * @param data Buffer to code
+     * @param bytes Size of @p data
+     * @param reference Optional buffer of the same size to take XOR deltas
+     *        against (nullptr when the sizes differ)
+     * @param changed Optional test of which blocks may differ from @p reference;
+     *        blocks it rules out are stored as Unchanged without being read.
+     *        Without it every block is coded from its bytes
+     * @return The coded buffer
+     */
+    static Packed pack(const unsigned char* data, std::size_t bytes, const unsigned char* reference,
+                       const ChangedBytes& changed = {});
+
+    /**
+     * @brief Decodes @p packed into @p out (packed.rawBytes bytes).
+     *
+     * @param packed Data produced by pack()
+     * @param out Destination buffer
+     * @param reference The same reference buffer given to pack(), if any
+     * @return true on success, false if the data is corrupt or a needed
+     *         reference is missing
+     */
+    static bool unpack(const Packed& packed, unsigned char* out, const unsigned char* reference);
+
+    /**
+     * @brief LZ-compresses @p size bytes of @p src, appending to @p out.
+     */
+    static void compress(const unsigned char* src, std::size_t size, std::vector<unsigned char>& out);
+
+    /**
+     * @brief Decompresses data produced by compress() into exactly @p rawSize bytes.
+     *
+     * @return true on success, false if the input is corrupt or has the wrong size
+     */
+    static bool decompress(const unsigned char* src, std::size_t size, unsigned char* dst, std::size_t rawSize);
+};
+
+#endif // HISTORYCODEC_H
@@ -0,0 +1,166 @@
+/**
+ * @file HistoryManager.cpp
+ * @brief Implementation of the budgeted, delta-compressed undo/redo history.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "HistoryManager.h"
+#include <algorithm>
+#include <stdexcept>
+
+void HistoryManager::clear()
+{
+    undoEntries.clear();
+    redoEntries.clear();
+    usedBytes = 0;
+}
+
+void HistoryManager::pushUndo(Image&& state, const DirtyRegion& changed)
+{
+    clearRedo();
+    pushEntry(undoEntries, std::move(state), changed);
+    enforceBudget();
+}
+
+bool HistoryManager::undo(Image& current, DirtyRegion* changed)
+{
+    if (undoEntries.empty()) return false;
+    // The difference is symmetric: it also says where the replaced image differs from the restored one
+    DirtyRegion difference;
+    Image previous = popEntry(undoEntries, difference);
+    pushEntry(redoEntries, std::move(current), difference);
+    current = std::move(previous);
+    enforceBudget();
+    if (changed) *changed = std::move(difference);
+    return true;
+}
+
+bool HistoryManager::redo(Image& current, DirtyRegion* changed)
+{
+    if (redoEntries.empty()) return false;
+    DirtyRegion difference;
+    Image next = popEntry(redoEntries, difference);
+    pushEntry(undoEntries, std::move(current), difference);
+    current = std::move(next);
+    enforceBudget();
+    if (changed) *changed = std::move(difference);
+    return true;
+}
+
+void HistoryManager::currentReplaced()
+{
+    if (!undoEntries.empty()) undoEntries.back().changed = DirtyRegion();
+    if (!redoEntries.empty()) redoEntries.back().changed = DirtyRegion();
+}
+
+void HistoryManager::clearRedo()
+{
+    for (const Entry& entry : redoEntries) usedBytes -= entry.byteSize();
+    redoEntries.clear();
+}
+
+void HistoryManager::setByteBudget(std::size_t byteBudget)
+{
+    budget = byteBudget;
+    enforceBudget();
+}
+
+void HistoryManager::pushEntry(std::deque<Entry>& entries, Image&& state, const DirtyRegion& changed)
+{
+    if (!entries.empty()) freeze(entries.back(), state);
+    Entry entry;
+    entry.image = std::move(state);
+    entry.changed = changed;
+    usedBytes += entry.byteSize();
+    entries.push_back(std::move(entry));
+}
+
+Image HistoryManager::popEntry(std::deque<Entry>& entries, DirtyRegion& changed)
+{
+    // Unpack the next state first, so a failure leaves the history untouched
+    if (entries.size() > 1) thaw(entries[entries.size() - 2], entries.back().image);
+    Image top = std::move(entries.back().image);
+    changed = std::move(entries.back().changed);
+    usedBytes -= top.byteSize();
+    entries.pop_back();
+    return top;
+}
+
+void HistoryManager::freeze(Entry& entry, const Image& newer)
+{
+    const Image& image = entry.image;
+    // Shared buffers stay alive elsewhere; 0-byte states are left alone
+    if (entry.isPacked() || image.byteSize() == 0 || image.isShared()) return;
+
+    const bool sameSize = newer.width == image.width && newer.height == image.height
+                       && newer.format() == image.format();
+    // With a dirty map, blocks over clean rows are known to equal the newer state
+    HistoryCodec::ChangedBytes changedBytes;
+    if (sameSize && entry.changed.covers(image)) {
+        const std::size_t planeBytes = static_cast<std::size_t>(image.rowStride()) * image.height;
+        const std::size_t rowBytes = static_cast<std::size_t>(image.rowStride());
+        const DirtyRegion& dirty = entry.changed;
+        changedBytes = [planeBytes, rowBytes, &dirty](std::size_t begin, std::size_t end) {
+            // Planar images repeat the rows once per plane
+            for (std::size_t plane = begin / planeBytes; plane * planeBytes < end; ++plane) {
+                const std::size_t first = std::max(begin, plane * planeBytes) - plane * planeBytes;
+                const std::size_t last = std::min(end, (plane + 1) * planeBytes) - plane * planeBytes;
+                if (dirty.rowsDirty(static_cast<int>(first / rowBytes), static_cast<int>((last - 1) / rowBytes) + 1)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+    }
+    HistoryCodec::Packed packed = HistoryCodec::pack(image.imageData, image.byteSize(),
+                                                     sameSize ? newer.imageData : nullptr, changedBytes);
+    // Keep the image itself unless packing saves a meaningful amount
+    if (packed.byteSize() > image.byteSize() / 10 * 9) return;
+
+    usedBytes -= entry.byteSize();
+    entry.width = image.width;
+    entry.height = image.height;
+    entry.format = image.format();
+    entry.packed = std::move(packed);
+    entry.image = Image();
+    usedBytes += entry.byteSize();
+}
+
+void HistoryManager::thaw(Entry& entry, const Image& newer)
+{
+    if (!entry.isPacked()) return;
+
+    // The buffer comes from the BufferPool, usually the one the state popped off the top released
+    Image image(entry.width, entry.height, entry.format);
+    const bool sameSize = newer.width == image.width && newer.height == image.height
+                       && newer.format() == image.format();
+    if (!HistoryCodec::unpack(entry.packed, image.imageData, sameSize ? newer.imageData : nullptr)) {
+        throw std::runtime_error("Corrupted undo history entry");
+    }
+
+    usedBytes -= entry.byteSize();
+    entry.packed = HistoryCodec::Packed();
+    entry.image = std::move(image);
+    usedBytes += entry.byteSize();
+}
+
+void HistoryManager::enforceBudget()
+{
+    while (usedBytes > budget && undoEntries.size() > 1) {
+        usedBytes -= undoEntries.front().byteSize();
+        undoEntries.pop_front();
+    }
+    while (usedBytes > budget && redoEntries.size() > 1) {
+        usedBytes -= redoEntries.front().byteSize();
+        redoEntries.pop_front();
+    }
+}
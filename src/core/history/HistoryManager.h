@@ -1,31 +1,34 @@
 /**
  * @file HistoryManager.h
  * @brief Undo/Redo history management system for image processing operations.
- * 
+ *
  * This file provides a comprehensive history management system that allows users
- * to undo and redo image processing operations. The system uses a stack-based
- * approach with configurable memory limits to prevent excessive memory usage.
- * 
+ * to undo and redo image processing operations. The system keeps the history
+ * within a memory budget: only the state next to the current image is kept as a
+ * full image, older states are stored as compressed deltas.
+ *
  * @details The HistoryManager class provides:
- * - Unlimited undo/redo operations (within memory limits)
- * - Configurable maximum undo steps to control memory usage
+ * - Undo/redo operations bounded by a byte budget instead of a step count
+ * - Cold states stored as XOR deltas against their neighbour, compressed
+ * - Optional dirty maps: blocks an edit did not touch are stored as references
+ *   to the neighbour, neither read nor compressed
+ * - O(1) eviction of the oldest states from a double-ended queue
  * - Automatic cleanup of old history states
- * - Thread-safe operations for GUI applications
- * - Efficient memory management with stack-based storage
- * 
+ * - Clear separation between undo and redo histories
+ *
  * @features
- * - Stack-based undo/redo implementation
- * - Configurable memory limits
- * - Automatic cleanup of old states
- * - Clear separation between undo and redo stacks
+ * - Deque-based undo/redo implementation
+ * - Configurable memory budget
+ * - Delta + LZ compression of cold entries (see HistoryCodec)
+ * - Automatic eviction of the oldest states
  * - Exception safety and robust error handling
  * - Memory-efficient image state storage
- * 
+ *
  * @author Team Members:
  * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
- * - Eyad Mohamed Saad Ali (ID: 20242062) 
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
  * - Tarek Sami Mohamed Mohamed (ID: 20242190)
- * 
+ *
  * @institution Faculty of Computers and Artificial Intelligence, Cairo University
  * @version 2.0.0
  * @date October 13, 2025
@@ -35,43 +38,54 @@
 #ifndef HISTORYMANAGER_H
 #define HISTORYMANAGER_H
 
-#include <stack>
+#include <deque>
 #include <cstddef>
+#include <utility>
+#include "../image/DirtyRegion.h"
 #include "../image/Image_Class.h"
+#include "HistoryCodec.h"
 
 /**
  * @class HistoryManager
  * @brief Manages undo/redo history for image processing operations.
- * 
+ *
  * This class provides a complete undo/redo system for image processing applications.
- * It uses two stacks (undo and redo) to maintain the history of image states,
- * allowing users to navigate through their editing history seamlessly.
- * 
+ * It keeps two histories (undo and redo), each a deque whose back is the state
+ * closest to the current image.
+ *
  * @details The HistoryManager implements:
- * - Stack-based undo/redo with separate undo and redo stacks
- * - Configurable maximum undo steps to control memory usage
- * - Automatic cleanup of old history states when limit is exceeded
- * - Clear separation between undo and redo operations
- * - Memory-efficient storage using the Image class
- * 
- * @note This class is designed to work with the Image class and provides
- *       thread-safe operations for GUI applications.
+ * - The top state of each history kept as a full, copy-on-write Image, so
+ *   pushing and the first undo/redo are cheap
+ * - Every other state packed relative to its neighbour towards the top: an XOR
+ *   delta where the sizes match (unchanged pixels compress to almost nothing),
+ *   otherwise the compressed pixels; states that do not shrink stay unpacked
+ * - A DirtyRegion per state, when the caller supplies one, saying where it
+ *   differs from its neighbour towards the top; rows outside it are packed
+ *   as unchanged blocks, and undo()/redo() report it so the display can
+ *   repaint just those tiles
+ * - Dependencies only pointing towards the top, so the oldest state can be
+ *   dropped from the front of the deque without touching the others
+ * - A byte budget over both histories; the oldest states are evicted first and
+ *   the top of each history is always kept
+ *
+ * @note This class is designed to work with the Image class and is meant to be
+ *       used from a single (GUI) thread; packing runs on the shared ThreadPool.
  * @see Image class for image data structure
- * @see std::stack for underlying stack implementation
- * 
+ * @see HistoryCodec for the entry encoding
+ *
  * @example
  * @code
- * HistoryManager history(20); // Allow up to 20 undo steps
- * 
+ * HistoryManager history(256u << 20); // Keep at most 256 MiB of history
+ *
  * // Save state before applying filter
  * history.pushUndo(currentImage);
  * applySomeFilter(currentImage);
- * 
+ *
  * // Undo the operation
  * if (history.canUndo()) {
  *     history.undo(currentImage);
  * }
- * 
+ *
  * // Redo the operation
  * if (history.canRedo()) {
  *     history.redo(currentImage);
@@ -80,49 +94,47 @@
  */
 class HistoryManager {
 public:
+    /// Default memory budget for the whole history (512 MiB).
+    static constexpr std::size_t DefaultByteBudget = std::size_t(512) << 20;
+
     /**
-     * @brief Constructs a HistoryManager with specified maximum undo steps.
-     * 
-     * @param maxUndoSteps Maximum number of undo steps to keep in memory (default: 20)
-     * 
-     * @note A higher value allows more undo operations but uses more memory.
-     *       The default value of 20 provides a good balance between functionality
-     *       and memory usage for most image processing applications.
+     * @brief Constructs a HistoryManager with the specified memory budget.
+     *
+     * @param byteBudget Maximum bytes held by the undo and redo histories together
+     *
+     * @note A larger budget allows more undo operations but uses more memory.
+     *       The top undo and redo states are kept even if they alone exceed it.
      */
-    explicit HistoryManager(std::size_t maxUndoSteps = 20)
-        : maxUndoSteps(maxUndoSteps) {}
+    explicit HistoryManager(std::size_t byteBudget = DefaultByteBudget)
+        : budget(byteBudget) {}
 
     /**
      * @brief Clears all undo and redo history.
-     * 
-     * This method removes all stored image states from both undo and redo stacks,
+     *
+     * This method removes all stored image states from both histories,
      * effectively resetting the history. This is typically called when loading
      * a new image or when the user wants to start fresh.
-     * 
+     *
      * @note This operation cannot be undone. All history will be permanently lost.
      * @see pushUndo() for adding new states to history
      */
-    void clear()
-    {
-        while (!undoStack.empty()) undoStack.pop();
-        while (!redoStack.empty()) redoStack.pop();
-    }
+    void clear();
 
     /**
      * @brief Adds a new image state to the undo history.
-     * 
-     * This method saves the current image state to the undo stack and clears
-     * the redo stack (since new operations invalidate the redo history).
-     * It also enforces the maximum undo limit by removing old states if necessary.
-     * 
+     *
+     * This method saves the current image state to the undo history and clears
+     * the redo history (since new operations invalidate the redo history).
+     * The previous top state is packed against the new one, and the oldest
+     * states are evicted if the budget is exceeded.
+     *
      * @param state Const reference to the Image object to save
-     * 
+     *
      * @note This method should be called before applying any filter or operation
-     *       that modifies the image. The image is copied, so the original can
-     *       be modified after calling this method.
-     * @see enforceLimit() for automatic cleanup of old states
+     *       that modifies the image. The stored copy shares the pixel buffer
+     *       (copy-on-write), so the original can still be modified afterwards.
      * @see clearRedo() for clearing redo history
-     * 
+     *
      * @example
      * @code
      * // Before applying a filter
@@ -130,50 +142,66 @@ public:
      * applyGrayscaleFilter(currentImage);
      * @endcode
      */
-    void pushUndo(const Image& state)
-    {
-        undoStack.push(state);
-        enforceLimit();
-        clearRedo();
-    }
+    void pushUndo(const Image& state) { pushUndo(Image(state), DirtyRegion()); }
+
+    /**
+     * @brief Adds a new image state to the undo history, with where the edit changed it.
+     *
+     * @param state Const reference to the Image object to save
+     * @param changed Where the image that replaces @p state differs from it,
+     *        such as DirtyRegion::between(state, result); it must contain every
+     *        changed pixel. A region that does not cover @p state means
+     *        anything may have changed
+     *
+     * @see pushUndo(const Image&) for details
+     */
+    void pushUndo(const Image& state, const DirtyRegion& changed) { pushUndo(Image(state), changed); }
+
+    /**
+     * @brief Adds a new image state to the undo history, taking ownership of it.
+     *
+     * @param state Image to move into the history (left empty afterwards)
+     * @param changed Where the image that replaces @p state differs from it
+     *
+     * @see pushUndo(const Image&, const DirtyRegion&) for details
+     */
+    void pushUndo(Image&& state, const DirtyRegion& changed = DirtyRegion());
 
     /**
      * @brief Checks if undo operations are available.
-     * 
+     *
      * @return true if there are states available to undo, false otherwise
-     * 
-     * @note This method should be called before attempting to undo to avoid
-     *       unnecessary operations on an empty stack.
+     *
      * @see undo() for performing the actual undo operation
      */
-    bool canUndo() const { return !undoStack.empty(); }
-    
+    bool canUndo() const { return !undoEntries.empty(); }
+
     /**
      * @brief Checks if redo operations are available.
-     * 
+     *
      * @return true if there are states available to redo, false otherwise
-     * 
-     * @note This method should be called before attempting to redo to avoid
-     *       unnecessary operations on an empty stack.
+     *
      * @see redo() for performing the actual redo operation
      */
-    bool canRedo() const { return !redoStack.empty(); }
+    bool canRedo() const { return !redoEntries.empty(); }
 
     /**
      * @brief Undoes the last operation by restoring the previous image state.
-     * 
-     * This method moves the current image state to the redo stack and restores
-     * the most recent state from the undo stack. If no undo states are available,
+     *
+     * This method moves the current image state to the redo history and restores
+     * the most recent state from the undo history. If no undo states are available,
      * the operation fails and returns false.
-     * 
+     *
      * @param current Reference to the current image (will be replaced with previous state)
+     * @param changed Optional; receives where the restored state differs from
+     *        the replaced one (a region not covering @p current if unknown)
      * @return true if undo was successful, false if no undo states available
-     * 
-     * @note The current image state is automatically saved to the redo stack,
-     *       allowing the operation to be redone if needed.
+     *
+     * @throws std::runtime_error If a packed state cannot be decoded
+     * @note The next undo state is unpacked here, so undo costs one decode.
      * @see canUndo() to check if undo is available
      * @see redo() for the reverse operation
-     * 
+     *
      * @example
      * @code
      * if (history.canUndo()) {
@@ -184,93 +212,127 @@ public:
      * }
      * @endcode
      */
-    bool undo(Image& current)
-    {
-        if (undoStack.empty()) return false;
-        redoStack.push(current);
-        current = undoStack.top();
-        undoStack.pop();
-        return true;
-    }
+    bool undo(Image& current, DirtyRegion* changed = nullptr);
 
     /**
      * @brief Redoes the last undone operation by restoring the next image state.
-     * 
-     * This method moves the current image state to the undo stack and restores
-     * the most recent state from the redo stack. If no redo states are available,
+     *
+     * This method moves the current image state to the undo history and restores
+     * the most recent state from the redo history. If no redo states are available,
      * the operation fails and returns false.
-     * 
+     *
      * @param current Reference to the current image (will be replaced with next state)
+     * @param changed Optional; receives where the restored state differs from
+     *        the replaced one (a region not covering @p current if unknown)
      * @return true if redo was successful, false if no redo states available
-     * 
-     * @note The current image state is automatically saved to the undo stack,
-     *       allowing the operation to be undone again if needed.
+     *
+     * @throws std::runtime_error If a packed state cannot be decoded
      * @see canRedo() to check if redo is available
      * @see undo() for the reverse operation
-     * 
-     * @example
-     * @code
-     * if (history.canRedo()) {
-     *     if (history.redo(currentImage)) {
-     *         statusBar()->showMessage("Redo applied");
-     *         updateImageDisplay();
-     *     }
-     * }
-     * @endcode
      */
-    bool redo(Image& current)
-    {
-        if (redoStack.empty()) return false;
-        undoStack.push(current);
-        current = redoStack.top();
-        redoStack.pop();
-        return true;
-    }
+    bool redo(Image& current, DirtyRegion* changed = nullptr);
+
+    /**
+     * @brief Tells the history that the current image was replaced without pushUndo().
+     *
+     * The dirty maps of the top undo and redo states describe how they differ
+     * from the image they were pushed next to. Once the current image is
+     * swapped for another one (a reset, say), those maps are dropped, so the
+     * states are packed from their bytes instead of against the wrong image.
+     */
+    void currentReplaced();
 
     /**
      * @brief Clears all redo history.
-     * 
-     * This method removes all states from the redo stack, typically called
+     *
+     * This method removes all states from the redo history, typically called
      * when a new operation is performed after an undo (since new operations
      * invalidate the redo history).
-     * 
+     *
      * @note This operation cannot be undone. All redo history will be permanently lost.
      * @see pushUndo() which automatically calls this method
      */
-    void clearRedo()
-    {
-        while (!redoStack.empty()) redoStack.pop();
-    }
+    void clearRedo();
+
+    /**
+     * @brief Number of states available to undo.
+     */
+    std::size_t undoCount() const { return undoEntries.size(); }
+
+    /**
+     * @brief Number of states available to redo.
+     */
+    std::size_t redoCount() const { return redoEntries.size(); }
+
+    /**
+     * @brief Bytes currently held by both histories.
+     */
+    std::size_t memoryUsage() const { return usedBytes; }
+
+    /**
+     * @brief Maximum bytes the histories may hold.
+     */
+    std::size_t byteBudget() const { return budget; }
+
+    /**
+     * @brief Changes the memory budget, evicting old states if necessary.
+     */
+    void setByteBudget(std::size_t byteBudget);
 
 private:
     /**
-     * @brief Enforces the maximum undo limit by removing old states.
-     * 
-     * This private method is called automatically when new states are added
-     * to ensure the undo stack doesn't exceed the maximum allowed size.
-     * It keeps the most recent states and removes the oldest ones.
-     * 
-     * @note This method is called automatically by pushUndo() and doesn't
-     *       need to be called manually.
-     * @see maxUndoSteps for the maximum number of states to keep
+     * @brief One stored state: a full image or a packed one.
      */
-    void enforceLimit()
-    {
-        if (undoStack.size() <= maxUndoSteps) return;
-        std::stack<Image> temp;
-        for (std::size_t i = 0; i < maxUndoSteps - 1; ++i) {
-            temp.push(undoStack.top());
-            undoStack.pop();
-        }
-        while (!undoStack.empty()) undoStack.pop();
-        while (!temp.empty()) { undoStack.push(temp.top()); temp.pop(); }
-    }
+    struct Entry {
+        Image image;                 ///< Full state (top of a history, or not worth packing)
+        HistoryCodec::Packed packed; ///< State coded against the next entry towards the top
+        int width = 0;               ///< Dimensions of the packed state
+        int height = 0;
+        PixelFormat format;          ///< Pixel format of the packed state
+        DirtyRegion changed;         ///< Where the state differs from its neighbour towards the top
 
-    std::size_t maxUndoSteps;    ///< Maximum number of undo steps to keep in memory
-    std::stack<Image> undoStack; ///< Stack storing image states for undo operations
-    std::stack<Image> redoStack; ///< Stack storing image states for redo operations
-};
+        bool isPacked() const { return packed.rawBytes != 0; }
+        std::size_t byteSize() const { return isPacked() ? packed.byteSize() : image.byteSize(); }
+    };
 
-#endif // HISTORYMANAGER_H
+    /**
+     * @brief Pushes @p state on top of @p entries, packing the previous top against it.
+     *
+     * @param changed Where @p state differs from the current image
+     */
+    void pushEntry(std::deque<Entry>& entries, Image&& state, const DirtyRegion& changed);
 
+    /**
+     * @brief Removes and returns the top state of @p entries, unpacking the one below.
+     *
+     * @param changed Receives where the returned state differs from the current image
+     */
+    Image popEntry(std::deque<Entry>& entries, DirtyRegion& changed);
 
+    /**
+     * @brief Packs @p entry relative to @p newer when that saves memory.
+     */
+    void freeze(Entry& entry, const Image& newer);
+
+    /**
+     * @brief Restores the full image of @p entry, packed relative to @p newer.
+     *
+     * @throws std::runtime_error If the packed data cannot be decoded
+     */
+    void thaw(Entry& entry, const Image& newer);
+
+    /**
+     * @brief Evicts the oldest states until the budget is met.
+     *
+     * Undo states go first, then the furthest redo states; the top of each
+     * history is always kept. Each eviction is O(1).
+     */
+    void enforceBudget();
+
+    std::size_t budget;              ///< Maximum bytes held by both histories
+    std::size_t usedBytes = 0;       ///< Bytes currently held by both histories
+    std::deque<Entry> undoEntries;   ///< Undo states, oldest first
+    std::deque<Entry> redoEntries;   ///< Redo states, furthest from the current image first
+};
+
+#endif // HISTORYMANAGER_H
@@ -0,0 +1,231 @@
+/**
+ * @file BufferPool.cpp
+ * @brief Implementation of the pixel buffer pool.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "BufferPool.h"
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+constexpr std::size_t kMinPooledBytes = std::size_t(64) << 10;   // Smaller requests go to malloc
+constexpr std::size_t kPageBytes = std::size_t(4) << 10;
+constexpr std::size_t kHugePageBytes = std::size_t(2) << 20;
+constexpr std::size_t kDefaultCapacity = std::size_t(256) << 20;
+
+std::size_t roundUp(std::size_t value, std::size_t step)
+{
+    return (value + step - 1) / step * step;
+}
+
+} // namespace
+
+BufferPool::Lease& BufferPool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other) {
+        BufferPool::instance().release(buffer, bytes);
+        bytes = other.bytes;
+        buffer = other.buffer;
+        other.buffer = nullptr;
+    }
+    return *this;
+}
+
+BufferPool::Lease::~Lease()
+{
+    BufferPool::instance().release(buffer, bytes);
+}
+
+BufferPool& BufferPool::instance()
+{
+    // Never destroyed: images in other static objects may release their buffers after main() returns
+    static BufferPool* pool = new BufferPool();
+    return *pool;
+}
+
+BufferPool::BufferPool() : maxIdle(kDefaultCapacity)
+{
+    // PHOTOSMITH_POOL_MB caps the idle buffers kept (0 frees every buffer on release)
+    if (const char* env = std::getenv("PHOTOSMITH_POOL_MB")) {
+        maxIdle = static_cast<std::size_t>(std::max(0L, std::atol(env))) << 20;
+    }
+}
+
+std::size_t BufferPool::sizeClass(std::size_t bytes)
+{
+    if (bytes < kMinPooledBytes) return bytes;
+    // Four classes per power of two: at most 25% slack, and sizes a few rows apart share buffers
+    const std::size_t step = std::max(std::bit_floor(bytes) / 4, bytes >= kHugePageBytes ? kHugePageBytes : kPageBytes);
+    return roundUp(bytes, step);
+}
+
+unsigned char* BufferPool::allocate(std::size_t bytes)
+{
+    if (bytes == 0) return nullptr;
+    const std::size_t blockBytes = sizeClass(bytes);
+    if (blockBytes < kMinPooledBytes) {
+        auto* data = static_cast<unsigned char*>(std::malloc(bytes));
+        if (data == nullptr) throw std::bad_alloc();
+        return data;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Newest first: the buffer released last is the one most likely still in cache
+        for (std::size_t i = idle.size(); i-- > 0;) {
+            if (idle[i].bytes == blockBytes) {
+                unsigned char* data = idle[i].data;
+                counters.idleBytes -= blockBytes;
+                ++counters.reused;
+                idle.erase(idle.begin() + static_cast<std::ptrdiff_t>(i));
+                return data;
+            }
+        }
+        ++counters.mapped;
+    }
+    try {
+        return mapBlock(blockBytes);
+    } catch (const std::bad_alloc&) {
+        // Idle buffers of other sizes may be all that stands in the way
+        trim();
+        return mapBlock(blockBytes);
+    }
+}
+
+void BufferPool::release(unsigned char* data, std::size_t bytes)
+{
+    if (data == nullptr) return;
+    const std::size_t blockBytes = sizeClass(bytes);
+    if (blockBytes < kMinPooledBytes) {
+        std::free(data);
+        return;
+    }
+    std::vector<Block> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (blockBytes <= maxIdle) {
+            idle.push_back({data, blockBytes});
+            counters.idleBytes += blockBytes;
+            data = nullptr;
+        }
+        evicted = evictTo(maxIdle);
+    }
+    // Unmapping outside the lock keeps other threads' allocations from waiting on the OS
+    if (data != nullptr) unmapBlock(data, blockBytes);
+    for (const Block& block : evicted) unmapBlock(block.data, block.bytes);
+}
+
+void BufferPool::setCapacity(std::size_t bytes)
+{
+    std::vector<Block> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        maxIdle = bytes;
+        evicted = evictTo(maxIdle);
+    }
+    for (const Block& block : evicted) unmapBlock(block.data, block.bytes);
+}
+
+std::size_t BufferPool::capacity() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxIdle;
+}
+
+void BufferPool::trim()
+{
+    std::vector<Block> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        evicted.swap(idle);
+        counters.idleBytes = 0;
+    }
+    for (const Block& block : evicted) unmapBlock(block.data, block.bytes);
+}
+
+std::vector<BufferPool::Block> BufferPool::evictTo(std::size_t limit)
+{
+    std::vector<Block> evicted;
+    std::size_t count = 0;
+    while (counters.idleBytes > limit) {
+        counters.idleBytes -= idle[count].bytes;
+        evicted.push_back(idle[count++]);
+    }
+    idle.erase(idle.begin(), idle.begin() + static_cast<std::ptrdiff_t>(count));
+    return evicted;
+}
+
+BufferPool::Stats BufferPool::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters;
+}
+
+unsigned char* BufferPool::mapBlock(std::size_t bytes)
+{
+#ifdef _WIN32
+    void* data = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (data == nullptr) throw std::bad_alloc();
+    return static_cast<unsigned char*>(data);
+#else
+    const bool huge = bytes >= kHugePageBytes;
+    // Huge pages need 2 MiB alignment: map one huge page more and cut the misaligned ends off
+    const std::size_t mappedBytes = huge ? bytes + kHugePageBytes : bytes;
+    void* mapped = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) throw std::bad_alloc();
+    auto* data = static_cast<unsigned char*>(mapped);
+    if (huge) {
+        const std::size_t address = reinterpret_cast<std::size_t>(mapped);
+        const std::size_t head = roundUp(address, kHugePageBytes) - address;
+        if (head > 0) munmap(data, head);
+        munmap(data + head + bytes, kHugePageBytes - head);
+        data += head;
+#ifdef MADV_HUGEPAGE
+        // Counted only when the kernel accepted the advice; unmapBlock() subtracts only those blocks
+        if (madvise(data, bytes, MADV_HUGEPAGE) == 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            hugeBlocks.insert(data);
+            counters.hugePageBytes += bytes;
+        }
+#endif
+    }
+    return data;
+#endif
+}
+
+void BufferPool::unmapBlock(unsigned char* data, std::size_t bytes)
+{
+#ifdef _WIN32
+    (void)bytes;
+    VirtualFree(data, 0, MEM_RELEASE);
+#else
+#ifdef MADV_HUGEPAGE
+    if (bytes >= kHugePageBytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (hugeBlocks.erase(data) > 0) counters.hugePageBytes -= bytes;
+    }
+#endif
+    munmap(data, bytes);
+#endif
+}
@@ -0,0 +1,169 @@
+/**
+ * @file BufferPool.h
+ * @brief Process-wide pool of large pixel buffers, reused between filters.
+ *
+ * This file declares the BufferPool class. Almost every filter writes into a
+ * fresh Image of the same size and then replaces the current image with it,
+ * which used to cost a multi-megabyte malloc, the page faults of touching it
+ * and a free on every step. The pool keeps released buffers and hands them
+ * out again, so successive filters ping-pong between the same two frames:
+ * the result of one filter is written into the buffer the previous one just
+ * released, whose pages are already mapped.
+ *
+ * @details The pool provides:
+ * - Size classes, four per power of two, so nearby sizes share buffers
+ * - Most recently released buffers handed out first (they are warm in cache and TLB)
+ * - A cap on idle bytes; the least recently used idle buffers are unmapped first
+ * - Page-aligned buffers mapped straight from the OS; on Linux buffers of
+ *   2 MiB and more are 2 MiB aligned and advised for transparent huge pages
+ * - Small requests (under 64 KiB) passed through to malloc
+ * - Thread safety: may be called from any thread
+ *
+ * @note Image allocates through the pool, so filters, HistoryManager and copy-on-write
+ *       detaches all use it; BufferPool::Lease is for raw scratch memory.
+ *       PHOTOSMITH_POOL_MB sets the idle cap at startup (0 disables caching).
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BUFFERPOOL_H
+#define BUFFERPOOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class BufferPool
+ * @brief Size-bucketed cache of page-mapped buffers.
+ *
+ * @code
+ * BufferPool::Lease scratch = BufferPool::instance().lease(bytes);
+ * process(scratch.data());
+ * // the buffer returns to the pool when scratch goes out of scope
+ * @endcode
+ */
+class BufferPool {
+public:
+    /**
+     * @brief Move-only ownership of one pooled buffer; returns it to the pool on destruction.
+     */
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept : bytes(other.bytes), buffer(other.buffer) { other.buffer = nullptr; }
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        /// First byte; uninitialised.
+        unsigned char* data() const { return buffer; }
+        /// Bytes requested.
+        std::size_t size() const { return bytes; }
+
+    private:
+        friend class BufferPool;
+        Lease(unsigned char* buffer, std::size_t bytes) : bytes(bytes), buffer(buffer) {}
+
+        std::size_t bytes = 0;
+        unsigned char* buffer = nullptr;
+    };
+
+    /**
+     * @brief Counters for diagnostics.
+     */
+    struct Stats {
+        std::size_t idleBytes = 0;     ///< Bytes of released buffers kept for reuse
+        std::size_t reused = 0;        ///< Requests served from an idle buffer
+        std::size_t mapped = 0;        ///< Requests that mapped a new buffer
+        std::size_t hugePageBytes = 0; ///< Bytes of live and idle buffers advised for huge pages
+    };
+
+    /**
+     * @brief The process-wide pool.
+     */
+    static BufferPool& instance();
+
+    /**
+     * @brief Returns an uninitialised buffer of at least @p bytes.
+     *
+     * Must be given back with release() and the same @p bytes.
+     * @throws std::bad_alloc If the memory cannot be mapped
+     */
+    unsigned char* allocate(std::size_t bytes);
+
+    /**
+     * @brief Gives back a buffer from allocate(); it is kept for reuse or unmapped.
+     *
+     * @param data Buffer returned by allocate() (nullptr is ignored)
+     * @param bytes The size passed to allocate()
+     */
+    void release(unsigned char* data, std::size_t bytes);
+
+    /**
+     * @brief allocate() wrapped in a Lease.
+     *
+     * @throws std::bad_alloc If the memory cannot be mapped
+     */
+    Lease lease(std::size_t bytes) { return Lease(allocate(bytes), bytes); }
+
+    /**
+     * @brief Limits the bytes of idle buffers kept; evicts the oldest ones beyond it.
+     */
+    void setCapacity(std::size_t bytes);
+
+    /**
+     * @brief Maximum bytes of idle buffers kept.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Unmaps every idle buffer (e.g. after closing a large image).
+     */
+    void trim();
+
+    /**
+     * @brief Current counters.
+     */
+    Stats stats() const;
+
+private:
+    BufferPool();
+
+    /// A mapped buffer waiting for reuse.
+    struct Block {
+        unsigned char* data;
+        std::size_t bytes; ///< Size class the buffer was mapped with
+    };
+
+    /**
+     * @brief Mapped size for a request of @p bytes: rounded up to its size class.
+     */
+    static std::size_t sizeClass(std::size_t bytes);
+
+    /// Maps @p bytes (a size class) from the OS.
+    unsigned char* mapBlock(std::size_t bytes);
+    /// Returns a block from mapBlock() to the OS.
+    void unmapBlock(unsigned char* data, std::size_t bytes);
+    /// Removes the oldest idle blocks until idleBytes <= limit and returns them for unmapping
+    /// after the lock is released. Needs the lock.
+    std::vector<Block> evictTo(std::size_t limit);
+
+    mutable std::mutex mutex;
+    std::vector<Block> idle;     ///< Idle blocks, least recently released first
+    std::size_t maxIdle;         ///< Capacity in bytes
+    Stats counters;
+    std::unordered_set<const unsigned char*> hugeBlocks; ///< Live and idle blocks whose huge-page advice succeeded
+};
+
+#endif // BUFFERPOOL_H
@@ -0,0 +1,149 @@
+/**
+ * @file DirtyRegion.cpp
+ * @brief Implementation of the dirty tile map.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "DirtyRegion.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+#include <cstring>
+
+DirtyRegion::DirtyRegion(int width, int height, int tileSize)
+    : imageWidth(std::max(0, width)), imageHeight(std::max(0, height)), tile(std::max(1, tileSize))
+{
+    columns = (imageWidth + tile - 1) / tile;
+    const int rows = (imageHeight + tile - 1) / tile;
+    tiles.assign(static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows), 0);
+}
+
+DirtyRegion DirtyRegion::between(const Image& before, const Image& after, int tileSize)
+{
+    if (before.width != after.width || before.height != after.height || before.format() != after.format()) {
+        return DirtyRegion();
+    }
+    DirtyRegion region(after.width, after.height, tileSize);
+    if (region.tiles.empty() || before.imageData == after.imageData) return region;
+
+    const int tile = region.tile;
+    const int columns = region.columns;
+    const int planes = after.format().isPlanar() ? after.channels : 1;
+    const std::size_t planeBytes = static_cast<std::size_t>(after.rowStride()) * static_cast<std::size_t>(after.height);
+    const std::size_t pixelBytes = static_cast<std::size_t>(after.pixelStride());
+    const int tileRows = static_cast<int>(region.tiles.size()) / columns;
+
+    ThreadPool::instance().parallelRows(tileRows, [&](int tileRowBegin, int tileRowEnd) {
+        for (int ty = tileRowBegin; ty < tileRowEnd; ++ty) {
+            unsigned char* dirty = region.tiles.data() + static_cast<std::size_t>(ty) * columns;
+            int remaining = columns;
+            const int rowEnd = std::min(after.height, (ty + 1) * tile);
+            // Row by row through the memory, skipping tiles already known to differ
+            for (int p = 0; p < planes && remaining > 0; ++p) {
+                for (int y = ty * tile; y < rowEnd && remaining > 0; ++y) {
+                    const std::size_t offset = p * planeBytes + static_cast<std::size_t>(y) * after.rowStride();
+                    const unsigned char* a = before.imageData + offset;
+                    const unsigned char* b = after.imageData + offset;
+                    for (int tx = 0; tx < columns; ++tx) {
+                        if (dirty[tx]) continue;
+                        const std::size_t begin = static_cast<std::size_t>(tx) * tile * pixelBytes;
+                        const std::size_t end = static_cast<std::size_t>(std::min(after.width, (tx + 1) * tile)) * pixelBytes;
+                        if (std::memcmp(a + begin, b + begin, end - begin) != 0) {
+                            dirty[tx] = 1;
+                            --remaining;
+                        }
+                    }
+                }
+            }
+        }
+    });
+    return region;
+}
+
+void DirtyRegion::mark(int x, int y, int width, int height)
+{
+    const int x0 = std::max(0, x);
+    const int y0 = std::max(0, y);
+    const int x1 = std::min(imageWidth, x + width);
+    const int y1 = std::min(imageHeight, y + height);
+    if (x0 >= x1 || y0 >= y1) return;
+    for (int ty = y0 / tile; ty <= (y1 - 1) / tile; ++ty) {
+        unsigned char* row = tiles.data() + static_cast<std::size_t>(ty) * columns;
+        std::fill(row + x0 / tile, row + (x1 - 1) / tile + 1, static_cast<unsigned char>(1));
+    }
+}
+
+void DirtyRegion::markAll()
+{
+    std::fill(tiles.begin(), tiles.end(), static_cast<unsigned char>(1));
+}
+
+void DirtyRegion::merge(const DirtyRegion& other)
+{
+    if (!covers(other.imageWidth, other.imageHeight) || other.tile != tile) {
+        markAll();
+        return;
+    }
+    for (std::size_t i = 0; i < tiles.size(); ++i) tiles[i] |= other.tiles[i];
+}
+
+bool DirtyRegion::empty() const
+{
+    return std::find(tiles.begin(), tiles.end(), 1) == tiles.end();
+}
+
+bool DirtyRegion::rowsDirty(int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(imageHeight, rowEnd);
+    if (rowBegin >= rowEnd) return false;
+    const auto first = tiles.begin() + static_cast<std::ptrdiff_t>(rowBegin / tile) * columns;
+    const auto last = tiles.begin() + static_cast<std::ptrdiff_t>((rowEnd - 1) / tile + 1) * columns;
+    return std::find(first, last, 1) != last;
+}
+
+std::size_t DirtyRegion::dirtyTiles() const
+{
+    return static_cast<std::size_t>(std::count(tiles.begin(), tiles.end(), 1));
+}
+
+std::vector<DirtyRegion::Rect> DirtyRegion::rects() const
+{
+    std::vector<Rect> result;
+    const int rows = columns > 0 ? static_cast<int>(tiles.size()) / columns : 0;
+    for (int ty = 0; ty < rows; ++ty) {
+        const unsigned char* row = tiles.data() + static_cast<std::size_t>(ty) * columns;
+        for (int tx = 0; tx < columns;) {
+            if (!row[tx]) {
+                ++tx;
+                continue;
+            }
+            const int runBegin = tx;
+            while (tx < columns && row[tx]) ++tx;
+            const int x = runBegin * tile;
+            const int y = ty * tile;
+            result.push_back({x, y, std::min(imageWidth, tx * tile) - x, std::min(imageHeight, y + tile) - y});
+        }
+    }
+    return result;
+}
+
+DirtyRegion::Rect DirtyRegion::bounds() const
+{
+    int x0 = imageWidth, y0 = imageHeight, x1 = 0, y1 = 0;
+    for (const Rect& rect : rects()) {
+        x0 = std::min(x0, rect.x);
+        y0 = std::min(y0, rect.y);
+        x1 = std::max(x1, rect.x + rect.width);
+        y1 = std::max(y1, rect.y + rect.height);
+    }
+    return x0 < x1 ? Rect{x0, y0, x1 - x0, y1 - y0} : Rect{};
+}
@@ -0,0 +1,156 @@
+/**
+ * @file DirtyRegion.h
+ * @brief Tile map of the part of an image an edit changed.
+ *
+ * This file declares the DirtyRegion class, the record of where an edit
+ * touched an image. The image is divided into square tiles and each tile is
+ * either clean (every byte equal before and after the edit) or dirty. The
+ * same map drives the display and the history: only dirty tiles are reduced
+ * into the display pyramid, rescaled and repainted, and history blocks over
+ * clean rows are stored as references to their neighbour instead of deltas.
+ *
+ * @details The region provides:
+ * - mark() for operations that know the rectangle they touched
+ * - between(), which finds the dirty tiles of two images by comparing them,
+ *   row-parallel and stopping at the first difference of each tile
+ * - Dirty rectangles (one per run of dirty tiles in a tile row), their
+ *   bounds, and a test for any dirty tile among a range of rows
+ *
+ * @note A default-constructed region describes no image. Callers treat it,
+ *       like any region whose size does not match the image, as "everything
+ *       may have changed" (see covers()).
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef DIRTYREGION_H
+#define DIRTYREGION_H
+
+#include <cstddef>
+#include <vector>
+#include "Image_Class.h"
+
+/**
+ * @class DirtyRegion
+ * @brief Which tiles of an image an edit changed.
+ *
+ * @code
+ * Image before = image;                       // O(1): shares the buffer
+ * applySomeFilter(image);
+ * const DirtyRegion changed = DirtyRegion::between(before, image);
+ * for (const DirtyRegion::Rect& rect : changed.rects()) repaint(rect);
+ * @endcode
+ */
+class DirtyRegion {
+public:
+    /// Default tile edge in pixels.
+    static constexpr int DefaultTileSize = 128;
+
+    /**
+     * @brief A rectangle in image pixels.
+     */
+    struct Rect {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+
+        bool empty() const { return width <= 0 || height <= 0; }
+    };
+
+    /**
+     * @brief A region describing no image (see covers()).
+     */
+    DirtyRegion() = default;
+
+    /**
+     * @brief A clean region over a @p width x @p height image.
+     *
+     * @param width Image width
+     * @param height Image height
+     * @param tileSize Tile edge in pixels (at least 1)
+     */
+    DirtyRegion(int width, int height, int tileSize = DefaultTileSize);
+
+    /**
+     * @brief The tiles in which @p before and @p after differ.
+     *
+     * Images of different sizes or formats give a default-constructed region.
+     *
+     * @param before Image before the edit
+     * @param after Image after the edit
+     * @param tileSize Tile edge in pixels (at least 1)
+     */
+    static DirtyRegion between(const Image& before, const Image& after, int tileSize = DefaultTileSize);
+
+    /**
+     * @brief True if the region describes an image of @p image's size.
+     */
+    bool covers(const Image& image) const { return covers(image.width, image.height); }
+
+    /**
+     * @brief True if the region describes a @p width x @p height image.
+     */
+    bool covers(int width, int height) const { return tiles.size() > 0 && width == imageWidth && height == imageHeight; }
+
+    /**
+     * @brief Marks every tile overlapping the rectangle, clipped to the image.
+     */
+    void mark(int x, int y, int width, int height);
+
+    /**
+     * @brief Marks every tile.
+     */
+    void markAll();
+
+    /**
+     * @brief Adds the tiles of @p other; marks everything if the two do not describe the same image.
+     */
+    void merge(const DirtyRegion& other);
+
+    /**
+     * @brief True if no tile is dirty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief True if any tile overlapping rows [@p rowBegin, @p rowEnd) is dirty.
+     */
+    bool rowsDirty(int rowBegin, int rowEnd) const;
+
+    /**
+     * @brief Number of dirty tiles.
+     */
+    std::size_t dirtyTiles() const;
+
+    /**
+     * @brief Dirty tiles, one rectangle per horizontal run, clipped to the image.
+     */
+    std::vector<Rect> rects() const;
+
+    /**
+     * @brief Smallest rectangle containing every dirty tile (empty if none).
+     */
+    Rect bounds() const;
+
+    int width() const { return imageWidth; }
+    int height() const { return imageHeight; }
+    int tileSize() const { return tile; }
+
+private:
+    int imageWidth = 0;
+    int imageHeight = 0;
+    int tile = DefaultTileSize;
+    int columns = 0;                 ///< Tiles per row
+    std::vector<unsigned char> tiles; ///< 1 for a dirty tile, row-major
+};
+
+#endif // DIRTYREGION_H
@@ -0,0 +1,198 @@
+/**
+ * @file ImagePyramid.cpp
+ * @brief Implementation of the display pyramid.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "ImagePyramid.h"
+#include "../parallel/ThreadPool.h"
+#include <algorithm>
+#include <optional>
+
+namespace {
+
+/**
+ * @brief Writes columns [x0, x1) of rows [rowBegin, rowEnd) of @p dst, each the mean of a 2x2 block of @p src.
+ */
+void reduceRows(const ConstImageView& src, const ImageView& dst, int x0, int x1, int rowBegin, int rowEnd)
+{
+    const int channels = src.channels;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const unsigned char* top = src.row(2 * y);
+        const unsigned char* bottom = src.row(std::min(2 * y + 1, src.height - 1));
+        unsigned char* out = dst.row(y);
+        for (int x = x0; x < x1; ++x) {
+            const int left = 2 * x * channels;
+            const int right = std::min(2 * x + 1, src.width - 1) * channels;
+            for (int c = 0; c < channels; ++c) {
+                const int sum = top[left + c] + top[right + c] + bottom[left + c] + bottom[right + c];
+                out[x * channels + c] = static_cast<unsigned char>((sum + 2) >> 2);
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool ImagePyramid::holds(const Image& source) const
+{
+    if (levels.empty()) return false;
+    const Image& base = levels.front();
+    return base.imageData == source.imageData && base.width == source.width
+        && base.height == source.height && base.channels == source.channels;
+}
+
+bool ImagePyramid::sync(const Image& source)
+{
+    if (holds(source)) return false;
+    levels.clear();
+    levels.push_back(source); // O(1): shares the buffer copy-on-write
+    return true;
+}
+
+bool ImagePyramid::update(const Image& previous, const Image& source, const DirtyRegion& changed)
+{
+    if (!holds(previous) || !changed.covers(source) || source.width != previous.width
+        || source.height != previous.height || source.format() != previous.format()) {
+        return false;
+    }
+    levels.front() = source;
+
+    // A level pixel depends on a 2x2 block of the level above, so each rectangle halves, rounded outwards
+    std::vector<DirtyRegion::Rect> rects = changed.rects();
+    for (std::size_t k = 1; k < levels.size(); ++k) {
+        for (DirtyRegion::Rect& rect : rects) {
+            const int x0 = rect.x / 2;
+            const int y0 = rect.y / 2;
+            rect = {x0, y0, (rect.x + rect.width + 1) / 2 - x0, (rect.y + rect.height + 1) / 2 - y0};
+        }
+        const ConstImageView src = levels[k - 1].constView();
+        const ImageView dst = levels[k].view();
+        for (const DirtyRegion::Rect& rect : rects) {
+            ThreadPool::instance().parallelRows(rect.height, [&](int rowBegin, int rowEnd) {
+                reduceRows(src, dst, rect.x, rect.x + rect.width, rect.y + rowBegin, rect.y + rowEnd);
+            });
+        }
+    }
+    return true;
+}
+
+const Image& ImagePyramid::levelFor(int targetWidth, int targetHeight)
+{
+    std::size_t index = 0;
+    while (true) {
+        const Image& level = levels[index];
+        // The next level would be smaller than the target (or cannot shrink)
+        if ((level.width + 1) / 2 < targetWidth || (level.height + 1) / 2 < targetHeight
+            || (level.width <= 1 && level.height <= 1)) {
+            break;
+        }
+        if (index + 1 == levels.size()) {
+            Image next = reduce(level); // `level` may dangle once levels grows
+            levels.push_back(std::move(next));
+        }
+        ++index;
+    }
+    return levels[index];
+}
+
+Image ImagePyramid::scaled(int targetWidth, int targetHeight, Resampler::Filter filter)
+{
+    const Image& level = levelFor(targetWidth, targetHeight);
+    if (level.width == targetWidth && level.height == targetHeight) return level;
+    Image result(targetWidth, targetHeight);
+    Resampler::resize(level.constView(), result.view(), filter);
+    return result;
+}
+
+std::vector<ImagePyramid::Patch> ImagePyramid::scaledPatches(int targetWidth, int targetHeight,
+                                                             const DirtyRegion& changed, Resampler::Filter filter)
+{
+    std::vector<Patch> patches;
+    const std::vector<DirtyRegion::Rect> rects = changed.rects();
+    if (rects.empty()) return patches;
+
+    const Image& level = levelFor(targetWidth, targetHeight);
+    const int shift = static_cast<int>(&level - levels.data()); // Level pixels cover 2^shift base pixels
+    const bool copy = level.width == targetWidth && level.height == targetHeight;
+    std::optional<Resampler::Plan> plan;
+    if (!copy) plan.emplace(level.width, level.height, targetWidth, targetHeight, level.channels, filter);
+
+    // Target rows and columns each rectangle reaches, through the level and the resampling taps
+    struct Span {
+        int rowBegin, rowEnd, columnBegin, columnEnd;
+    };
+    std::vector<Span> spans;
+    for (const DirtyRegion::Rect& rect : rects) {
+        const int x0 = rect.x >> shift;
+        const int x1 = ((rect.x + rect.width - 1) >> shift) + 1;
+        const int y0 = rect.y >> shift;
+        const int y1 = ((rect.y + rect.height - 1) >> shift) + 1;
+        const auto rows = copy ? std::make_pair(y0, y1) : plan->targetRows(y0, y1);
+        const auto columns = copy ? std::make_pair(x0, x1) : plan->targetColumns(x0, x1);
+        if (rows.first < rows.second && columns.first < columns.second) {
+            spans.push_back({rows.first, rows.second, columns.first, columns.second});
+        }
+    }
+    std::sort(spans.begin(), spans.end(), [](const Span& a, const Span& b) { return a.rowBegin < b.rowBegin; });
+
+    const ConstImageView src = level.constView();
+    for (std::size_t i = 0; i < spans.size();) {
+        Span band = spans[i++];
+        while (i < spans.size() && spans[i].rowBegin <= band.rowEnd) {
+            band.rowEnd = std::max(band.rowEnd, spans[i].rowEnd);
+            band.columnBegin = std::min(band.columnBegin, spans[i].columnBegin);
+            band.columnEnd = std::max(band.columnEnd, spans[i].columnEnd);
+            ++i;
+        }
+        const int rows = band.rowEnd - band.rowBegin;
+        const int columns = band.columnEnd - band.columnBegin;
+        Patch patch{band.columnBegin, band.rowBegin, Image(columns, rows)};
+        if (copy) {
+            patch.pixels.view().copyFrom(src.subView(band.columnBegin, band.rowBegin, columns, rows));
+        } else {
+            // Resampler rows are always full width; the columns outside the band are dropped
+            Image scaledRows(targetWidth, rows);
+            const ImageView out = scaledRows.view();
+            ThreadPool& pool = ThreadPool::instance();
+            pool.parallelRows(rows, [&](int rowBegin, int rowEnd) {
+                plan->rows(src, band.rowBegin + rowBegin, band.rowBegin + rowEnd,
+                           out.subView(0, rowBegin, targetWidth, rowEnd - rowBegin));
+            }, nullptr, {}, plan->grain(pool.concurrency()));
+            patch.pixels.view().copyFrom(scaledRows.constView().subView(band.columnBegin, 0, columns, rows));
+        }
+        patches.push_back(std::move(patch));
+    }
+    return patches;
+}
+
+std::size_t ImagePyramid::memoryUsage() const
+{
+    std::size_t total = 0;
+    for (std::size_t i = 1; i < levels.size(); ++i) total += levels[i].byteSize();
+    return total;
+}
+
+Image ImagePyramid::reduce(const Image& source)
+{
+    const int width = (source.width + 1) / 2;
+    const int height = (source.height + 1) / 2;
+    Image result(width, height);
+    if (result.byteSize() == 0) return result;
+
+    const ConstImageView src = source.constView();
+    const ImageView dst = result.view();
+    ThreadPool::instance().parallelRows(height, [&](int rowBegin, int rowEnd) {
+        reduceRows(src, dst, 0, width, rowBegin, rowEnd);
+    });
+    return result;
+}
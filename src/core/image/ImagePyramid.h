@@ -0,0 +1,181 @@
+/**
+ * @file ImagePyramid.h
+ * @brief Cache of successively halved copies of an image for fast display.
+ *
+ * This file declares the ImagePyramid class, which keeps an image together
+ * with 2x box-filtered reductions of it (a mip pyramid). Displaying a large
+ * photo in a small viewport then scales down from the nearest level instead of
+ * from the full-resolution pixels, so redraws on resize or zoom stay cheap.
+ *
+ * @details The pyramid provides:
+ * - Level 0 shared with the source image (copy-on-write, no copy)
+ * - Reduced levels built lazily, only as deep as a request needs
+ * - Automatic invalidation when the source buffer is replaced or detached
+ * - Row-parallel reduction on the shared ThreadPool
+ * - scaled(): any size, resampled from the nearest level with Resampler
+ * - update() and scaledPatches() for edits with a DirtyRegion: only the
+ *   changed tiles of each level are reduced again, and only the target
+ *   pixels they reach are resampled
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef IMAGEPYRAMID_H
+#define IMAGEPYRAMID_H
+
+#include <cstddef>
+#include <vector>
+#include "DirtyRegion.h"
+#include "Image_Class.h"
+#include "Resampler.h"
+
+/**
+ * @class ImagePyramid
+ * @brief Lazily built 2x reductions of one image.
+ *
+ * Level k is level k - 1 halved in each dimension (rounded up), each pixel the
+ * rounded mean of a 2x2 block. Levels are plain Images and stay valid until
+ * the next sync() that rebuilds the pyramid or the next clear().
+ *
+ * @code
+ * pyramid.sync(currentImage);              // O(1) unless the image changed
+ * const Image& level = pyramid.levelFor(800, 600);
+ * // Scale `level` (at least 800x600 or the full image) down to the viewport,
+ * // or let the pyramid do it:
+ * Image fitted = pyramid.scaled(800, 600);
+ * @endcode
+ *
+ * @note Not thread-safe; use from one thread (the GUI thread).
+ */
+class ImagePyramid {
+public:
+    /**
+     * @brief Makes @p source the pyramid's base image.
+     *
+     * The base is held as a copy-on-write copy, so its buffer stays alive and
+     * a source whose pixels change always gets a new buffer. Comparing buffers
+     * is therefore enough to detect a change.
+     *
+     * @param source Image to display
+     * @return True if the pyramid was rebuilt, false if @p source is unchanged
+     */
+    bool sync(const Image& source);
+
+    /**
+     * @brief Makes @p source the base image, given that it differs from @p previous only inside @p changed.
+     *
+     * If the pyramid holds @p previous, the levels already built keep their
+     * buffers and only the blocks under the changed tiles are reduced again.
+     * Otherwise nothing happens, and the next sync() rebuilds the pyramid.
+     *
+     * @param previous Image the pyramid was last synced to
+     * @param source Image to display, the size and format of @p previous
+     * @param changed Every pixel in which @p source differs from @p previous
+     * @return True if the pyramid now holds @p source
+     */
+    bool update(const Image& previous, const Image& source, const DirtyRegion& changed);
+
+    /**
+     * @brief Releases the base image and every level.
+     */
+    void clear() { levels.clear(); }
+
+    /**
+     * @brief True if no image has been synced.
+     */
+    bool empty() const { return levels.empty(); }
+
+    /**
+     * @brief Returns the smallest level at least @p targetWidth x @p targetHeight.
+     *
+     * Builds missing levels on demand. Returns the base image when the target
+     * is as large as the image or larger.
+     *
+     * @param targetWidth Width the level will be scaled down to
+     * @param targetHeight Height the level will be scaled down to
+     * @return The chosen level
+     *
+     * @note Must not be called on an empty pyramid.
+     */
+    const Image& levelFor(int targetWidth, int targetHeight);
+
+    /**
+     * @brief Returns the image at exactly @p targetWidth x @p targetHeight.
+     *
+     * Resamples the level levelFor() picks, which is at most twice as large,
+     * so downscales read few pixels however large the base is.
+     *
+     * @param targetWidth Width of the result (at least 1)
+     * @param targetHeight Height of the result (at least 1)
+     * @param filter Resampling filter; the box filter averages by area
+     * @return The scaled image, sharing the level's buffer if no scaling was needed
+     *
+     * @note Must not be called on an empty pyramid.
+     */
+    Image scaled(int targetWidth, int targetHeight, Resampler::Filter filter = Resampler::Filter::Box);
+
+    /**
+     * @brief A block of pixels at (x, y) in a scaled() image.
+     */
+    struct Patch {
+        int x = 0;
+        int y = 0;
+        Image pixels;
+    };
+
+    /**
+     * @brief The parts of scaled() that pixels of the base inside @p changed reach.
+     *
+     * Painting the patches over an earlier scaled() result of the same size
+     * gives exactly the scaled() result for the current base. Dirty rectangles
+     * whose target rows overlap are merged, so each target row is resampled
+     * at most once.
+     *
+     * @param targetWidth Width of the scaled image (at least 1)
+     * @param targetHeight Height of the scaled image (at least 1)
+     * @param changed Changed pixels of the base (see update())
+     * @param filter Resampling filter, the one given to scaled()
+     * @return The patches, none if @p changed is empty
+     *
+     * @note Must not be called on an empty pyramid.
+     */
+    std::vector<Patch> scaledPatches(int targetWidth, int targetHeight, const DirtyRegion& changed,
+                                     Resampler::Filter filter = Resampler::Filter::Box);
+
+    /**
+     * @brief Number of levels built so far, including the base.
+     */
+    std::size_t levelCount() const { return levels.size(); }
+
+    /**
+     * @brief Bytes held by the reduced levels (the base is shared).
+     */
+    std::size_t memoryUsage() const;
+
+    /**
+     * @brief Halves @p source with a 2x2 box filter.
+     *
+     * @param source Image to reduce
+     * @return Image of size ceil(width / 2) x ceil(height / 2); odd edges
+     *         average the last row or column with itself
+     */
+    static Image reduce(const Image& source);
+
+private:
+    /**
+     * @brief True if the base is @p source: the same buffer, size and channel count.
+     */
+    bool holds(const Image& source) const;
+
+    std::vector<Image> levels; ///< levels[0] is the base, each next one half the size
+};
+
+#endif // IMAGEPYRAMID_H
@@ -0,0 +1,247 @@
+/**
+ * @file ImageView.h
+ * @brief Lightweight, stride-aware views over interleaved 8-bit pixel data.
+ *
+ * This file declares ImageView and ConstImageView, non-owning windows onto a
+ * pixel buffer (usually one owned by an Image). They give filter kernels direct
+ * row-pointer access so inner loops run without per-pixel bounds checks or
+ * exceptions, which lets the compiler keep them branch-free and vectorize them.
+ *
+ * @details The views provide:
+ * - Row pointers via row(y) and pixel pointers via pixelAt(x, y)
+ * - Unchecked channel access via operator()(x, y, c)
+ * - Sub-views (tiles, bands) sharing the parent stride
+ * - Row-wise fill() and copyFrom() for solid areas and pastes
+ * - Bounds checking through assert() in debug builds only
+ *
+ * @note A view never owns memory. It is only valid while the underlying buffer
+ *       is alive and unmodified in size; obtain a fresh view after reassigning
+ *       or resizing an Image.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef IMAGEVIEW_H
+#define IMAGEVIEW_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @class ConstImageView
+ * @brief Read-only, non-owning view of interleaved 8-bit pixels.
+ *
+ * @see ImageView for the writable counterpart
+ * @see Image::constView() to obtain a view of an image
+ */
+class ConstImageView {
+public:
+    const unsigned char* data = nullptr; ///< Pointer to the first pixel of the view.
+    int width = 0;                       ///< Width of the view in pixels.
+    int height = 0;                      ///< Height of the view in pixels.
+    int channels = 3;                    ///< Interleaved channels per pixel.
+    std::ptrdiff_t stride = 0;           ///< Distance in bytes between consecutive rows.
+
+    ConstImageView() = default;
+
+    /**
+     * @brief Constructs a view over existing pixel memory.
+     *
+     * @param data Pointer to the first pixel.
+     * @param width Width in pixels.
+     * @param height Height in pixels.
+     * @param channels Interleaved channels per pixel.
+     * @param stride Bytes between rows (at least width * channels).
+     */
+    ConstImageView(const unsigned char* data, int width, int height, int channels, std::ptrdiff_t stride)
+        : data(data), width(width), height(height), channels(channels), stride(stride) {}
+
+    /**
+     * @brief Returns a pointer to the first byte of row @p y.
+     */
+    const unsigned char* row(int y) const {
+        assert(y >= 0 && y < height);
+        return data + static_cast<std::ptrdiff_t>(y) * stride;
+    }
+
+    /**
+     * @brief Returns a pointer to the first channel of pixel (x, y).
+     */
+    const unsigned char* pixelAt(int x, int y) const {
+        assert(x >= 0 && x < width);
+        return row(y) + static_cast<std::ptrdiff_t>(x) * channels;
+    }
+
+    /**
+     * @brief Unchecked channel access (checked with assert() in debug builds).
+     *
+     * @param x The x-coordinate of the pixel.
+     * @param y The y-coordinate of the pixel.
+     * @param c The channel index.
+     * @return The channel value.
+     */
+    const unsigned char& operator()(int x, int y, int c) const {
+        assert(c >= 0 && c < channels);
+        return pixelAt(x, y)[c];
+    }
+
+    /**
+     * @brief Returns a view of the rectangle (x, y, w, h) sharing this view's stride.
+     */
+    ConstImageView subView(int x, int y, int w, int h) const {
+        assert(x >= 0 && y >= 0 && w >= 0 && h >= 0 && x + w <= width && y + h <= height);
+        return ConstImageView(data + static_cast<std::ptrdiff_t>(y) * stride + static_cast<std::ptrdiff_t>(x) * channels,
+                              w, h, channels, stride);
+    }
+
+    /**
+     * @brief Number of meaningful bytes in one row (width * channels).
+     */
+    std::ptrdiff_t rowBytes() const { return static_cast<std::ptrdiff_t>(width) * channels; }
+
+    /**
+     * @brief True when rows follow each other without padding.
+     */
+    bool isContiguous() const { return stride == rowBytes(); }
+
+    /**
+     * @brief True when the view covers no pixels.
+     */
+    bool empty() const { return data == nullptr || width <= 0 || height <= 0; }
+};
+
+/**
+ * @class ImageView
+ * @brief Writable, non-owning view of interleaved 8-bit pixels.
+ *
+ * @see ConstImageView for the read-only counterpart
+ * @see Image::view() to obtain a view of an image
+ */
+class ImageView {
+public:
+    unsigned char* data = nullptr; ///< Pointer to the first pixel of the view.
+    int width = 0;                 ///< Width of the view in pixels.
+    int height = 0;                ///< Height of the view in pixels.
+    int channels = 3;              ///< Interleaved channels per pixel.
+    std::ptrdiff_t stride = 0;     ///< Distance in bytes between consecutive rows.
+
+    ImageView() = default;
+
+    /**
+     * @brief Constructs a view over existing pixel memory.
+     *
+     * @param data Pointer to the first pixel.
+     * @param width Width in pixels.
+     * @param height Height in pixels.
+     * @param channels Interleaved channels per pixel.
+     * @param stride Bytes between rows (at least width * channels).
+     */
+    ImageView(unsigned char* data, int width, int height, int channels, std::ptrdiff_t stride)
+        : data(data), width(width), height(height), channels(channels), stride(stride) {}
+
+    /**
+     * @brief Returns a pointer to the first byte of row @p y.
+     */
+    unsigned char* row(int y) const {
+        assert(y >= 0 && y < height);
+        return data + static_cast<std::ptrdiff_t>(y) * stride;
+    }
+
+    /**
+     * @brief Returns a pointer to the first channel of pixel (x, y).
+     */
+    unsigned char* pixelAt(int x, int y) const {
+        assert(x >= 0 && x < width);
+        return row(y) + static_cast<std::ptrdiff_t>(x) * channels;
+    }
+
+    /**
+     * @brief Unchecked channel access (checked with assert() in debug builds).
+     *
+     * @param x The x-coordinate of the pixel.
+     * @param y The y-coordinate of the pixel.
+     * @param c The channel index.
+     * @return Reference to the channel value.
+     */
+    unsigned char& operator()(int x, int y, int c) const {
+        assert(c >= 0 && c < channels);
+        return pixelAt(x, y)[c];
+    }
+
+    /**
+     * @brief Returns a view of the rectangle (x, y, w, h) sharing this view's stride.
+     */
+    ImageView subView(int x, int y, int w, int h) const {
+        assert(x >= 0 && y >= 0 && w >= 0 && h >= 0 && x + w <= width && y + h <= height);
+        return ImageView(data + static_cast<std::ptrdiff_t>(y) * stride + static_cast<std::ptrdiff_t>(x) * channels,
+                         w, h, channels, stride);
+    }
+
+    /**
+     * @brief Number of meaningful bytes in one row (width * channels).
+     */
+    std::ptrdiff_t rowBytes() const { return static_cast<std::ptrdiff_t>(width) * channels; }
+
+    /**
+     * @brief True when rows follow each other without padding.
+     */
+    bool isContiguous() const { return stride == rowBytes(); }
+
+    /**
+     * @brief True when the view covers no pixels.
+     */
+    bool empty() const { return data == nullptr || width <= 0 || height <= 0; }
+
+    /**
+     * @brief Fills every pixel of the view with one RGB colour.
+     *
+     * The first row is written pixel by pixel and then replicated with memcpy,
+     * so large solid areas (frame backgrounds) cost one copy per row.
+     *
+     * @param r Red value.
+     * @param g Green value.
+     * @param b Blue value.
+     */
+    void fill(unsigned char r, unsigned char g, unsigned char b) const {
+        if (empty()) return;
+        unsigned char* first = data;
+        for (int x = 0; x < width; ++x) {
+            unsigned char* p = first + static_cast<std::ptrdiff_t>(x) * channels;
+            p[0] = r;
+            if (channels > 1) p[1] = g;
+            if (channels > 2) p[2] = b;
+        }
+        for (int y = 1; y < height; ++y) {
+            std::memcpy(row(y), first, static_cast<std::size_t>(rowBytes()));
+        }
+    }
+
+    /**
+     * @brief Copies @p src into the top-left corner of this view, row by row.
+     *
+     * @param src Source view; must not be larger than this view and must have
+     *            the same channel count.
+     */
+    void copyFrom(const ConstImageView& src) const {
+        assert(src.width <= width && src.height <= height && src.channels == channels);
+        for (int y = 0; y < src.height; ++y) {
+            std::memcpy(row(y), src.row(y), static_cast<std::size_t>(src.rowBytes()));
+        }
+    }
+
+    /**
+     * @brief Implicit conversion to a read-only view of the same pixels.
+     */
+    operator ConstImageView() const { return ConstImageView(data, width, height, channels, stride); }
+};
+
+#endif // IMAGEVIEW_H
@@ -19,7 +19,9 @@
  * - Multi-format support: PNG, JPEG, BMP, TGA
  * - Automatic memory management with RAII principles
  * - Safe pixel access with bounds checking
- * - Copy constructor and assignment operator
+ * - Unchecked row-pointer access for hot loops through ImageView
+ * - Gray, RGB and RGBA pixels, 8 or 16 bits per sample, interleaved or planar
+ * - Copy-on-write copies and move semantics (O(1) hand-off)
  * - STB library integration for robust I/O
  * - Exception safety and error handling
  * - Cross-platform compatibility
@@ -62,6 +64,9 @@
 // Forward declarations for STB functions
 extern "C" {
     unsigned char *stbi_load(char const *filename, int *x, int *y, int *channels_in_file, int desired_channels);
+    unsigned short *stbi_load_16(char const *filename, int *x, int *y, int *channels_in_file, int desired_channels);
+    int stbi_info(char const *filename, int *x, int *y, int *comp);
+    int stbi_is_16_bit(char const *filename);
     void stbi_image_free(void *retval_from_stbi_load);
     int stbi_write_png(char const *filename, int w, int h, int comp, const void *data, int stride_in_bytes);
     int stbi_write_bmp(char const *filename, int w, int h, int comp, const void *data);
@@ -75,8 +80,17 @@ extern "C" {
 #include <iostream>
 #include <exception>
 #include <cstring>
+#include <cstdlib>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
 #include <string.h>
 
+#include "BufferPool.h"
+#include "ImageView.h"
+#include "PixelFormat.h"
+
 
 /**
  * @class Image
@@ -98,7 +112,7 @@ extern "C" {
  * - Multi-format support: PNG, JPEG, BMP, TGA
  * - Automatic memory management with RAII principles
  * - Safe pixel access with bounds checking and exception handling
- * - Copy constructor and assignment operator with deep copying
+ * - Copy-on-write copy constructor/assignment and O(1) move operations
  * - STB library integration for professional-grade image I/O
  * - Exception safety with descriptive error messages
  * - Cross-platform file path handling
@@ -134,7 +148,7 @@ private:
      * @param filename The filename to check.
      * @return True if the filename has a valid extension, false otherwise.
      */
-    bool isValidFilename(const std::string& filename) {
+    bool isValidFilename(const std::string& filename) const {
         std::size_t dotPos = filename.rfind('.');
         if (dotPos == std::string::npos || dotPos == filename.size() - 1) {
             std::cerr << "Invalid filename: " << filename << std::endl;
@@ -150,7 +164,7 @@ private:
      * @return The type of image format
      */
 
-    short getExtensionType(const char* extension) {
+    short getExtensionType(const char* extension) const {
         if (extension == nullptr) return UNSUPPORTED_TYPE;
         std::string extStr(extension);
         for (char& ch : extStr) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
@@ -174,11 +188,87 @@ private:
 private:
     std::string filename; ///< Stores the filename of the image.
 
+    /**
+     * @brief Shared, reference-counted pixel storage.
+     *
+     * Copies of an Image share this buffer until one of them is written to, at
+     * which point the writer takes a private copy (copy-on-write). The deleter
+     * always matches the allocator that produced the memory (stbi or BufferPool).
+     */
+    std::shared_ptr<unsigned char> buffer;
+
+    /**
+     * @brief Allocates an uninitialised pixel buffer from the BufferPool.
+     *
+     * The buffer goes back to the pool when the last image sharing it lets
+     * go, so the next image of a similar size reuses its already-mapped pages.
+     *
+     * @param bytes Number of bytes to allocate.
+     * @return Shared pointer owning the allocation (empty when bytes is 0).
+     * @throws std::bad_alloc If the allocation fails.
+     */
+    static std::shared_ptr<unsigned char> allocateBuffer(std::size_t bytes) {
+        if (bytes == 0) {
+            return {};
+        }
+        unsigned char* data = BufferPool::instance().allocate(bytes);
+        trackAllocation(bytes);
+        return std::shared_ptr<unsigned char>(data, [bytes](unsigned char* p) {
+            BufferPool::instance().release(p, bytes);
+            trackRelease(bytes);
+        });
+    }
+
+    static inline std::atomic<std::size_t> liveBytes{0};      ///< Bytes of all pixel buffers alive now
+    static inline std::atomic<std::size_t> peakBytes{0};      ///< Highest liveBytes since the last reset
+    static inline std::atomic<std::size_t> allocatedBytes{0}; ///< Bytes of all pixel buffers ever allocated
+
+    /**
+     * @brief Counts a new pixel buffer in the process-wide memory statistics.
+     */
+    static void trackAllocation(std::size_t bytes) {
+        allocatedBytes += bytes;
+        const std::size_t live = liveBytes += bytes;
+        std::size_t peak = peakBytes.load();
+        while (live > peak && !peakBytes.compare_exchange_weak(peak, live)) {
+        }
+    }
+
+    /**
+     * @brief Removes a released pixel buffer from the memory statistics.
+     */
+    static void trackRelease(std::size_t bytes) {
+        liveBytes -= bytes;
+    }
+
+    /**
+     * @brief Releases the pixel buffer and resets the image to the empty state.
+     */
+    void reset() {
+        buffer.reset();
+        imageData = nullptr;
+        width = 0;
+        height = 0;
+    }
+
+    /**
+     * @brief Throws unless ImageView can address the pixels (8-bit interleaved).
+     */
+    void requireInterleaved8(const char* operation) const {
+        if (!format().isInterleaved8()) {
+            throw std::logic_error(std::string(operation) + " needs 8-bit interleaved pixels, not "
+                                   + format().name() + "; convert the image with PixelConverter first");
+        }
+    }
+
+    SampleDepth depth = SampleDepth::U8;           ///< Bits per sample
+    PixelLayout layout = PixelLayout::Interleaved; ///< Interleaved or planar channels
+
 public:
     int width = 0; ///< Width of the image.
     int height = 0; ///< Height of the image.
     int channels = 3; ///< Number of color channels in the image.
-    unsigned char* imageData = nullptr; ///< Pointer to the image data.
+    unsigned char* imageData = nullptr; ///< Pointer to the image data (owned by the shared buffer).
 
     /**
      * @brief Default constructor for the Image class.
@@ -195,29 +285,70 @@ public:
     }
 
     /**
-     * @brief Constructor that creates an image with the specified dimensions.
+     * @brief Constructor that creates an 8-bit RGB image with the specified dimensions.
+     *
+     * @param mWidth The width of the image.
+     * @param mHeight The height of the image.
+     * @throws std::bad_alloc If the pixel buffer cannot be allocated.
+     */
+    Image(int mWidth, int mHeight) : Image(mWidth, mHeight, PixelFormat::rgb8()) {}
+
+    /**
+     * @brief Constructor that creates an image with the specified dimensions and pixel format.
+     *
+     * The pixels are left uninitialised.
      *
      * @param mWidth The width of the image.
      * @param mHeight The height of the image.
+     * @param format Channel count, sample depth and layout.
+     * @throws std::invalid_argument If the format has not 1, 3 or 4 channels.
+     * @throws std::bad_alloc If the pixel buffer cannot be allocated.
      */
-    Image(int mWidth, int mHeight) {
+    Image(int mWidth, int mHeight, const PixelFormat& format) {
+        if (!format.isValid()) {
+            throw std::invalid_argument("Images have 1, 3 or 4 channels, not " + std::to_string(format.channels));
+        }
         this->width = mWidth;
         this->height = mHeight;
-        this->imageData = (unsigned char*)malloc(mWidth * mHeight * this->channels);
+        this->channels = format.channels;
+        this->depth = format.depth;
+        this->layout = format.layout;
+        this->buffer = allocateBuffer(byteSize());
+        this->imageData = this->buffer.get();
     }
 
     /**
      * @brief Constructor that creates an image by copying another image.
      *
+     * The copy shares the pixel buffer with @p other; the data is only
+     * duplicated when either image is modified, so this is O(1).
+     *
      * @param other The Image we want to copy.
      */
-    Image(const Image& other) {
-        *this = other;
+    Image(const Image& other)
+        : filename(other.filename), buffer(other.buffer), depth(other.depth), layout(other.layout),
+          width(other.width), height(other.height), channels(other.channels),
+          imageData(other.imageData) {}
+
+    /**
+     * @brief Move constructor, takes ownership of the other image's buffer.
+     *
+     * @param other The Image to move from; it is left empty.
+     */
+    Image(Image&& other) noexcept
+        : filename(std::move(other.filename)), buffer(std::move(other.buffer)), depth(other.depth),
+          layout(other.layout), width(other.width), height(other.height), channels(other.channels),
+          imageData(other.imageData) {
+        other.imageData = nullptr;
+        other.width = 0;
+        other.height = 0;
     }
 
     /**
      * @brief Overloading the assignment operator.
      *
+     * Shares the pixel buffer with @p image (copy-on-write), so this is O(1).
+     *
      * @param image The Image we want to copy.
      *
      * @return *this after copying data.
@@ -228,41 +359,233 @@ public:
             return *this;
         }
 
-        stbi_image_free(this->imageData);
-        this->imageData = nullptr;
-
+        this->filename = image.filename;
+        this->buffer = image.buffer;
+        this->depth = image.depth;
+        this->layout = image.layout;
         this->width = image.width;
         this->height = image.height;
         this->channels = image.channels;
-        imageData = static_cast<unsigned char*>(malloc(width * height * channels));
+        this->imageData = image.imageData;
 
-        for (int i = 0; i < image.width * image.height * this->channels; i++) {
-            this->imageData[i] = image.imageData[i];
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator, takes ownership of the other image's buffer.
+     *
+     * @param image The Image to move from; it is left empty.
+     *
+     * @return *this after taking over the data.
+     */
+    Image& operator=(Image&& image) noexcept {
+        if (this == &image) {
+            return *this;
         }
 
+        this->filename = std::move(image.filename);
+        this->buffer = std::move(image.buffer);
+        this->depth = image.depth;
+        this->layout = image.layout;
+        this->width = image.width;
+        this->height = image.height;
+        this->channels = image.channels;
+        this->imageData = image.imageData;
+
+        image.imageData = nullptr;
+        image.width = 0;
+        image.height = 0;
+
         return *this;
     }
 
     /**
      * @brief Destructor for the Image class.
      */
-    ~Image() {
-        if (imageData != nullptr) {
-            stbi_image_free(imageData);
+    ~Image() = default;
+
+    /**
+     * @brief Number of bytes occupied by the pixel data.
+     *
+     * @return width * height * channels * bytes per sample.
+     */
+    std::size_t byteSize() const {
+        return static_cast<std::size_t>(width) * static_cast<std::size_t>(height)
+               * static_cast<std::size_t>(format().bytesPerPixel());
+    }
+
+    /**
+     * @brief Channel count, sample depth and layout of the pixels.
+     */
+    PixelFormat format() const {
+        return PixelFormat(channels, depth, layout);
+    }
+
+    /// @name Sample addressing
+    /// Sample (x, y, c) starts at imageData + y * rowStride() + x * pixelStride() + c * channelStride(),
+    /// in every format.
+    /// @{
+    std::ptrdiff_t rowStride() const {
+        const PixelFormat f = format();
+        return static_cast<std::ptrdiff_t>(width) * (f.isPlanar() ? f.bytesPerSample() : f.bytesPerPixel());
+    }
+    std::ptrdiff_t pixelStride() const {
+        const PixelFormat f = format();
+        return f.isPlanar() ? f.bytesPerSample() : f.bytesPerPixel();
+    }
+    std::ptrdiff_t channelStride() const {
+        const PixelFormat f = format();
+        return f.isPlanar() ? rowStride() * height : f.bytesPerSample();
+    }
+    /// @}
+
+    /**
+     * @brief Bytes held by the pixel buffers of all images in the process.
+     *
+     * Buffers shared copy-on-write are counted once.
+     */
+    static std::size_t pixelBytesInUse() {
+        return liveBytes.load();
+    }
+
+    /**
+     * @brief Highest pixelBytesInUse() since the last resetPixelBytesPeak().
+     */
+    static std::size_t pixelBytesPeak() {
+        return peakBytes.load();
+    }
+
+    /**
+     * @brief Total bytes of pixel buffers allocated since the program started.
+     *
+     * The difference between two readings is what an operation allocated.
+     */
+    static std::size_t pixelBytesAllocated() {
+        return allocatedBytes.load();
+    }
+
+    /**
+     * @brief Restarts pixelBytesPeak() from the current usage.
+     */
+    static void resetPixelBytesPeak() {
+        peakBytes = liveBytes.load();
+    }
+
+    /**
+     * @brief Checks whether the pixel buffer is currently shared with another Image.
+     *
+     * @return True if another Image references the same buffer.
+     */
+    bool isShared() const {
+        return buffer && buffer.use_count() > 1;
+    }
+
+    /**
+     * @brief Ensures this image owns its pixel buffer exclusively.
+     *
+     * Called automatically by every mutable accessor. When the buffer is shared
+     * the pixels are copied once into a private buffer; otherwise this is a no-op.
+     *
+     * @throws std::bad_alloc If the private copy cannot be allocated.
+     */
+    void detach() {
+        if (!isShared()) {
+            return;
         }
-        this->width = 0;
-        this->height = 0;
-        this->imageData = nullptr;
+        std::shared_ptr<unsigned char> copy = allocateBuffer(byteSize());
+        std::memcpy(copy.get(), imageData, byteSize());
+        buffer = std::move(copy);
+        imageData = buffer.get();
     }
 
     /**
-     * @brief Loads a new image from the specified filename.
+     * @brief Returns a writable, unchecked view of the pixel data.
+     *
+     * Detaches the buffer first (see detach()), so the view may be written to
+     * freely without affecting other images that shared it.
+     *
+     * @return ImageView covering the whole image.
+     * @throws std::logic_error If the pixels are not 8-bit interleaved.
+     * @see constView() for read-only access that never copies
+     * @see planeView() for the channels of a planar image
+     */
+    ImageView view() {
+        requireInterleaved8("Image::view()");
+        detach();
+        return ImageView(imageData, width, height, channels, static_cast<std::ptrdiff_t>(width) * channels);
+    }
+
+    /**
+     * @brief Returns a read-only, unchecked view of the pixel data.
+     *
+     * Never copies, even when the buffer is shared.
+     *
+     * @return ConstImageView covering the whole image.
+     * @throws std::logic_error If the pixels are not 8-bit interleaved.
+     */
+    ConstImageView constView() const {
+        requireInterleaved8("Image::constView()");
+        return ConstImageView(imageData, width, height, channels, static_cast<std::ptrdiff_t>(width) * channels);
+    }
+
+    /**
+     * @brief Returns a writable single-channel view of channel @p c of an 8-bit image.
+     *
+     * For a planar image this is the channel's plane; a gray image is its own
+     * only plane. Detaches the buffer first, like view().
+     *
+     * @throws std::logic_error If the image is 16-bit or interleaved with several channels.
+     * @throws std::out_of_range If @p c is not a channel of the image.
+     */
+    ImageView planeView(int c) {
+        const ConstImageView plane = constPlaneView(c);
+        const std::ptrdiff_t offset = plane.data - imageData;
+        detach();
+        return ImageView(imageData + offset, plane.width, plane.height, 1, plane.stride);
+    }
+
+    /**
+     * @brief Returns a read-only single-channel view of channel @p c of an 8-bit image.
+     *
+     * @throws std::logic_error If the image is 16-bit or interleaved with several channels.
+     * @throws std::out_of_range If @p c is not a channel of the image.
+     */
+    ConstImageView constPlaneView(int c) const {
+        if (depth != SampleDepth::U8 || (channels > 1 && !format().isPlanar())) {
+            throw std::logic_error("Plane views need 8-bit planar or gray pixels, not " + format().name());
+        }
+        if (c < 0 || c >= channels) {
+            throw std::out_of_range("Out of bounds, the image has " + std::to_string(channels) + " channels");
+        }
+        return ConstImageView(imageData + c * channelStride(), width, height, 1, rowStride());
+    }
+
+    /**
+     * @brief Loads a new image from the specified filename as 8-bit RGB.
      *
      * @param filename The filename of the image to load.
      * @return True if the image is loaded successfully, false otherwise.
      * @throws std::invalid_argument If the filename or file format is invalid.
      */
     bool loadNewImage(const std::string& filename) {
+        return loadNewImage(filename, PixelFormatSet{PixelFormat::rgb8()});
+    }
+
+    /**
+     * @brief Loads a new image, keeping the file's own channels and depth where @p accepted allows.
+     *
+     * A gray scan stays gray, alpha is kept and 16-bit PNGs keep their depth
+     * when those formats are accepted; otherwise stb converts while decoding
+     * to the accepted interleaved format nearest the file's (see
+     * PixelFormatSet::nearest()). Planar layouts are never produced here;
+     * ImageCodecs::load() splits the planes afterwards.
+     *
+     * @param filename The filename of the image to load.
+     * @param accepted Formats the caller can take.
+     * @return True if the image is loaded successfully, false otherwise.
+     * @throws std::invalid_argument If the filename or file format is invalid.
+     */
+    bool loadNewImage(const std::string& filename, const PixelFormatSet& accepted) {
         if (!isValidFilename(filename)) {
             std::cerr << "Couldn't Load Image" << '\n';
             throw std::invalid_argument("The file extension does not exist");
@@ -274,17 +597,41 @@ public:
             std::cerr << "Unsupported File Format" << '\n';
             throw std::invalid_argument("File Extension is not supported, Only .JPG, JPEG, .BMP, .PNG, .TGA are supported");
         }
-        if (imageData != nullptr) {
-            stbi_image_free(imageData);
-        }
-
-        imageData = stbi_load(filename.c_str(), &width, &height, &channels, STBI_rgb);
-
-        if (imageData == nullptr) {
+        reset();
+
+        // Gray + alpha files are read as RGBA, the nearest format with alpha
+        int fileChannels = STBI_rgb;
+        if (!stbi_info(filename.c_str(), &width, &height, &fileChannels)) fileChannels = STBI_rgb;
+        const PixelFormat native(fileChannels == 2 ? 4 : fileChannels,
+                                 stbi_is_16_bit(filename.c_str()) ? SampleDepth::U16 : SampleDepth::U8);
+        PixelFormat target = PixelFormatSet{PixelFormat::rgb8()} == accepted ? PixelFormat::rgb8()
+                                                                             : accepted.nearest(native).interleaved();
+        if (!target.isValid()) target = PixelFormat::rgb8();
+
+        int decodedChannels = 0;
+        unsigned char* loaded = target.depth == SampleDepth::U16
+            ? reinterpret_cast<unsigned char*>(stbi_load_16(filename.c_str(), &width, &height, &decodedChannels,
+                                                            target.channels))
+            : stbi_load(filename.c_str(), &width, &height, &decodedChannels, target.channels);
+
+        if (loaded == nullptr) {
+            width = 0;
+            height = 0;
             std::cerr << "File Doesn't Exist" << '\n';
             throw std::invalid_argument("Invalid filename, File Does not Exist");
         }
 
+        channels = target.channels;
+        depth = target.depth;
+        layout = PixelLayout::Interleaved;
+        const std::size_t bytes = byteSize();
+        trackAllocation(bytes);
+        buffer = std::shared_ptr<unsigned char>(loaded, [bytes](unsigned char* p) {
+            stbi_image_free(p);
+            trackRelease(bytes);
+        });
+        imageData = loaded;
+
         return true;
     }
 
@@ -294,9 +641,13 @@ public:
      * @param outputFilename The filename to save the image.
      * @return True if the image is saved successfully, false otherwise.
      * @throws std::invalid_argument If the output filename or file format is invalid.
+     * @throws std::logic_error If the pixels are not 8-bit interleaved.
+     * @note Only reads the pixels, so a buffer shared copy-on-write stays shared.
+     *       Gray and RGBA images are written with their own channels.
      */
 
-    bool saveImage(const std::string& outputFilename) {
+    bool saveImage(const std::string& outputFilename) const {
+        requireInterleaved8("Image::saveImage()");
         if (!isValidFilename(outputFilename)) {
             std::cerr << "Not Supported Format" << '\n';
             throw std::invalid_argument("The file extension does not exist");
@@ -311,16 +662,16 @@ public:
         }
 
         if (extensionType == PNG_TYPE) {
-            stbi_write_png(outputFilename.c_str(), width, height, STBI_rgb, imageData, width * 3);
+            stbi_write_png(outputFilename.c_str(), width, height, channels, imageData, width * channels);
         }
         else if (extensionType == BMP_TYPE) {
-            stbi_write_bmp(outputFilename.c_str(), width, height, STBI_rgb, imageData);
+            stbi_write_bmp(outputFilename.c_str(), width, height, channels, imageData);
         }
         else if (extensionType == TGA_TYPE) {
-            stbi_write_tga(outputFilename.c_str(), width, height, STBI_rgb, imageData);
+            stbi_write_tga(outputFilename.c_str(), width, height, channels, imageData);
         }
         else if (extensionType == JPG_TYPE) {
-            stbi_write_jpg(outputFilename.c_str(), width, height, STBI_rgb, imageData, 90);
+            stbi_write_jpg(outputFilename.c_str(), width, height, channels, imageData, 90);
         }
 
         return true;
@@ -336,35 +687,38 @@ public:
      * @throws std::out_of_range If the coordinates or channel index is out of bounds.
      */
     unsigned char& getPixel(int x, int y, int c) {
-        if (x > width || x < 0) {
+        if (x >= width || x < 0) {
             std::cerr << "Out of width bounds" << '\n';
             throw std::out_of_range("Out of bounds, Cannot exceed width value");
         }
-        if (y > height || y < 0) {
+        if (y >= height || y < 0) {
             std::cerr << "Out of height bounds" << '\n';
             throw std::out_of_range("Out of bounds, Cannot exceed height value");
         }
-        if (c < 0 || c > 2) {
+        if (c < 0 || c >= channels) {
             std::cerr << "Out of channels bounds" << '\n';
-            throw std::out_of_range("Out of bounds, You only have 3 channels in RGB");
+            throw std::out_of_range("Out of bounds, the image has " + std::to_string(channels) + " channels");
         }
+        requireInterleaved8("Image::getPixel()");
 
+        detach();
         return imageData[(y * width + x) * channels + c];
     }
 
     const unsigned char& getPixel(int x, int y, int c) const {
-        if (x > width || x < 0) {
+        if (x >= width || x < 0) {
             std::cerr << "Out of width bounds" << '\n';
             throw std::out_of_range("Out of bounds, Cannot exceed width value");
         }
-        if (y > height || y < 0) {
+        if (y >= height || y < 0) {
             std::cerr << "Out of height bounds" << '\n';
             throw std::out_of_range("Out of bounds, Cannot exceed height value");
         }
-        if (c < 0 || c > 2) {
+        if (c < 0 || c >= channels) {
             std::cerr << "Out of channels bounds" << '\n';
-            throw std::out_of_range("Out of bounds, You only have 3 channels in RGB");
+            throw std::out_of_range("Out of bounds, the image has " + std::to_string(channels) + " channels");
         }
+        requireInterleaved8("Image::getPixel()");
 
         return imageData[(y * width + x) * channels + c];
     }
@@ -378,19 +732,21 @@ public:
      * @throws std::out_of_range If the coordinates or channel index is out of bounds.
      */
     void setPixel(int x, int y, int c, unsigned char value) {
-        if (x > width || x < 0) {
+        if (x >= width || x < 0) {
             std::cerr << "Out of width bounds" << '\n';
             throw std::out_of_range("Out of bounds, Cannot exceed width value");
         }
-        if (y > height || y < 0) {
+        if (y >= height || y < 0) {
             std::cerr << "Out of height bounds" << '\n';
             throw std::out_of_range("Out of bounds, Cannot exceed height value");
         }
-        if (c < 0 || c > 2) {
+        if (c < 0 || c >= channels) {
             std::cerr << "Out of channels bounds" << '\n';
-            throw std::out_of_range("Out of bounds, You only have 3 channels in RGB");
+            throw std::out_of_range("Out of bounds, the image has " + std::to_string(channels) + " channels");
         }
+        requireInterleaved8("Image::setPixel()");
 
+        detach();
         imageData[(y * width + x) * channels + c] = value;
     }
 
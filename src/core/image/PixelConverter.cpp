@@ -0,0 +1,172 @@
+/**
+ * @file PixelConverter.cpp
+ * @brief Implementation of the pixel format conversions.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "PixelConverter.h"
+#include "../parallel/ThreadPool.h"
+#include "../simd/PointKernels.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+constexpr int kLuma = -1;   // Source "channel" standing for the luma of R, G and B
+constexpr int kOpaque = -2; // Source "channel" standing for full alpha
+
+/**
+ * @brief Where the samples of one row are: sample (x, c) is at data + x * pixelStep + c * channelStep.
+ */
+struct SampleRow {
+    const unsigned char* data;
+    std::ptrdiff_t pixelStep;
+    std::ptrdiff_t channelStep;
+};
+
+/**
+ * @brief Source channel (or kLuma / kOpaque) of every destination channel.
+ */
+void channelSources(int from, int to, int sources[4])
+{
+    for (int c = 0; c < to; ++c) {
+        if (c == 3) {
+            sources[c] = from == 4 ? 3 : kOpaque;
+        } else if (to == 1 && from >= 3) {
+            sources[c] = kLuma;
+        } else {
+            sources[c] = from == 1 ? 0 : c;
+        }
+    }
+}
+
+template <typename In>
+inline int sampleAt(const unsigned char* p)
+{
+    In value;
+    std::memcpy(&value, p, sizeof(In));
+    return value;
+}
+
+/// Rescales @p value from the range of In to the range of Out.
+template <typename In, typename Out>
+inline int rescale(int value)
+{
+    if constexpr (sizeof(In) == sizeof(Out)) {
+        return value;
+    } else if constexpr (sizeof(Out) == 2) {
+        return value * 257;
+    } else {
+        return (value * 255 + 32895) >> 16; // round(value / 257)
+    }
+}
+
+template <typename In, typename Out>
+void convertRow(const SampleRow& src, unsigned char* dst, std::ptrdiff_t dstPixel, std::ptrdiff_t dstChannel,
+                const int* sources, int channels, int width)
+{
+    constexpr int inMax = sizeof(In) == 2 ? 65535 : 255;
+    for (int x = 0; x < width; ++x) {
+        const unsigned char* p = src.data + x * src.pixelStep;
+        unsigned char* d = dst + x * dstPixel;
+        for (int c = 0; c < channels; ++c) {
+            int value;
+            if (sources[c] >= 0) {
+                value = sampleAt<In>(p + sources[c] * src.channelStep);
+            } else if (sources[c] == kLuma) {
+                value = (77 * sampleAt<In>(p) + 150 * sampleAt<In>(p + src.channelStep)
+                         + 29 * sampleAt<In>(p + 2 * src.channelStep) + 128) >> 8;
+            } else {
+                value = inMax;
+            }
+            const Out out = static_cast<Out>(rescale<In, Out>(value));
+            std::memcpy(d + c * dstChannel, &out, sizeof(Out));
+        }
+    }
+}
+
+using RowConverter = void (*)(const SampleRow&, unsigned char*, std::ptrdiff_t, std::ptrdiff_t, const int*, int, int);
+
+RowConverter rowConverter(SampleDepth from, SampleDepth to)
+{
+    if (from == SampleDepth::U8) {
+        return to == SampleDepth::U8 ? convertRow<std::uint8_t, std::uint8_t> : convertRow<std::uint8_t, std::uint16_t>;
+    }
+    return to == SampleDepth::U8 ? convertRow<std::uint16_t, std::uint8_t> : convertRow<std::uint16_t, std::uint16_t>;
+}
+
+} // namespace
+
+Image PixelConverter::convert(const Image& image, const PixelFormat& format)
+{
+    if (!format.isValid()) {
+        throw std::invalid_argument("Images have 1, 3 or 4 channels, not " + std::to_string(format.channels));
+    }
+    if (image.format() == format) return image;
+    Image result(image.width, image.height, format);
+    convertInto(image, result);
+    return result;
+}
+
+Image PixelConverter::conform(const Image& image, const PixelFormatSet& accepted)
+{
+    return convert(image, accepted.nearest(image.format()));
+}
+
+bool PixelConverter::convertInto(const Image& src, Image& dst, const std::atomic<bool>* cancelRequested,
+                                 const RowProgress& progress)
+{
+    if (src.width != dst.width || src.height != dst.height) {
+        throw std::invalid_argument("Pixel conversion source and destination sizes differ");
+    }
+    if (dst.byteSize() == 0) return true;
+
+    dst.detach();
+    const PixelFormat from = src.format();
+    const PixelFormat to = dst.format();
+    const int width = src.width;
+    const std::ptrdiff_t srcRow = src.rowStride();
+    const std::ptrdiff_t dstRow = dst.rowStride();
+    const std::ptrdiff_t dstPixel = dst.pixelStride();
+    const std::ptrdiff_t dstChannel = dst.channelStride();
+    const unsigned char* in = src.imageData;
+    unsigned char* out = dst.imageData;
+
+    if (from == to) {
+        std::memcpy(out, in, dst.byteSize());
+        return true;
+    }
+
+    // 8-bit RGB <-> gray are the common cases (gray scans, grayscale output); they have SIMD row kernels
+    const bool rgbToGray = from == PixelFormat::rgb8() && to == PixelFormat::gray8();
+    const bool grayToRgb = from == PixelFormat::gray8() && to == PixelFormat::rgb8();
+    int sources[4];
+    channelSources(from.channels, to.channels, sources);
+    const RowConverter rowKernel = rowConverter(from.depth, to.depth);
+    const std::ptrdiff_t srcPixel = src.pixelStride();
+    const std::ptrdiff_t srcChannel = src.channelStride();
+
+    return ThreadPool::instance().parallelRows(src.height, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const unsigned char* s = in + y * srcRow;
+            unsigned char* d = out + y * dstRow;
+            if (rgbToGray) {
+                PointKernels::luma(s, d, width);
+            } else if (grayToRgb) {
+                PointKernels::spreadGray(s, d, width);
+            } else {
+                rowKernel({s, srcPixel, srcChannel}, d, dstPixel, dstChannel, sources, to.channels, width);
+            }
+        }
+    }, cancelRequested, progress);
+}
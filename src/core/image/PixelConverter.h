@@ -0,0 +1,86 @@
+/**
+ * @file PixelConverter.h
+ * @brief Conversions between the pixel formats an Image can hold.
+ *
+ * This file declares the PixelConverter class, which converts an image
+ * between channel counts (gray, RGB, RGBA), sample depths (8 and 16 bit) and
+ * layouts (interleaved and planar) in one pass over the rows. All three
+ * changes happen together per pixel, so no intermediate image is allocated.
+ *
+ * @details Conversion rules:
+ * - Gray to colour replicates the gray value; colour to gray is Rec. 601 luma,
+ *   (77 R + 150 G + 29 B + 128) >> 8, as in PointKernels::luma()
+ * - Added alpha is opaque; removed alpha is dropped, not composited, like the
+ *   RGB decoders do
+ * - 8 to 16 bit multiplies by 257 (255 becomes 65535); 16 to 8 bit rounds to
+ *   the nearest value, so 8 -> 16 -> 8 is lossless
+ * - 8-bit RGB <-> gray uses the PointKernels SIMD row kernels
+ * - Row bands on the shared ThreadPool, with progress and cancellation
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef PIXELCONVERTER_H
+#define PIXELCONVERTER_H
+
+#include <atomic>
+#include <functional>
+#include "Image_Class.h"
+#include "PixelFormat.h"
+
+/**
+ * @class PixelConverter
+ * @brief Static utility class converting images between pixel formats.
+ *
+ * @code
+ * Image planes = PixelConverter::convert(image, PixelFormat::rgb8().planar());
+ * Image forFilter = PixelConverter::conform(scan, PixelFormatSet::interleaved8()); // no-op for gray8
+ * @endcode
+ */
+class PixelConverter {
+public:
+    /**
+     * @brief Progress callback, invoked on the calling thread between bands.
+     */
+    using RowProgress = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief @p image in @p format.
+     *
+     * When the image already has that format the result shares its buffer
+     * copy-on-write, so this is O(1).
+     *
+     * @throws std::invalid_argument If @p format is not valid
+     */
+    static Image convert(const Image& image, const PixelFormat& format);
+
+    /**
+     * @brief @p image in the format of @p accepted nearest its own (see PixelFormatSet::nearest()).
+     *
+     * Shares the buffer, O(1), when the image's format is already accepted.
+     */
+    static Image conform(const Image& image, const PixelFormatSet& accepted);
+
+    /**
+     * @brief Writes @p src into @p dst, converting to the format of @p dst.
+     *
+     * @param src Source image, any format
+     * @param dst Destination of the same size, any format; must not share the buffer of @p src
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback
+     * @return true on completion, false if cancelled
+     * @throws std::invalid_argument If the sizes differ
+     */
+    static bool convertInto(const Image& src, Image& dst, const std::atomic<bool>* cancelRequested = nullptr,
+                            const RowProgress& progress = {});
+};
+
+#endif // PIXELCONVERTER_H
@@ -0,0 +1,257 @@
+/**
+ * @file PixelFormat.h
+ * @brief Description of how an Image stores its samples.
+ *
+ * This file declares PixelFormat, the channel count, sample depth and memory
+ * layout of an image, and PixelFormatSet, the set of formats a filter or codec
+ * handles natively. Images default to 8-bit interleaved RGB, which is what
+ * ImageView addresses and what every filter accepts; the other formats keep
+ * grayscale scans at a third of the memory, keep alpha, keep 16-bit precision
+ * or split the channels into planes for SIMD kernels that work on one channel.
+ *
+ * @details The formats are:
+ * - 1 (gray), 3 (RGB) or 4 (RGBA) channels
+ * - 8 or 16 bits per sample (16-bit samples in native byte order)
+ * - Interleaved (RGBRGB...) or planar (all R, then all G, then all B)
+ *
+ * @see PixelConverter for the conversions between formats
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef PIXELFORMAT_H
+#define PIXELFORMAT_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+/**
+ * @brief Storage size of one sample.
+ */
+enum class SampleDepth {
+    U8, ///< 8 bits, 0-255
+    U16 ///< 16 bits, 0-65535
+};
+
+/**
+ * @brief Arrangement of the channels in memory.
+ */
+enum class PixelLayout {
+    Interleaved, ///< The channels of a pixel are adjacent (RGBRGB...)
+    Planar       ///< One full plane per channel, one after the other
+};
+
+/**
+ * @struct PixelFormat
+ * @brief Channel count, sample depth and layout of an image.
+ *
+ * @code
+ * Image scan(width, height, PixelFormat::gray8());
+ * Image planes(width, height, PixelFormat::rgb8().planar());
+ * @endcode
+ */
+struct PixelFormat {
+    int channels = 3;                              ///< 1 (gray), 3 (RGB) or 4 (RGBA)
+    SampleDepth depth = SampleDepth::U8;           ///< Bits per sample
+    PixelLayout layout = PixelLayout::Interleaved; ///< Interleaved or planar
+
+    constexpr PixelFormat() = default;
+    constexpr PixelFormat(int channels, SampleDepth depth = SampleDepth::U8,
+                          PixelLayout layout = PixelLayout::Interleaved)
+        : channels(channels), depth(depth), layout(layout) {}
+
+    /// @name Common formats
+    /// @{
+    static constexpr PixelFormat gray8() { return PixelFormat(1); }
+    static constexpr PixelFormat rgb8() { return PixelFormat(3); }
+    static constexpr PixelFormat rgba8() { return PixelFormat(4); }
+    static constexpr PixelFormat gray16() { return PixelFormat(1, SampleDepth::U16); }
+    static constexpr PixelFormat rgb16() { return PixelFormat(3, SampleDepth::U16); }
+    static constexpr PixelFormat rgba16() { return PixelFormat(4, SampleDepth::U16); }
+    /// @}
+
+    /**
+     * @brief The same format with planar layout.
+     */
+    constexpr PixelFormat planar() const { return PixelFormat(channels, depth, PixelLayout::Planar); }
+
+    /**
+     * @brief The same format with interleaved layout.
+     */
+    constexpr PixelFormat interleaved() const { return PixelFormat(channels, depth, PixelLayout::Interleaved); }
+
+    /**
+     * @brief Bytes of one sample (1 or 2).
+     */
+    constexpr int bytesPerSample() const { return depth == SampleDepth::U16 ? 2 : 1; }
+
+    /**
+     * @brief Bytes of one pixel over all channels.
+     */
+    constexpr int bytesPerPixel() const { return channels * bytesPerSample(); }
+
+    /**
+     * @brief Largest sample value (255 or 65535).
+     */
+    constexpr int maxValue() const { return depth == SampleDepth::U16 ? 65535 : 255; }
+
+    /**
+     * @brief True if the channels are stored as separate planes.
+     */
+    constexpr bool isPlanar() const { return layout == PixelLayout::Planar && channels > 1; }
+
+    /**
+     * @brief True for 8-bit interleaved pixels, the only format ImageView addresses.
+     */
+    constexpr bool isInterleaved8() const { return depth == SampleDepth::U8 && !isPlanar(); }
+
+    /**
+     * @brief True if the channel count is 1, 3 or 4.
+     */
+    constexpr bool isValid() const { return channels == 1 || channels == 3 || channels == 4; }
+
+    /**
+     * @brief Equal formats store their pixels identically (a gray image is interleaved and planar at once).
+     */
+    constexpr bool operator==(const PixelFormat& other) const {
+        return channels == other.channels && depth == other.depth && isPlanar() == other.isPlanar();
+    }
+
+    /**
+     * @brief Short name such as "rgb8", "gray16" or "rgba8-planar".
+     */
+    std::string name() const {
+        std::string text = channels == 1 ? "gray" : channels == 4 ? "rgba" : "rgb";
+        text += depth == SampleDepth::U16 ? "16" : "8";
+        if (isPlanar()) text += "-planar";
+        return text;
+    }
+};
+
+/**
+ * @class PixelFormatSet
+ * @brief The formats an operation handles without converting.
+ *
+ * Filters and codecs declare one; the caller converts an image to nearest()
+ * only when its format is not in the set, so a chain of steps that all accept
+ * grayscale never expands a gray scan to RGB.
+ */
+class PixelFormatSet {
+public:
+    /**
+     * @brief The empty set.
+     */
+    constexpr PixelFormatSet() = default;
+
+    constexpr PixelFormatSet(std::initializer_list<PixelFormat> formats) {
+        for (const PixelFormat& format : formats) insert(format);
+    }
+
+    /**
+     * @brief 8-bit interleaved gray, RGB and RGBA: any channel count ImageView can address.
+     */
+    static constexpr PixelFormatSet interleaved8() {
+        return {PixelFormat::gray8(), PixelFormat::rgb8(), PixelFormat::rgba8()};
+    }
+
+    /**
+     * @brief Every valid format.
+     */
+    static constexpr PixelFormatSet all() {
+        PixelFormatSet set;
+        for (int i = 0; i < kFormats; ++i) set.insert(at(i));
+        return set;
+    }
+
+    /**
+     * @brief Adds @p format (ignored if not valid).
+     */
+    constexpr void insert(const PixelFormat& format) {
+        if (format.isValid()) bits |= 1u << index(format);
+    }
+
+    /**
+     * @brief True if @p format is in the set.
+     */
+    constexpr bool contains(const PixelFormat& format) const {
+        return format.isValid() && (bits >> index(format) & 1u) != 0;
+    }
+
+    /**
+     * @brief True if the set has no format.
+     */
+    constexpr bool empty() const { return bits == 0; }
+
+    constexpr PixelFormatSet operator|(const PixelFormatSet& other) const { return fromBits(bits | other.bits); }
+    constexpr PixelFormatSet operator&(const PixelFormatSet& other) const { return fromBits(bits & other.bits); }
+    constexpr bool operator==(const PixelFormatSet& other) const { return bits == other.bits; }
+
+    /**
+     * @brief The member @p format converts to with the least loss.
+     *
+     * Losing channels (colour or alpha) costs most, then losing depth, then
+     * gaining channels or depth, then changing the layout; among equal costs
+     * the smaller format wins. Returns @p format itself when it is a member,
+     * and rgb8 when the set is empty.
+     */
+    constexpr PixelFormat nearest(const PixelFormat& format) const {
+        if (contains(format)) return format;
+        PixelFormat best = PixelFormat::rgb8();
+        int bestCost = -1;
+        for (int i = 0; i < kFormats; ++i) {
+            if ((bits >> i & 1u) == 0) continue;
+            const PixelFormat candidate = at(i);
+            const int cost = conversionCost(format, candidate);
+            if (bestCost < 0 || cost < bestCost) {
+                best = candidate;
+                bestCost = cost;
+            }
+        }
+        return best;
+    }
+
+private:
+    static constexpr int kFormats = 12; ///< 3 channel counts x 2 depths x 2 layouts
+
+    /// Bit of @p format: channel count, then depth, then layout (gray is always interleaved).
+    static constexpr int index(const PixelFormat& format) {
+        const int channelIndex = format.channels == 1 ? 0 : format.channels == 3 ? 1 : 2;
+        const int depthIndex = format.depth == SampleDepth::U16 ? 1 : 0;
+        return (channelIndex * 2 + depthIndex) * 2 + (format.isPlanar() ? 1 : 0);
+    }
+
+    static constexpr PixelFormat at(int i) {
+        const int channelCounts[3] = {1, 3, 4};
+        return PixelFormat(channelCounts[i / 4], (i / 2) % 2 ? SampleDepth::U16 : SampleDepth::U8,
+                           i % 2 ? PixelLayout::Planar : PixelLayout::Interleaved);
+    }
+
+    static constexpr int conversionCost(const PixelFormat& from, const PixelFormat& to) {
+        const bool loseColour = from.channels >= 3 && to.channels == 1;
+        const bool loseAlpha = from.channels == 4 && to.channels != 4;
+        int cost = (loseColour ? 1000 : 0) + (loseAlpha ? 1000 : 0);
+        if (to.bytesPerSample() < from.bytesPerSample()) cost += 500;
+        cost += to.bytesPerPixel() * 10;
+        if (to.isPlanar() != from.isPlanar()) cost += 1;
+        return cost;
+    }
+
+    static constexpr PixelFormatSet fromBits(std::uint32_t value) {
+        PixelFormatSet set;
+        set.bits = value;
+        return set;
+    }
+
+    std::uint32_t bits = 0;
+};
+
+#endif // PIXELFORMAT_H
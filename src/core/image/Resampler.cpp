@@ -0,0 +1,501 @@
+/**
+ * @file Resampler.cpp
+ * @brief Implementation of the separable resampler.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "Resampler.h"
+#include "BufferPool.h"
+#include "../parallel/ThreadPool.h"
+#include "../simd/PointKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PHOTOSMITH_SIMD_X86 1
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PHOTOSMITH_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PHOTOSMITH_TARGET(isa)
+#endif
+
+namespace {
+
+constexpr int kWeightBits = 14;                 // Weights in 1/16384
+constexpr int kOne = 1 << kWeightBits;
+constexpr int kLevelBits = 6;                   // Horizontal pass output in 1/64 level
+constexpr int kLevelMax = 255 << kLevelBits;
+constexpr int kHorizontalShift = kWeightBits - kLevelBits;
+constexpr int kVerticalShift = kWeightBits + kLevelBits;
+constexpr double kPi = 3.14159265358979323846;
+
+double triangle(double x)
+{
+    x = std::fabs(x);
+    return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+/**
+ * @brief Keys cubic with a = -0.5 (Catmull-Rom).
+ */
+double cubic(double x)
+{
+    constexpr double a = -0.5;
+    x = std::fabs(x);
+    if (x < 1.0) return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+    if (x < 2.0) return (((x - 5.0) * x + 8.0) * x - 4.0) * a;
+    return 0.0;
+}
+
+double sinc(double x)
+{
+    if (x == 0.0) return 1.0;
+    x *= kPi;
+    return std::sin(x) / x;
+}
+
+double lanczos3(double x)
+{
+    return (x > -3.0 && x < 3.0) ? sinc(x) * sinc(x / 3.0) : 0.0;
+}
+
+/**
+ * @brief Weight of source pixel @p j for a destination pixel centred at @p centre (source coordinates).
+ *
+ * The box weight is the exact overlap of the pixel with the destination
+ * pixel's footprint, so non-integer ratios average by area too.
+ */
+double tapWeight(Resampler::Filter filter, int j, double centre, double filterScale)
+{
+    switch (filter) {
+    case Resampler::Filter::Box: {
+        const double half = 0.5 * filterScale;
+        return std::max(0.0, std::min(j + 1.0, centre + half) - std::max(static_cast<double>(j), centre - half));
+    }
+    case Resampler::Filter::Bilinear:
+        return triangle((j + 0.5 - centre) / filterScale);
+    case Resampler::Filter::Bicubic:
+        return cubic((j + 0.5 - centre) / filterScale);
+    default:
+        return lanczos3((j + 0.5 - centre) / filterScale);
+    }
+}
+
+/**
+ * @brief Reach of @p filter around a pixel centre, in source pixels.
+ */
+double support(Resampler::Filter filter, double filterScale)
+{
+    switch (filter) {
+    case Resampler::Filter::Box:      return 0.5 * filterScale + 0.5;
+    case Resampler::Filter::Bilinear: return filterScale;
+    case Resampler::Filter::Bicubic:  return 2.0 * filterScale;
+    default:                          return 3.0 * filterScale;
+    }
+}
+
+inline std::int16_t clampLevel(int value)
+{
+    return static_cast<std::int16_t>(std::clamp(value, 0, kLevelMax));
+}
+
+/**
+ * @brief A single source row, its length and channel count.
+ */
+struct SourceRow {
+    const unsigned char* pixels;
+    std::size_t bytes;
+    int channels;
+};
+
+/**
+ * @brief Horizontal pass of one row into 1/64 levels.
+ */
+void horizontalScalar(const SourceRow& row, const Resampler::Weights& wx, std::int16_t* out)
+{
+    const int channels = row.channels;
+    const int taps = wx.taps;
+    for (std::size_t x = 0; x < wx.first.size(); ++x, out += channels) {
+        const unsigned char* p = row.pixels + static_cast<std::size_t>(wx.first[x]) * channels;
+        const std::int16_t* weights = wx.coefficients.data() + x * taps;
+        for (int c = 0; c < channels; ++c) {
+            int sum = 1 << (kHorizontalShift - 1);
+            for (int k = 0; k < taps; ++k) sum += p[k * channels + c] * weights[k];
+            out[c] = clampLevel(sum >> kHorizontalShift);
+        }
+    }
+}
+
+/**
+ * @brief Vertical pass: one destination row from @p taps rows of 1/64 levels, @p pitch lanes apart.
+ */
+void verticalScalar(const std::int16_t* rows, std::size_t pitch, const std::int16_t* weights, int taps, int lanes,
+                    unsigned char* out, std::int32_t* sums)
+{
+    std::fill(sums, sums + lanes, 1 << (kVerticalShift - 1));
+    for (int k = 0; k < taps; ++k) {
+        const int weight = weights[k];
+        if (weight == 0) continue;
+        const std::int16_t* levels = rows + k * pitch;
+        for (int i = 0; i < lanes; ++i) sums[i] += levels[i] * weight;
+    }
+    for (int i = 0; i < lanes; ++i) out[i] = static_cast<unsigned char>(std::clamp(sums[i] >> kVerticalShift, 0, 255));
+}
+
+/**
+ * @brief Horizontal pass when the width does not change: the same as a 1-tap identity, but vectorisable.
+ */
+void widenRow(const SourceRow& row, const Resampler::Weights&, std::int16_t* out)
+{
+    for (std::size_t i = 0; i < row.bytes; ++i) out[i] = static_cast<std::int16_t>(row.pixels[i] << kLevelBits);
+}
+
+/**
+ * @brief Vertical pass when the height does not change: rounds the levels of the one row back to bytes.
+ */
+void narrowRow(const std::int16_t* rows, std::size_t, const std::int16_t*, int, int lanes, unsigned char* out,
+               std::int32_t*)
+{
+    for (int i = 0; i < lanes; ++i) {
+        out[i] = static_cast<unsigned char>((rows[i] + (1 << (kLevelBits - 1))) >> kLevelBits);
+    }
+}
+
+#if defined(PHOTOSMITH_SIMD_X86)
+/**
+ * @brief Pixel of up to 4 channels in the low bytes of an int; reads past it only inside the row.
+ */
+inline int loadPixel(const unsigned char* p, const unsigned char* rowEnd, int channels)
+{
+    std::uint32_t value = 0;
+    if (p + 4 <= rowEnd) {
+        std::memcpy(&value, p, sizeof(value));
+    } else {
+        for (int c = 0; c < channels; ++c) value |= static_cast<std::uint32_t>(p[c]) << (8 * c);
+    }
+    return static_cast<int>(value);
+}
+
+/**
+ * @brief Two consecutive weights as the int pair _mm_madd_epi16 multiplies with.
+ */
+inline int weightPair(const std::int16_t* weights, bool second)
+{
+    const std::uint32_t low = static_cast<std::uint16_t>(weights[0]);
+    const std::uint32_t high = second ? static_cast<std::uint16_t>(weights[1]) : 0u;
+    return static_cast<int>(low | (high << 16));
+}
+
+/**
+ * @brief SSE2 horizontal pass: the channels of a pixel in one register, two taps per multiply-add.
+ *
+ * Needs at most 4 channels.
+ */
+PHOTOSMITH_TARGET("sse2")
+void horizontalSse2(const SourceRow& row, const Resampler::Weights& wx, std::int16_t* out)
+{
+    const int channels = row.channels;
+    const int taps = wx.taps;
+    const unsigned char* rowEnd = row.pixels + row.bytes;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (kHorizontalShift - 1));
+    const __m128i maxLevel = _mm_set1_epi16(static_cast<short>(kLevelMax));
+    for (std::size_t x = 0; x < wx.first.size(); ++x, out += channels) {
+        const unsigned char* p = row.pixels + static_cast<std::size_t>(wx.first[x]) * channels;
+        const std::int16_t* weights = wx.coefficients.data() + x * taps;
+        __m128i sum = round;
+        for (int k = 0; k < taps; k += 2, p += 2 * channels) {
+            const bool second = k + 1 < taps;
+            const __m128i a = _mm_unpacklo_epi8(_mm_cvtsi32_si128(loadPixel(p, rowEnd, channels)), zero);
+            const __m128i b = second ? _mm_unpacklo_epi8(_mm_cvtsi32_si128(loadPixel(p + channels, rowEnd, channels)), zero)
+                                     : zero;
+            // 16-bit lanes [c0 of a, c0 of b, c1 of a, c1 of b, ...] against [w0, w1, w0, w1, ...]
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(a, b),
+                                                    _mm_set1_epi32(weightPair(weights + k, second))));
+        }
+        sum = _mm_srai_epi32(sum, kHorizontalShift);
+        const __m128i levels = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(sum, sum), zero), maxLevel);
+        alignas(16) std::int16_t lanes[8];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), levels);
+        std::memcpy(out, lanes, static_cast<std::size_t>(channels) * sizeof(std::int16_t));
+    }
+}
+
+/**
+ * @brief SSE4.1 horizontal pass for RGB: four taps from one load, rearranged with byte shuffles.
+ *
+ * A 16-byte load holds four whole pixels; two shuffles turn it into the
+ * [r0 r1 g0 g1 b0 b1] pairs _mm_madd_epi16 weights, instead of loading and
+ * unpacking each tap. Taps left over, or too close to the row end for the
+ * load, go through the two-tap SSE2 steps. Bit-exact with horizontalScalar().
+ */
+PHOTOSMITH_TARGET("sse4.1")
+void horizontalRgbSse41(const SourceRow& row, const Resampler::Weights& wx, std::int16_t* out)
+{
+    const int taps = wx.taps;
+    const unsigned char* rowEnd = row.pixels + row.bytes;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (kHorizontalShift - 1));
+    const __m128i maxLevel = _mm_set1_epi16(static_cast<short>(kLevelMax));
+    const __m128i firstPair = _mm_setr_epi8(0, -1, 3, -1, 1, -1, 4, -1, 2, -1, 5, -1, -1, -1, -1, -1);
+    const __m128i secondPair = _mm_setr_epi8(6, -1, 9, -1, 7, -1, 10, -1, 8, -1, 11, -1, -1, -1, -1, -1);
+    for (std::size_t x = 0; x < wx.first.size(); ++x, out += 3) {
+        const unsigned char* p = row.pixels + static_cast<std::size_t>(wx.first[x]) * 3;
+        const std::int16_t* weights = wx.coefficients.data() + x * taps;
+        __m128i sum = round;
+        int k = 0;
+        for (; k + 4 <= taps && p + 16 <= rowEnd; k += 4, p += 12) {
+            const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_shuffle_epi8(pixels, firstPair),
+                                                    _mm_set1_epi32(weightPair(weights + k, true))));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_shuffle_epi8(pixels, secondPair),
+                                                    _mm_set1_epi32(weightPair(weights + k + 2, true))));
+        }
+        for (; k < taps; k += 2, p += 6) {
+            const bool second = k + 1 < taps;
+            const __m128i a = _mm_unpacklo_epi8(_mm_cvtsi32_si128(loadPixel(p, rowEnd, 3)), zero);
+            const __m128i b = second ? _mm_unpacklo_epi8(_mm_cvtsi32_si128(loadPixel(p + 3, rowEnd, 3)), zero) : zero;
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(a, b),
+                                                    _mm_set1_epi32(weightPair(weights + k, second))));
+        }
+        sum = _mm_srai_epi32(sum, kHorizontalShift);
+        const __m128i levels = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(sum, sum), zero), maxLevel);
+        alignas(16) std::int16_t lanes[8];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), levels);
+        std::memcpy(out, lanes, 3 * sizeof(std::int16_t));
+    }
+}
+
+/**
+ * @brief SSE2 vertical pass: 8 lanes at a time, two rows per multiply-add.
+ */
+PHOTOSMITH_TARGET("sse2")
+void verticalSse2(const std::int16_t* rows, std::size_t pitch, const std::int16_t* weights, int taps, int lanes,
+                  unsigned char* out, std::int32_t* sums)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (kVerticalShift - 1));
+    int i = 0;
+    for (; i + 8 <= lanes; i += 8) {
+        __m128i low = round;
+        __m128i high = round;
+        for (int k = 0; k < taps; k += 2) {
+            const bool second = k + 1 < taps;
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + k * pitch + i));
+            const __m128i b = second ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + (k + 1) * pitch + i))
+                                     : zero;
+            const __m128i weight = _mm_set1_epi32(weightPair(weights + k, second));
+            low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), weight));
+            high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), weight));
+        }
+        const __m128i levels = _mm_packs_epi32(_mm_srai_epi32(low, kVerticalShift), _mm_srai_epi32(high, kVerticalShift));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(levels, levels));
+    }
+    if (i < lanes) verticalScalar(rows + i, pitch, weights, taps, lanes - i, out + i, sums);
+}
+#endif
+
+using HorizontalKernel = void (*)(const SourceRow&, const Resampler::Weights&, std::int16_t*);
+using VerticalKernel = void (*)(const std::int16_t*, std::size_t, const std::int16_t*, int, int, unsigned char*,
+                                std::int32_t*);
+
+bool useSse2()
+{
+#if defined(PHOTOSMITH_SIMD_X86)
+    // PHOTOSMITH_SIMD=scalar disables these kernels too; any x86 level PointKernels picks includes SSE4.1
+    static const bool enabled = std::strcmp(PointKernels::activeIsa(), "scalar") != 0;
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+Resampler::Weights Resampler::weights(int sourceSize, int targetSize, Filter filter)
+{
+    if (sourceSize < 1 || targetSize < 1) throw std::invalid_argument("Resample sizes must be at least 1");
+    Weights result;
+    result.first.resize(static_cast<std::size_t>(targetSize));
+    const double scale = static_cast<double>(sourceSize) / targetSize;
+
+    if (sourceSize == targetSize || filter == Filter::Nearest) {
+        result.taps = 1;
+        result.coefficients.assign(static_cast<std::size_t>(targetSize), static_cast<std::int16_t>(kOne));
+        for (int i = 0; i < targetSize; ++i) {
+            result.first[i] = std::min(static_cast<int>((i + 0.5) * scale), sourceSize - 1);
+        }
+        return result;
+    }
+
+    // Downscales stretch the filter over the source pixels each destination pixel covers
+    const double filterScale = std::max(1.0, scale);
+    const double reach = support(filter, filterScale);
+    // Rounded up to whole groups of four, which the SIMD kernels take in one step
+    const int taps = std::min(sourceSize, (2 * static_cast<int>(std::ceil(reach)) + 4) & ~3);
+    result.taps = taps;
+    result.coefficients.assign(static_cast<std::size_t>(targetSize) * taps, 0);
+    std::vector<double> window(static_cast<std::size_t>(taps));
+
+    for (int i = 0; i < targetSize; ++i) {
+        const double centre = (i + 0.5) * scale;
+        const int begin = std::max(0, static_cast<int>(std::floor(centre - reach + 0.5)));
+        const int end = std::min(sourceSize, static_cast<int>(std::floor(centre + reach + 0.5)));
+        // Windows near the far edge slide left so that all taps stay inside the source
+        const int first = std::min(begin, sourceSize - taps);
+        std::fill(window.begin(), window.end(), 0.0);
+        double total = 0.0;
+        for (int j = begin; j < end; ++j) {
+            const double weight = tapWeight(filter, j, centre, filterScale);
+            window[j - first] = weight;
+            total += weight;
+        }
+        if (total == 0.0) {
+            window[std::clamp(static_cast<int>(centre), first, first + taps - 1) - first] = 1.0;
+            total = 1.0;
+        }
+
+        // Rounding error goes to the largest weight, so each set adds up to exactly kOne
+        std::int16_t* coefficients = result.coefficients.data() + static_cast<std::size_t>(i) * taps;
+        int sum = 0;
+        int peak = 0;
+        for (int k = 0; k < taps; ++k) {
+            coefficients[k] = static_cast<std::int16_t>(std::lround(window[k] / total * kOne));
+            sum += coefficients[k];
+            if (std::abs(coefficients[k]) > std::abs(coefficients[peak])) peak = k;
+        }
+        coefficients[peak] = static_cast<std::int16_t>(coefficients[peak] + kOne - sum);
+        result.first[i] = first;
+    }
+    return result;
+}
+
+Resampler::Plan::Plan(int sourceWidth, int sourceHeight, int targetWidth, int targetHeight, int channels,
+                      Filter filter)
+    : wx(weights(sourceWidth, targetWidth, filter)), wy(weights(sourceHeight, targetHeight, filter)),
+      sourceWidth(sourceWidth), sourceHeight(sourceHeight), channels(channels)
+{
+}
+
+int Resampler::Plan::grain(int concurrency) const
+{
+    // Neighbouring bands share wy.taps rows, so bands are kept long enough for that to stay cheap
+    const int targetHeight = static_cast<int>(wy.first.size());
+    const double scaleY = static_cast<double>(sourceHeight) / targetHeight;
+    return std::max({1, targetHeight / (std::max(1, concurrency) * 8),
+                     static_cast<int>(std::ceil(4.0 * wy.taps / scaleY))});
+}
+
+std::pair<int, int> Resampler::Plan::reachedBy(const Weights& weights, int sourceBegin, int sourceEnd)
+{
+    // First indices never decrease, so the destinations reading a source range are contiguous
+    const auto begin = std::lower_bound(weights.first.begin(), weights.first.end(), sourceBegin - weights.taps + 1);
+    const auto end = std::lower_bound(begin, weights.first.end(), sourceEnd);
+    return {static_cast<int>(begin - weights.first.begin()), static_cast<int>(end - weights.first.begin())};
+}
+
+void Resampler::Plan::rows(const ConstImageView& src, int rowBegin, int rowEnd, const ImageView& out) const
+{
+    if (src.width != sourceWidth || src.height != sourceHeight || src.channels != channels
+        || out.channels != channels || out.width != static_cast<int>(wx.first.size()) || out.height < rowEnd - rowBegin) {
+        throw std::invalid_argument("Resample plan does not match the images");
+    }
+    if (rowBegin >= rowEnd) return;
+
+    HorizontalKernel horizontal = horizontalScalar;
+    VerticalKernel vertical = verticalScalar;
+#if defined(PHOTOSMITH_SIMD_X86)
+    if (useSse2()) {
+        if (channels == 3) {
+            horizontal = horizontalRgbSse41;
+        } else if (channels <= 4) {
+            horizontal = horizontalSse2;
+        }
+        vertical = verticalSse2;
+    }
+#endif
+    if (src.width == out.width) horizontal = widenRow;
+    if (src.height == static_cast<int>(wy.first.size())) vertical = narrowRow;
+
+    // Filters the source rows the band needs horizontally, then reads them vertically
+    const int lanes = out.width * channels;
+    const std::size_t pitch = static_cast<std::size_t>(lanes);
+    const int firstRow = wy.first[rowBegin];
+    const int endRow = wy.first[rowEnd - 1] + wy.taps;
+    // Intermediate rows come from the pool: the next band or resize reuses the same mapped pages
+    BufferPool::Lease levelBuffer = BufferPool::instance().lease(
+        static_cast<std::size_t>(endRow - firstRow) * pitch * sizeof(std::int16_t));
+    auto* levels = reinterpret_cast<std::int16_t*>(levelBuffer.data());
+    std::vector<std::int32_t> sums(pitch);
+    for (int y = firstRow; y < endRow; ++y) {
+        horizontal({src.row(y), static_cast<std::size_t>(src.rowBytes()), channels}, wx,
+                   levels + static_cast<std::size_t>(y - firstRow) * pitch);
+    }
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        // Rows outside the filter's reach (padding, window slid at the edge) are skipped
+        const std::int16_t* weights = wy.coefficients.data() + static_cast<std::size_t>(y) * wy.taps;
+        int begin = 0;
+        int end = wy.taps;
+        while (end > 1 && weights[end - 1] == 0) --end;
+        while (begin + 1 < end && weights[begin] == 0) ++begin;
+        vertical(levels + static_cast<std::size_t>(wy.first[y] - firstRow + begin) * pitch, pitch,
+                 weights + begin, end - begin, lanes, out.row(y - rowBegin), sums.data());
+    }
+}
+
+bool Resampler::resize(const ConstImageView& src, const ImageView& dst, Filter filter,
+                       const std::atomic<bool>* cancelRequested, const RowProgress& progress)
+{
+    if (src.channels != dst.channels) throw std::invalid_argument("Resample channel counts differ");
+    if (dst.empty()) return true;
+    if (src.empty()) throw std::invalid_argument("Cannot resample an empty image");
+
+    ThreadPool& pool = ThreadPool::instance();
+    if (src.width == dst.width && src.height == dst.height) {
+        return pool.parallelRows(dst.height, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                std::memcpy(dst.row(y), src.row(y), static_cast<std::size_t>(dst.rowBytes()));
+            }
+        }, cancelRequested, progress);
+    }
+
+    const Plan plan(src.width, src.height, dst.width, dst.height, dst.channels, filter);
+    return pool.parallelRows(dst.height, [&](int rowBegin, int rowEnd) {
+        plan.rows(src, rowBegin, rowEnd, dst.subView(0, rowBegin, dst.width, rowEnd - rowBegin));
+    }, cancelRequested, progress, plan.grain(pool.concurrency()));
+}
+
+const char* Resampler::name(Filter filter)
+{
+    switch (filter) {
+    case Filter::Nearest:  return "nearest";
+    case Filter::Box:      return "box";
+    case Filter::Bilinear: return "bilinear";
+    case Filter::Bicubic:  return "bicubic";
+    default:               return "lanczos";
+    }
+}
+
+Resampler::Filter Resampler::parse(const std::string& text)
+{
+    for (Filter filter : {Filter::Nearest, Filter::Box, Filter::Bilinear, Filter::Bicubic, Filter::Lanczos3}) {
+        if (text == name(filter)) return filter;
+    }
+    throw std::invalid_argument("Unknown resampling filter '" + text + "' (nearest, box, bilinear, bicubic, lanczos)");
+}
@@ -0,0 +1,182 @@
+/**
+ * @file Resampler.h
+ * @brief Separable image resampling with selectable filters.
+ *
+ * This file declares the Resampler class, which scales an image to any size
+ * with a box (area), bilinear, bicubic or Lanczos filter. Weights are computed
+ * once per output column and row, in fixed point, so the inner loops are only
+ * integer multiply-adds: a horizontal pass into a 16-bit buffer, then a
+ * vertical pass into the destination.
+ *
+ * @details The resampler provides:
+ * - Filters widened by the scale factor on downscales, so every source pixel
+ *   contributes and fine detail averages out instead of aliasing
+ * - SSE2 kernels on x86 and scalar ones elsewhere, bit-exact with each other
+ * - Row bands on the shared ThreadPool, with progress and cancellation
+ *
+ * @note Used by ImageFilters::applyResize(), ImagePyramid::scaled() (display
+ *       and ImageLoader previews) and the batch tool's resize and thumbnail steps.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ImageView.h"
+
+/**
+ * @class Resampler
+ * @brief Static utility class scaling images through precomputed weight tables.
+ *
+ * @code
+ * Image thumbnail(320, 240);
+ * Resampler::resize(image.constView(), thumbnail.view(), Resampler::Filter::Box);
+ * @endcode
+ */
+class Resampler {
+public:
+    /**
+     * @brief Progress callback, invoked on the calling thread between bands.
+     */
+    using RowProgress = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief Interpolation filter.
+     */
+    enum class Filter {
+        Nearest,  ///< Closest source pixel; keeps hard edges, aliases on downscales
+        Box,      ///< Area average; the fastest good downscale
+        Bilinear, ///< Triangle filter (tent)
+        Bicubic,  ///< Catmull-Rom cubic, sharper than bilinear
+        Lanczos3  ///< Windowed sinc with three lobes; the sharpest, for final output
+    };
+
+    /**
+     * @brief Coefficients mapping one axis of the source to one axis of the destination.
+     *
+     * Every destination index reads the same number of consecutive source
+     * pixels, starting at first[i] and always inside the source; unused taps
+     * have weight 0. Weights are in 1/16384 and each index's weights add up
+     * to exactly 16384, so flat areas stay flat.
+     */
+    struct Weights {
+        int taps = 0;                            ///< Source pixels read per destination index
+        std::vector<int> first;                  ///< First source index of each destination index
+        std::vector<std::int16_t> coefficients;  ///< taps weights per destination index
+    };
+
+    /**
+     * @brief Builds the weights scaling @p sourceSize pixels to @p targetSize.
+     *
+     * Pixel centres are aligned, so the image edges map onto each other.
+     * Equal sizes give a 1-tap identity whatever the filter.
+     *
+     * @throws std::invalid_argument If either size is less than 1
+     */
+    static Weights weights(int sourceSize, int targetSize, Filter filter);
+
+    /**
+     * @brief Weights for one source size, target size and filter, applied a band of rows at a time.
+     *
+     * resize() runs a plan over the whole destination. Callers that consume
+     * the scaled rows as they are produced (BlendEngine) run rows() per band
+     * instead, so the scaled image never exists in full.
+     *
+     * @code
+     * const Resampler::Plan plan(src.width, src.height, width, height, 3, Resampler::Filter::Bilinear);
+     * plan.rows(src, 0, 16, band); // band: width x 16 pixels
+     * @endcode
+     */
+    class Plan {
+    public:
+        /**
+         * @throws std::invalid_argument If any size is less than 1
+         */
+        Plan(int sourceWidth, int sourceHeight, int targetWidth, int targetHeight, int channels, Filter filter);
+
+        /**
+         * @brief Writes target rows [rowBegin, rowEnd) of @p src, scaled, to the first rows of @p out.
+         *
+         * Safe to call from several threads at once.
+         *
+         * @param src Source of the plan's source size and channel count
+         * @param rowBegin First target row
+         * @param rowEnd One past the last target row
+         * @param out Target width and at least rowEnd - rowBegin rows; must not alias @p src
+         * @throws std::invalid_argument If the images do not match the plan
+         */
+        void rows(const ConstImageView& src, int rowBegin, int rowEnd, const ImageView& out) const;
+
+        /**
+         * @brief Shortest band of target rows worth a task: neighbouring bands both filter the rows they share.
+         */
+        int grain(int concurrency) const;
+
+        /**
+         * @brief Target rows that read any source row in [sourceBegin, sourceEnd), as [first, second).
+         *
+         * The range is empty (first == second) if no target row reads them.
+         */
+        std::pair<int, int> targetRows(int sourceBegin, int sourceEnd) const { return reachedBy(wy, sourceBegin, sourceEnd); }
+
+        /**
+         * @brief Target columns that read any source column in [sourceBegin, sourceEnd), as [first, second).
+         */
+        std::pair<int, int> targetColumns(int sourceBegin, int sourceEnd) const { return reachedBy(wx, sourceBegin, sourceEnd); }
+
+    private:
+        /**
+         * @brief Destination indices whose taps overlap source indices [sourceBegin, sourceEnd).
+         */
+        static std::pair<int, int> reachedBy(const Weights& weights, int sourceBegin, int sourceEnd);
+
+        Weights wx;
+        Weights wy;
+        int sourceWidth;
+        int sourceHeight;
+        int channels;
+    };
+
+    /**
+     * @brief Scales @p src to the size of @p dst.
+     *
+     * @param src Source pixels, any size
+     * @param dst Destination with the same channel count; must not alias @p src
+     * @param filter Interpolation filter
+     * @param cancelRequested Optional cancel flag, checked between bands
+     * @param progress Optional progress callback
+     * @return true on completion, false if cancelled
+     * @throws std::invalid_argument If the channel counts differ
+     */
+    static bool resize(const ConstImageView& src, const ImageView& dst, Filter filter,
+                       const std::atomic<bool>* cancelRequested = nullptr, const RowProgress& progress = {});
+
+    /**
+     * @brief Lower-case name of @p filter, as accepted by parse().
+     */
+    static const char* name(Filter filter);
+
+    /**
+     * @brief Filter called @p text ("nearest", "box", "bilinear", "bicubic", "lanczos").
+     *
+     * @throws std::invalid_argument If @p text names no filter
+     */
+    static Filter parse(const std::string& text);
+};
+
+#endif // RESAMPLER_H
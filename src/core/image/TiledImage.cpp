@@ -0,0 +1,490 @@
+/**
+ * @file TiledImage.cpp
+ * @brief Implementation of the memory-mapped tiled image.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "TiledImage.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// Tiles start on this boundary in the scratch file (the Windows mapping granularity, a multiple of any page size).
+constexpr std::size_t TileAlignment = std::size_t(64) << 10;
+
+std::string lowercaseExtension(const std::string& filename)
+{
+    const std::size_t dot = filename.rfind('.');
+    std::string ext = dot == std::string::npos ? std::string() : filename.substr(dot);
+    for (char& ch : ext) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    return ext;
+}
+
+std::uint32_t readU16(const unsigned char* p) { return p[0] | (p[1] << 8); }
+std::uint32_t readU32(const unsigned char* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (std::uint32_t(p[3]) << 24); }
+
+void putU16(std::string& out, std::uint32_t value)
+{
+    out += static_cast<char>(value & 0xFF);
+    out += static_cast<char>((value >> 8) & 0xFF);
+}
+
+void putU32(std::string& out, std::uint32_t value)
+{
+    putU16(out, value & 0xFFFF);
+    putU16(out, value >> 16);
+}
+
+/**
+ * @brief Converts one file row of BGR(A) pixels to RGB.
+ */
+void bgrToRgb(const unsigned char* src, unsigned char* dst, int width, int bytesPerPixel)
+{
+    for (int x = 0; x < width; ++x, src += bytesPerPixel, dst += 3) {
+        dst[0] = src[2];
+        dst[1] = src[1];
+        dst[2] = src[0];
+    }
+}
+
+/**
+ * @brief Converts one row of RGB pixels to BGR for writing.
+ */
+void rgbToBgr(const unsigned char* src, unsigned char* dst, int width)
+{
+    for (int x = 0; x < width; ++x, src += 3, dst += 3) {
+        dst[0] = src[2];
+        dst[1] = src[1];
+        dst[2] = src[0];
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Scratch file holding every tile, and the platform calls that map them.
+ *
+ * The file is deleted as soon as it is created (POSIX) or when its handle is
+ * closed (Windows), so nothing is left behind if the program crashes.
+ */
+struct TiledImage::Storage {
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+
+    Storage(const std::string& dir, std::uint64_t bytes)
+    {
+        char path[MAX_PATH];
+        if (GetTempFileNameA(dir.c_str(), "pst", 0, path) == 0) {
+            throw std::runtime_error("Cannot create a scratch file in " + dir);
+        }
+        file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            DeleteFileA(path);
+            throw std::runtime_error("Cannot open scratch file " + std::string(path));
+        }
+        // Sizing the mapping extends the file with zeros: a black image
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(bytes >> 32),
+                                     static_cast<DWORD>(bytes & 0xFFFFFFFFu), nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            throw std::runtime_error("Not enough disk space for a " + std::to_string(bytes >> 20) + " MiB scratch file");
+        }
+    }
+
+    ~Storage()
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+    }
+
+    unsigned char* map(std::uint64_t offset, std::size_t bytes)
+    {
+        void* data = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, static_cast<DWORD>(offset >> 32),
+                                   static_cast<DWORD>(offset & 0xFFFFFFFFu), bytes);
+        if (!data) throw std::runtime_error("Cannot map an image tile");
+        return static_cast<unsigned char*>(data);
+    }
+
+    void unmap(unsigned char* data, std::size_t) { UnmapViewOfFile(data); }
+#else
+    int fd = -1;
+
+    Storage(const std::string& dir, std::uint64_t bytes)
+    {
+        std::string path = (std::filesystem::path(dir) / "photosmith-tiles-XXXXXX").string();
+        fd = mkstemp(path.data());
+        if (fd < 0) throw std::runtime_error("Cannot create a scratch file in " + dir);
+        unlink(path.c_str());
+
+        bool sized = ftruncate(fd, static_cast<off_t>(bytes)) == 0;
+#ifdef __linux__
+        // Reserve the blocks now, so a full disk is an error here rather than SIGBUS on first write
+        sized = sized && posix_fallocate(fd, 0, static_cast<off_t>(bytes)) == 0;
+#endif
+        if (!sized) {
+            close(fd);
+            throw std::runtime_error("Not enough disk space for a " + std::to_string(bytes >> 20) + " MiB scratch file in " + dir);
+        }
+    }
+
+    ~Storage() { close(fd); }
+
+    unsigned char* map(std::uint64_t offset, std::size_t bytes)
+    {
+        void* data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(offset));
+        if (data == MAP_FAILED) throw std::runtime_error("Cannot map an image tile");
+        return static_cast<unsigned char*>(data);
+    }
+
+    void unmap(unsigned char* data, std::size_t bytes) { munmap(data, bytes); }
+#endif
+
+    Storage(const Storage&) = delete;
+    Storage& operator=(const Storage&) = delete;
+};
+
+TiledImage::TiledImage(int width, int height, const Options& options)
+    : width(width), height(height), opts(options)
+{
+    if (width <= 0 || height <= 0) throw std::invalid_argument("Tiled image dimensions must be positive");
+    if (opts.tileSize < 16) throw std::invalid_argument("Tile size must be at least 16 pixels");
+    if (opts.scratchDir.empty()) opts.scratchDir = std::filesystem::temp_directory_path().string();
+
+    tilesX = (width + opts.tileSize - 1) / opts.tileSize;
+    tilesY = (height + opts.tileSize - 1) / opts.tileSize;
+    const std::size_t pixelBytes = static_cast<std::size_t>(opts.tileSize) * opts.tileSize * 3;
+    tileBytes = (pixelBytes + TileAlignment - 1) / TileAlignment * TileAlignment;
+    // A tile and its halo span up to nine tiles; keep that many mapped even on a tiny budget
+    maxCachedTiles = std::max<std::size_t>(9, opts.cacheBytes / tileBytes);
+
+    const std::uint64_t fileBytes = static_cast<std::uint64_t>(tilesX) * tilesY * tileBytes;
+    storage = std::make_unique<Storage>(opts.scratchDir, fileBytes);
+}
+
+TiledImage::~TiledImage()
+{
+    unmapAll();
+}
+
+TiledImage::TiledImage(TiledImage&& other) noexcept
+    : width(other.width), height(other.height), tilesX(other.tilesX), tilesY(other.tilesY),
+      opts(std::move(other.opts)), tileBytes(other.tileBytes), maxCachedTiles(other.maxCachedTiles),
+      storage(std::move(other.storage)), cache(std::move(other.cache)), cacheIndex(std::move(other.cacheIndex))
+{
+    other.cache.clear();
+    other.cacheIndex.clear();
+    other.width = other.height = other.tilesX = other.tilesY = 0;
+}
+
+TiledImage& TiledImage::operator=(TiledImage&& other) noexcept
+{
+    if (this == &other) return *this;
+    unmapAll();
+    width = other.width;
+    height = other.height;
+    tilesX = other.tilesX;
+    tilesY = other.tilesY;
+    opts = std::move(other.opts);
+    tileBytes = other.tileBytes;
+    maxCachedTiles = other.maxCachedTiles;
+    storage = std::move(other.storage);
+    cache = std::move(other.cache);
+    cacheIndex = std::move(other.cacheIndex);
+    other.cache.clear();
+    other.cacheIndex.clear();
+    other.width = other.height = other.tilesX = other.tilesY = 0;
+    return *this;
+}
+
+unsigned char* TiledImage::tile(int index) const
+{
+    const auto found = cacheIndex.find(index);
+    if (found != cacheIndex.end()) {
+        cache.splice(cache.begin(), cache, found->second);
+        return found->second->data;
+    }
+    if (cache.size() >= maxCachedTiles) {
+        // Unmapping writes nothing: the pages belong to the file and the OS flushes them as needed
+        storage->unmap(cache.back().data, tileBytes);
+        cacheIndex.erase(cache.back().index);
+        cache.pop_back();
+    }
+    unsigned char* data = storage->map(static_cast<std::uint64_t>(index) * tileBytes, tileBytes);
+    cache.push_front({index, data});
+    cacheIndex[index] = cache.begin();
+    return data;
+}
+
+void TiledImage::unmapAll() const
+{
+    for (const CachedTile& entry : cache) storage->unmap(entry.data, tileBytes);
+    cache.clear();
+    cacheIndex.clear();
+}
+
+void TiledImage::copyRegion(int x, int y, int w, int h, unsigned char* pixels, std::size_t stride, bool intoTiles) const
+{
+    const int tileSize = opts.tileSize;
+    const std::size_t tileStride = static_cast<std::size_t>(tileSize) * 3;
+    for (int ty = y / tileSize; ty <= (y + h - 1) / tileSize; ++ty) {
+        const int rowBegin = std::max(y, ty * tileSize);
+        const int rowEnd = std::min(y + h, (ty + 1) * tileSize);
+        for (int tx = x / tileSize; tx <= (x + w - 1) / tileSize; ++tx) {
+            const int colBegin = std::max(x, tx * tileSize);
+            const int colEnd = std::min(x + w, (tx + 1) * tileSize);
+            const std::size_t bytes = static_cast<std::size_t>(colEnd - colBegin) * 3;
+            unsigned char* tileData = tile(ty * tilesX + tx);
+            for (int row = rowBegin; row < rowEnd; ++row) {
+                unsigned char* inTile = tileData + (row - ty * tileSize) * tileStride + (colBegin - tx * tileSize) * 3;
+                unsigned char* inBuffer = pixels + (row - y) * stride + static_cast<std::size_t>(colBegin - x) * 3;
+                if (intoTiles) {
+                    std::memcpy(inTile, inBuffer, bytes);
+                } else {
+                    std::memcpy(inBuffer, inTile, bytes);
+                }
+            }
+        }
+    }
+}
+
+Image TiledImage::readRegion(int x, int y, int w, int h) const
+{
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x > width - w || y > height - h) {
+        throw std::out_of_range("Region lies outside the tiled image");
+    }
+    Image region(w, h);
+    ImageView view = region.view();
+    copyRegion(x, y, w, h, view.row(0), static_cast<std::size_t>(w) * 3, false);
+    return region;
+}
+
+void TiledImage::writeRegion(int x, int y, const Image& source, int sourceX, int sourceY, int w, int h)
+{
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x > width - w || y > height - h) {
+        throw std::out_of_range("Region lies outside the tiled image");
+    }
+    if (sourceX < 0 || sourceY < 0 || sourceX > source.width - w || sourceY > source.height - h) {
+        throw std::out_of_range("Region lies outside the source image");
+    }
+    const std::size_t stride = static_cast<std::size_t>(source.width) * 3;
+    // copyRegion() only reads from the buffer when writing into tiles
+    unsigned char* pixels = const_cast<unsigned char*>(source.constView().row(sourceY)) + static_cast<std::size_t>(sourceX) * 3;
+    copyRegion(x, y, w, h, pixels, stride, true);
+}
+
+TiledImage TiledImage::fromImage(const Image& image, const Options& options)
+{
+    TiledImage tiled(image.width, image.height, options);
+    tiled.writeRegion(0, 0, image, 0, 0, image.width, image.height);
+    return tiled;
+}
+
+bool TiledImage::transformInto(TiledImage& destination, int halo, const std::function<void(Image& region)>& filter,
+                               std::atomic<bool>* cancelRequested,
+                               const std::function<void(int done, int total)>& progress) const
+{
+    if (&destination == this) throw std::invalid_argument("transformInto() needs a separate destination image");
+    if (destination.width != width || destination.height != height) {
+        throw std::invalid_argument("transformInto() needs a destination of the same size");
+    }
+    halo = std::max(0, halo);
+
+    const int tileSize = opts.tileSize;
+    const int total = tilesX * tilesY;
+    int done = 0;
+    for (int ty = 0; ty < tilesY; ++ty) {
+        for (int tx = 0; tx < tilesX; ++tx) {
+            if (cancelRequested && *cancelRequested) return false;
+
+            const int x0 = tx * tileSize;
+            const int y0 = ty * tileSize;
+            const int w = std::min(tileSize, width - x0);
+            const int h = std::min(tileSize, height - y0);
+            // Context is clipped at the image edges, where the filter sees the same border as on the whole image
+            const int rx0 = std::max(0, x0 - halo);
+            const int ry0 = std::max(0, y0 - halo);
+            const int rx1 = std::min(width, x0 + w + halo);
+            const int ry1 = std::min(height, y0 + h + halo);
+
+            Image region = readRegion(rx0, ry0, rx1 - rx0, ry1 - ry0);
+            filter(region);
+            if (region.width != rx1 - rx0 || region.height != ry1 - ry0) {
+                throw std::runtime_error("A tiled filter must not change the image size");
+            }
+            destination.writeRegion(x0, y0, region, x0 - rx0, y0 - ry0, w, h);
+
+            if (progress) progress(++done, total);
+        }
+    }
+    return true;
+}
+
+TiledImage TiledImage::load(const std::string& filename, const Options& options)
+{
+    const std::string ext = lowercaseExtension(filename);
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) throw std::invalid_argument("Invalid filename, File Does not Exist");
+
+    // Uncompressed BMP and TGA rows sit at fixed offsets, so they are read one band of tiles at a time
+    unsigned char header[54] = {};
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    const std::streamsize headerBytes = in.gcount();
+    in.clear();
+
+    int width = 0, height = 0, bytesPerPixel = 0;
+    bool topDown = false;
+    std::uint64_t dataOffset = 0, fileStride = 0;
+
+    if (ext == ".bmp" && headerBytes >= 54 && header[0] == 'B' && header[1] == 'M') {
+        const std::uint32_t bpp = readU16(header + 28);
+        const auto bmpHeight = static_cast<std::int32_t>(readU32(header + 22));
+        if (readU32(header + 14) >= 40 && readU32(header + 30) == 0 && (bpp == 24 || bpp == 32)
+            && static_cast<std::int32_t>(readU32(header + 18)) > 0 && bmpHeight != 0 && bmpHeight != INT32_MIN) {
+            width = static_cast<int>(readU32(header + 18));
+            height = bmpHeight < 0 ? -bmpHeight : bmpHeight;
+            topDown = bmpHeight < 0;
+            bytesPerPixel = static_cast<int>(bpp / 8);
+            dataOffset = readU32(header + 10);
+            fileStride = (static_cast<std::uint64_t>(width) * bpp + 31) / 32 * 4;
+        }
+    } else if (ext == ".tga" && headerBytes >= 18) {
+        const unsigned char bpp = header[16];
+        const unsigned char descriptor = header[17];
+        // Type 2 = uncompressed true colour; right-to-left images are left to the codecs
+        if (header[1] == 0 && header[2] == 2 && (bpp == 24 || bpp == 32) && !(descriptor & 0x10)
+            && readU16(header + 12) > 0 && readU16(header + 14) > 0) {
+            width = static_cast<int>(readU16(header + 12));
+            height = static_cast<int>(readU16(header + 14));
+            topDown = (descriptor & 0x20) != 0;
+            bytesPerPixel = bpp / 8;
+            dataOffset = 18 + header[0];
+            fileStride = static_cast<std::uint64_t>(width) * bytesPerPixel;
+        }
+    }
+
+    if (bytesPerPixel == 0) {
+        // Compressed formats: the codecs have no incremental decoder, so the picture is decoded whole once
+        in.close();
+        return fromImage(ImageCodecs::load(filename), options);
+    }
+
+    TiledImage image(width, height, options);
+    const int tileSize = image.opts.tileSize;
+    Image band(width, std::min(tileSize, height));
+    ImageView bandView = band.view();
+    std::vector<unsigned char> fileRow(static_cast<std::size_t>(fileStride));
+
+    // Visit the bands in file order, so the whole file is read front to back
+    for (int b = 0; b < image.tilesY; ++b) {
+        const int ty = topDown ? b : image.tilesY - 1 - b;
+        const int y0 = ty * tileSize;
+        const int rows = std::min(tileSize, height - y0);
+        const std::uint64_t firstFileRow = topDown ? y0 : height - y0 - rows;
+        in.seekg(static_cast<std::streamoff>(dataOffset + firstFileRow * fileStride));
+        for (int r = 0; r < rows; ++r) {
+            in.read(reinterpret_cast<char*>(fileRow.data()), static_cast<std::streamsize>(fileStride));
+            if (!in) throw std::invalid_argument("Corrupt or truncated image file: " + filename);
+            const int y = topDown ? r : rows - 1 - r;
+            bgrToRgb(fileRow.data(), bandView.row(y), width, bytesPerPixel);
+        }
+        image.writeRegion(0, y0, band, 0, 0, width, rows);
+    }
+    return image;
+}
+
+void TiledImage::save(const std::string& filename, const ImageEncodeOptions& options) const
+{
+    const std::string ext = lowercaseExtension(filename);
+    if (ext != ".bmp" && ext != ".tga") {
+        // The codecs have no incremental encoder either; other formats need the whole picture in memory
+        if (!ImageCodecs::isSupported(ext)) throw std::invalid_argument("File Extension is not supported: " + filename);
+        ImageCodecs::save(toImage(), filename, options);
+        return;
+    }
+
+    const bool bmp = ext == ".bmp";
+    const std::uint64_t stride = bmp ? (static_cast<std::uint64_t>(width) * 3 + 3) / 4 * 4 : static_cast<std::uint64_t>(width) * 3;
+    std::string header;
+    if (bmp) {
+        const std::uint64_t fileBytes = 54 + stride * height;
+        if (fileBytes > 0xFFFFFFFFu) throw std::invalid_argument("Image too large for BMP (over 4 GB); save as TGA instead");
+        header += "BM";
+        putU32(header, static_cast<std::uint32_t>(fileBytes));
+        putU32(header, 0);
+        putU32(header, 54);
+        putU32(header, 40);
+        putU32(header, static_cast<std::uint32_t>(width));
+        putU32(header, static_cast<std::uint32_t>(height)); // positive: rows stored bottom-up
+        putU16(header, 1);
+        putU16(header, 24);
+        putU32(header, 0);
+        putU32(header, static_cast<std::uint32_t>(stride * height));
+        putU32(header, 2835); // 72 DPI
+        putU32(header, 2835);
+        putU32(header, 0);
+        putU32(header, 0);
+    } else {
+        if (width > 0xFFFF || height > 0xFFFF) throw std::invalid_argument("Image too large for TGA (over 65535 pixels)");
+        header.append(2, '\0');
+        header += '\2';
+        header.append(9, '\0');
+        putU16(header, static_cast<std::uint32_t>(width));
+        putU16(header, static_cast<std::uint32_t>(height));
+        header += '\x18';
+        header += '\x20'; // top-left origin
+    }
+
+    ImageCodecs::replaceFile(filename, [&](const std::string& temporary) {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Cannot write " + filename);
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+        std::vector<unsigned char> fileRow(static_cast<std::size_t>(stride), 0);
+        const int tileSize = opts.tileSize;
+        for (int b = 0; b < tilesY && out; ++b) {
+            const int ty = bmp ? tilesY - 1 - b : b;
+            const int y0 = ty * tileSize;
+            const int rows = std::min(tileSize, height - y0);
+            const Image band = readRegion(0, y0, width, rows);
+            const ConstImageView bandView = band.constView();
+            for (int r = 0; r < rows; ++r) {
+                rgbToBgr(bandView.row(bmp ? rows - 1 - r : r), fileRow.data(), width);
+                out.write(reinterpret_cast<const char*>(fileRow.data()), static_cast<std::streamsize>(stride));
+            }
+        }
+        out.close();
+        if (!out) throw std::runtime_error("Cannot write " + filename);
+    });
+}
@@ -0,0 +1,236 @@
+/**
+ * @file TiledImage.h
+ * @brief RGB image stored as tiles in a memory-mapped scratch file.
+ *
+ * This file declares the TiledImage class, the out-of-core counterpart of
+ * Image for scans too large to hold in memory. Pixels live in fixed-size
+ * square tiles inside a temporary file; only the most recently used tiles are
+ * mapped into memory at any time (an LRU cache bounded in bytes), so resident
+ * memory depends on the tile size and cache budget, not on the image size.
+ *
+ * @details The tiled image provides:
+ * - Tiles of tileSize x tileSize RGB pixels, paged in and out on demand
+ * - Region reads and writes between tiles and ordinary Images
+ * - transformInto(): runs any Image filter over the image one tile at a
+ *   time, with a halo of surrounding pixels for neighbourhood filters
+ * - Streaming load and save of uncompressed BMP and TGA, band by band
+ * - Other formats through ImageCodecs, which need the whole picture in
+ *   memory once while it is decoded or encoded
+ *
+ * @note Not thread-safe: use each TiledImage from one thread at a time. The
+ *       filters run by transformInto() may still use the ThreadPool.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef TILEDIMAGE_H
+#define TILEDIMAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "Image_Class.h"
+#include "../io/ImageCodecs.h"
+
+/**
+ * @brief Tile layout and storage options for TiledImage.
+ */
+struct TiledImageOptions {
+    int tileSize = 512;                              ///< Tile edge in pixels, at least 16 (512 x 512 RGB = 768 KiB)
+    std::size_t cacheBytes = std::size_t(256) << 20; ///< Mapped tiles kept before the least recently used is unmapped
+    std::string scratchDir;                          ///< Directory for the scratch file; empty = system temp directory
+};
+
+/**
+ * @class TiledImage
+ * @brief Out-of-core RGB image with an LRU cache of mapped tiles.
+ *
+ * @code
+ * TiledImage scan = TiledImage::load("scan.bmp");
+ * TiledImage blurred(scan.width, scan.height);
+ * scan.transformInto(blurred, 30, [&](Image& region) {
+ *     Image before = region;
+ *     filters.applyBlur(region, before, cancel, 60);
+ * });
+ * blurred.save("scan-blurred.bmp");
+ * @endcode
+ */
+class TiledImage {
+public:
+    /// Tile layout and storage options.
+    using Options = TiledImageOptions;
+
+    /**
+     * @brief Creates a black image backed by a new scratch file.
+     *
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param options Tile size, cache budget and scratch directory
+     * @throws std::invalid_argument If a dimension is not positive
+     * @throws std::runtime_error If the scratch file cannot be created
+     */
+    TiledImage(int width, int height, const Options& options = Options());
+
+    /**
+     * @brief Unmaps every tile and deletes the scratch file.
+     */
+    ~TiledImage();
+
+    TiledImage(TiledImage&& other) noexcept;
+    TiledImage& operator=(TiledImage&& other) noexcept;
+    TiledImage(const TiledImage&) = delete;
+    TiledImage& operator=(const TiledImage&) = delete;
+
+    /**
+     * @brief Reads an image file into tiles.
+     *
+     * Uncompressed 24/32-bit BMP and TGA files are streamed one band of tiles
+     * at a time. Other files are decoded whole by ImageCodecs, copied into
+     * tiles and released.
+     *
+     * @param filename File to read (any format ImageCodecs supports)
+     * @param options Tile size, cache budget and scratch directory
+     * @return The tiled image
+     * @throws std::invalid_argument If the file is missing, unsupported or corrupt
+     */
+    static TiledImage load(const std::string& filename, const Options& options = Options());
+
+    /**
+     * @brief Copies an in-memory image into tiles.
+     */
+    static TiledImage fromImage(const Image& image, const Options& options = Options());
+
+    /**
+     * @brief Writes the image to a file; the format follows the extension.
+     *
+     * BMP and TGA are written band by band. Other formats are assembled into
+     * one Image and encoded by ImageCodecs, so they need memory for the whole
+     * picture. Either way the file is replaced atomically (ImageCodecs::replaceFile).
+     *
+     * @param filename Output file
+     * @param options Quality and compression for formats encoded by ImageCodecs
+     * @throws std::invalid_argument If the extension is unsupported or the
+     *         image is too large for the format
+     * @throws std::runtime_error If the file cannot be written
+     */
+    void save(const std::string& filename, const ImageEncodeOptions& options = ImageEncodeOptions()) const;
+
+    /**
+     * @brief Copies a rectangle out of the tiles.
+     *
+     * @param x Left edge
+     * @param y Top edge
+     * @param w Width (the rectangle must lie inside the image)
+     * @param h Height
+     * @return The pixels as an ordinary Image
+     * @throws std::out_of_range If the rectangle leaves the image
+     */
+    Image readRegion(int x, int y, int w, int h) const;
+
+    /**
+     * @brief Copies a rectangle of @p source into the tiles.
+     *
+     * @param x Left edge of the destination
+     * @param y Top edge of the destination
+     * @param source Pixels to copy from
+     * @param sourceX Left edge of the rectangle within @p source
+     * @param sourceY Top edge of the rectangle within @p source
+     * @param w Width of the rectangle
+     * @param h Height of the rectangle
+     * @throws std::out_of_range If the rectangle leaves either image
+     */
+    void writeRegion(int x, int y, const Image& source, int sourceX, int sourceY, int w, int h);
+
+    /**
+     * @brief Copies the whole image into memory.
+     */
+    Image toImage() const { return readRegion(0, 0, width, height); }
+
+    /**
+     * @brief Runs @p filter on every tile, writing the results to @p destination.
+     *
+     * Each tile is read together with up to @p halo pixels of its neighbours,
+     * filtered, and its centre written to the same place in @p destination.
+     * A filter whose output pixels depend only on inputs within @p halo
+     * pixels therefore gives the same result as on the whole image.
+     * Filters that look further (or at the whole image) cannot be streamed.
+     *
+     * @param destination Image of the same size; must not be this image
+     * @param halo Context pixels around each tile
+     * @param filter Transforms a region in place, keeping its size
+     * @param cancelRequested Optional flag checked between tiles
+     * @param progress Optional callback receiving (tiles done, total tiles)
+     * @return False if cancelled (@p destination is then incomplete)
+     * @throws std::invalid_argument If the sizes differ or @p destination is this image
+     * @throws std::runtime_error If @p filter changes the region's size
+     */
+    bool transformInto(TiledImage& destination, int halo, const std::function<void(Image& region)>& filter,
+                       std::atomic<bool>* cancelRequested = nullptr,
+                       const std::function<void(int done, int total)>& progress = {}) const;
+
+    /**
+     * @brief Tile layout and storage options this image was created with.
+     */
+    const Options& options() const { return opts; }
+
+    /**
+     * @brief Bytes of tiles currently mapped into memory.
+     */
+    std::size_t residentBytes() const { return cache.size() * tileBytes; }
+
+    int width = 0;   ///< Width in pixels
+    int height = 0;  ///< Height in pixels
+    int tilesX = 0;  ///< Tiles per row
+    int tilesY = 0;  ///< Rows of tiles
+
+private:
+    struct Storage;
+
+    /**
+     * @brief One mapped tile in the LRU cache.
+     */
+    struct CachedTile {
+        int index;           ///< Tile number, row-major
+        unsigned char* data; ///< Mapped pixels, tileSize x tileSize, stride tileSize * 3
+    };
+
+    /**
+     * @brief Maps tile @p index (if needed) and marks it most recently used.
+     */
+    unsigned char* tile(int index) const;
+
+    /**
+     * @brief Unmaps every cached tile.
+     */
+    void unmapAll() const;
+
+    /**
+     * @brief Copies a rectangle between the tiles and a pixel buffer.
+     *
+     * @param pixels Top-left pixel of the rectangle in the buffer
+     * @param stride Bytes between rows of the buffer
+     * @param intoTiles True to write the buffer into the tiles, false to read
+     */
+    void copyRegion(int x, int y, int w, int h, unsigned char* pixels, std::size_t stride, bool intoTiles) const;
+
+    Options opts;                                         ///< Creation options
+    std::size_t tileBytes = 0;                            ///< Bytes per tile in the scratch file (page aligned)
+    std::size_t maxCachedTiles = 0;                       ///< Cache capacity in tiles
+    std::unique_ptr<Storage> storage;                     ///< Scratch file and mapping handles
+    mutable std::list<CachedTile> cache;                  ///< Mapped tiles, most recently used first
+    mutable std::unordered_map<int, std::list<CachedTile>::iterator> cacheIndex; ///< Tile number -> cache entry
+};
+
+#endif // TILEDIMAGE_H
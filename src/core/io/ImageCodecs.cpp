@@ -0,0 +1,291 @@
+/**
+ * @file ImageCodecs.cpp
+ * @brief Implementation of the codec registry.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "ImageCodecs.h"
+#include "codecs/CodecBackends.h"
+#include "../image/PixelConverter.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::string normalizedExtension(std::string ext)
+{
+    if (!ext.empty() && ext[0] != '.') ext.insert(ext.begin(), '.');
+    for (char& ch : ext) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    return ext;
+}
+
+std::string extensionOf(const std::string& filename)
+{
+    const std::size_t dot = filename.rfind('.');
+    return dot == std::string::npos ? std::string() : normalizedExtension(filename.substr(dot));
+}
+
+/**
+ * @brief A hidden, unique name next to @p filename with the same extension.
+ *
+ * The codecs pick the format from the extension, so it is kept last:
+ * "dir/photo.png" becomes "dir/.photo-1a2b3c4d.tmp.png".
+ */
+std::filesystem::path temporarySibling(const std::filesystem::path& filename)
+{
+    static std::atomic<unsigned> counter{std::random_device{}()};
+    char tag[16];
+    std::snprintf(tag, sizeof(tag), "-%08x", counter.fetch_add(1));
+    return filename.parent_path()
+           / ("." + filename.stem().string() + tag + ".tmp" + filename.extension().string());
+}
+
+/**
+ * @brief The file @p filename ends up at after following symbolic links.
+ *
+ * Replacing a link by renaming over it would swap the link for a regular
+ * file and leave the file it points to unchanged. Dangling links resolve to
+ * where their target would be; a loop gives up and returns the last link.
+ */
+std::filesystem::path resolveLinks(std::filesystem::path filename)
+{
+    namespace fs = std::filesystem;
+    std::error_code error;
+    for (int hops = 0; hops < 40 && fs::is_symlink(fs::symlink_status(filename, error)); ++hops) {
+        const fs::path link = fs::read_symlink(filename, error);
+        if (error) break;
+        filename = link.is_absolute() ? link : filename.parent_path() / link;
+    }
+    return filename;
+}
+
+/**
+ * @brief Flushes @p filename's data to the disk, so a crash after the rename cannot leave it empty or truncated.
+ *
+ * @return False if the file could not be opened or flushed
+ */
+bool syncFile(const std::filesystem::path& filename)
+{
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(filename.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    const bool flushed = FlushFileBuffers(file) != 0;
+    CloseHandle(file);
+    return flushed;
+#else
+    const int file = ::open(filename.c_str(), O_RDONLY);
+    if (file < 0) return false;
+    const bool flushed = ::fsync(file) == 0;
+    ::close(file);
+    return flushed;
+#endif
+}
+
+/**
+ * @brief Flushes the directory entry of a rename in @p directory (POSIX; NTFS journals it itself).
+ *
+ * Best effort: some file systems cannot sync directories, and the file's own
+ * data is already on the disk by then.
+ */
+void syncDirectory(const std::filesystem::path& directory)
+{
+#ifndef _WIN32
+    const int dir = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (dir < 0) return;
+    ::fsync(dir);
+    ::close(dir);
+#else
+    (void)directory;
+#endif
+}
+
+} // namespace
+
+std::vector<unsigned char> readCodecFile(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) throw std::invalid_argument("Invalid filename, File Does not Exist");
+    const std::streamoff size = in.tellg();
+    std::vector<unsigned char> data(static_cast<std::size_t>(std::max<std::streamoff>(0, size)));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!in) throw std::invalid_argument("Cannot read " + filename);
+    return data;
+}
+
+void writeCodecFile(const std::string& filename, const unsigned char* data, std::size_t size)
+{
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    out.close();
+    if (!out) throw std::runtime_error("Cannot write " + filename);
+}
+
+const std::vector<std::unique_ptr<ImageCodec>>& ImageCodecs::codecs()
+{
+    static const std::vector<std::unique_ptr<ImageCodec>> list = []() {
+        std::vector<std::unique_ptr<ImageCodec>> available;
+        // PHOTOSMITH_CODECS=stb skips the optional backends (e.g. for comparisons)
+        const char* env = std::getenv("PHOTOSMITH_CODECS");
+        if (!env || std::string(env) != "stb") {
+#ifdef PHOTOSMITH_HAVE_JPEG_TURBO
+            available.push_back(makeJpegTurboCodec());
+#endif
+#ifdef PHOTOSMITH_HAVE_SPNG
+            available.push_back(makeSpngCodec());
+#endif
+#ifdef PHOTOSMITH_HAVE_WEBP
+            available.push_back(makeWebpCodec());
+#endif
+        }
+        available.push_back(makeStbCodec());
+        return available;
+    }();
+    return list;
+}
+
+const ImageCodec* ImageCodecs::encoderFor(const std::string& extension)
+{
+    for (const std::unique_ptr<ImageCodec>& codec : codecs()) {
+        const std::vector<std::string> handled = codec->extensions();
+        if (std::find(handled.begin(), handled.end(), extension) != handled.end()) return codec.get();
+    }
+    return nullptr;
+}
+
+Image ImageCodecs::load(const std::string& filename, const ImageDecodeOptions& options)
+{
+    unsigned char signature[16] = {};
+    std::size_t signatureSize = 0;
+    {
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) throw std::invalid_argument("Invalid filename, File Does not Exist");
+        in.read(reinterpret_cast<char*>(signature), sizeof(signature));
+        signatureSize = static_cast<std::size_t>(in.gcount());
+    }
+
+    // A backend may refuse a variant it does not support (e.g. CMYK JPEG); the next one gets a try
+    std::string lastError = "Unsupported image format";
+    for (const std::unique_ptr<ImageCodec>& codec : codecs()) {
+        if (!codec->canDecode(signature, signatureSize)) continue;
+        try {
+            return PixelConverter::conform(codec->decode(filename, options), options.formats);
+        } catch (const std::invalid_argument& e) {
+            lastError = e.what();
+        }
+    }
+    throw std::invalid_argument(lastError);
+}
+
+void ImageCodecs::save(const Image& image, const std::string& filename, const ImageEncodeOptions& options)
+{
+    if (image.width <= 0 || image.height <= 0 || !image.imageData) {
+        throw std::invalid_argument("Cannot save an empty image");
+    }
+    const ImageCodec* codec = encoderFor(extensionOf(filename));
+    if (!codec) {
+        std::string list;
+        for (const std::string& ext : extensions()) list += (list.empty() ? "" : ", ") + ext;
+        throw std::invalid_argument("File Extension is not supported, Only " + list + " are supported");
+    }
+    ImageEncodeOptions clamped = options;
+    clamped.quality = std::clamp(options.quality, 1, 100);
+    clamped.pngLevel = std::clamp(options.pngLevel, -1, 9);
+
+    const Image encoded = PixelConverter::conform(image, codec->encodeFormats());
+    replaceFile(filename, [&](const std::string& temporary) {
+        try {
+            codec->encode(encoded, temporary, clamped);
+        } catch (const std::runtime_error& e) {
+            // Report the file the caller asked for, not the temporary
+            std::string message = e.what();
+            const std::size_t at = message.find(temporary);
+            if (at != std::string::npos) message.replace(at, temporary.size(), filename);
+            throw std::runtime_error(message);
+        }
+    });
+}
+
+void ImageCodecs::replaceFile(const std::string& filename, const std::function<void(const std::string&)>& write)
+{
+    // Written beside the target and renamed over it: readers see the old file or the new one,
+    // never half of one, and a failed write leaves the old file untouched
+    namespace fs = std::filesystem;
+    const fs::path target = resolveLinks(filename);
+    const fs::path temporary = temporarySibling(target);
+    std::error_code error;
+    try {
+        write(temporary.string());
+    } catch (...) {
+        fs::remove(temporary, error);
+        throw;
+    }
+    const fs::file_status existing = fs::status(target, error);
+    if (fs::exists(existing)) fs::permissions(temporary, existing.permissions(), error);
+    // The data must be on the disk before the new name points at it
+    if (!syncFile(temporary)) {
+        fs::remove(temporary, error);
+        throw std::runtime_error("Cannot write " + filename + ": flushing to disk failed");
+    }
+    fs::rename(temporary, target, error);
+    if (error) {
+        std::error_code ignored;
+        fs::remove(temporary, ignored);
+        throw std::runtime_error("Cannot write " + filename + ": " + error.message());
+    }
+    syncDirectory(target.parent_path());
+}
+
+bool ImageCodecs::isSupported(const std::string& extension)
+{
+    return encoderFor(normalizedExtension(extension)) != nullptr;
+}
+
+std::vector<std::string> ImageCodecs::extensions()
+{
+    std::vector<std::string> all;
+    for (const std::unique_ptr<ImageCodec>& codec : codecs()) {
+        for (const std::string& ext : codec->extensions()) {
+            if (std::find(all.begin(), all.end(), ext) == all.end()) all.push_back(ext);
+        }
+    }
+    return all;
+}
+
+std::string ImageCodecs::describe()
+{
+    std::string text;
+    for (const std::string& ext : extensions()) {
+        if (!text.empty()) text += ", ";
+        text += ext + ": " + encoderFor(ext)->name();
+    }
+    return text;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file ImageCodecs.h
+ * @brief Pluggable image codecs with format-specific fast paths.
+ *
+ * This file declares the ImageCodec interface and the ImageCodecs registry
+ * that picks a backend for every file read or written. Optional backends are
+ * chosen at build time (see the PHOTOSMITH_WITH_* CMake options); STB is
+ * always built in and handles every format no other backend claims.
+ *
+ * @details Available backends, in order of preference:
+ * - libjpeg-turbo (through its libjpeg API): SIMD JPEG decode/encode, and
+ *   DCT-domain scaled decoding (1/2, 1/4, 1/8) for fast previews
+ * - libspng: faster PNG decode/encode with a configurable zlib level
+ * - libwebp: WebP decode and lossy/lossless encode
+ * - STB (stb_image / stb_image_write): PNG, JPEG, BMP and TGA fallback
+ *
+ * Decoders are chosen by the file's signature bytes, so a mislabelled file
+ * still loads; encoders are chosen by the output file's extension.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef IMAGECODECS_H
+#define IMAGECODECS_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../image/Image_Class.h"
+
+/**
+ * @brief How to decode an image.
+ */
+struct ImageDecodeOptions {
+    /// Smallest acceptable size. Codecs that can scale while decoding (JPEG
+    /// DCT scaling) return the smallest image at least this large; others
+    /// ignore it. 0 x 0 (the default) decodes at full size.
+    int minWidth = 0;
+    int minHeight = 0;
+    /// Formats the caller can take. The image keeps the file's own channels
+    /// and depth when they are listed and is converted to the nearest listed
+    /// format otherwise; the default, 8-bit RGB, is what the editor works on.
+    PixelFormatSet formats = {PixelFormat::rgb8()};
+};
+
+/**
+ * @brief How to encode an image.
+ */
+struct ImageEncodeOptions {
+    int quality = 90;    ///< JPEG and lossy WebP quality, 1-100
+    int pngLevel = -1;   ///< PNG zlib level 0 (fastest) to 9 (smallest); -1 = the backend's default
+    bool lossless = false; ///< Lossless WebP
+};
+
+/**
+ * @class ImageCodec
+ * @brief One decoding/encoding backend.
+ */
+class ImageCodec {
+public:
+    virtual ~ImageCodec() = default;
+
+    /**
+     * @brief Backend name shown to users, e.g. "libjpeg-turbo".
+     */
+    virtual std::string name() const = 0;
+
+    /**
+     * @brief Lower-case extensions (with the dot) this backend can write.
+     */
+    virtual std::vector<std::string> extensions() const = 0;
+
+    /**
+     * @brief True if this backend can decode a file starting with @p signature.
+     *
+     * @param signature The file's first bytes
+     * @param size Number of bytes available (at least 12 unless the file is shorter)
+     */
+    virtual bool canDecode(const unsigned char* signature, std::size_t size) const = 0;
+
+    /**
+     * @brief Reads @p filename into an image.
+     *
+     * Backends return a format from options.formats when they can, and 8-bit
+     * RGB otherwise; ImageCodecs::load() converts whatever is not accepted.
+     *
+     * @throws std::invalid_argument If the file cannot be read or decoded
+     */
+    virtual Image decode(const std::string& filename, const ImageDecodeOptions& options) const = 0;
+
+    /**
+     * @brief Pixel formats encode() writes without conversion (8-bit RGB unless overridden).
+     */
+    virtual PixelFormatSet encodeFormats() const { return {PixelFormat::rgb8()}; }
+
+    /**
+     * @brief Writes @p image to @p filename in the format of its extension.
+     *
+     * @p image is always in one of encodeFormats().
+     * @throws std::runtime_error If the file cannot be written
+     */
+    virtual void encode(const Image& image, const std::string& filename, const ImageEncodeOptions& options) const = 0;
+};
+
+/**
+ * @class ImageCodecs
+ * @brief Registry of the codecs built into this binary.
+ *
+ * @code
+ * Image preview = ImageCodecs::load("photo.jpg", {1920, 1080}); // scaled JPEG decode
+ * ImageEncodeOptions options;
+ * options.quality = 82;
+ * ImageCodecs::save(preview, "preview.jpg", options);
+ * @endcode
+ */
+class ImageCodecs {
+public:
+    /**
+     * @brief Decodes @p filename with the best backend for its contents.
+     *
+     * The result is always in one of options.formats.
+     * @throws std::invalid_argument If the file is missing, unsupported or corrupt
+     */
+    static Image load(const std::string& filename, const ImageDecodeOptions& options = ImageDecodeOptions());
+
+    /**
+     * @brief Encodes @p image with the best backend for the extension of @p filename.
+     *
+     * The file is written under a temporary name in the same directory and
+     * then renamed over @p filename, so the old file is replaced atomically
+     * and survives a failed save. Only reads the pixels: a shared
+     * copy-on-write buffer stays shared, so another thread may keep editing
+     * its own copy of the image meanwhile. Formats the backend cannot write
+     * are converted first (e.g. 16-bit to 8-bit, planar to interleaved).
+     *
+     * @throws std::invalid_argument If the image is empty or the extension is unsupported
+     * @throws std::runtime_error If the file cannot be written
+     */
+    static void save(const Image& image, const std::string& filename,
+                     const ImageEncodeOptions& options = ImageEncodeOptions());
+
+    /**
+     * @brief Replaces @p filename atomically with what @p write puts in a temporary file.
+     *
+     * @p write receives a fresh path in the same directory, with the same
+     * extension, and must create the complete file there. It is flushed to
+     * the disk and renamed over @p filename (keeping the old file's
+     * permissions), then the directory is flushed; if @p write throws, the
+     * temporary is deleted and @p filename is left as it was. A symbolic link
+     * is followed: the file it points to is replaced, and the link kept.
+     * @throws std::runtime_error If the flush or the rename fails
+     */
+    static void replaceFile(const std::string& filename, const std::function<void(const std::string&)>& write);
+
+    /**
+     * @brief True if files with @p extension ("png" or ".png", any case) can be written.
+     */
+    static bool isSupported(const std::string& extension);
+
+    /**
+     * @brief Every writable extension, lower-case with the dot.
+     */
+    static std::vector<std::string> extensions();
+
+    /**
+     * @brief Which backend handles each extension, e.g. ".jpg: libjpeg-turbo, .png: stb".
+     */
+    static std::string describe();
+
+private:
+    /**
+     * @brief The built-in backends, most preferred first (STB last).
+     */
+    static const std::vector<std::unique_ptr<ImageCodec>>& codecs();
+
+    /**
+     * @brief The first backend that writes @p extension, or nullptr.
+     */
+    static const ImageCodec* encoderFor(const std::string& extension);
+};
+
+#endif // IMAGECODECS_H
@@ -3,22 +3,23 @@
  * @brief Qt-integrated image file I/O operations with comprehensive error handling.
  * 
  * This file provides a high-level interface for loading and saving images using Qt's
- * file system integration. It wraps the underlying Image class functionality with
- * proper error handling, file validation, and Qt string compatibility.
+ * file system integration. It wraps the ImageCodecs registry (libjpeg-turbo,
+ * spng, WebP or STB, whichever this build has) with proper error handling,
+ * file validation, and Qt string compatibility.
  * 
  * @details The ImageIO class provides:
  * - Safe file loading with existence and format validation
  * - Safe file saving with path validation
  * - Qt QString integration for cross-platform path handling
  * - Comprehensive error handling with descriptive exceptions
- * - Support for all image formats supported by the Image class
+ * - Support for every format a built-in codec can handle
  * 
  * @features
  * - File existence validation before loading
  * - Path validation for both load and save operations
  * - Exception safety with descriptive error messages
  * - Qt integration for seamless GUI application use
- * - Support for multiple image formats (PNG, JPEG, BMP, TGA)
+ * - Support for multiple image formats (PNG, JPEG, BMP, TGA, and WebP when built with libwebp)
  * 
  * @author Team Members:
  * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
@@ -36,8 +37,11 @@
 
 #include <QString>
 #include <QFileInfo>
+#include <cctype>
 #include <stdexcept>
+#include <string>
 #include "../image/Image_Class.h"
+#include "ImageCodecs.h"
 
 /**
  * @class ImageIO
@@ -74,8 +78,8 @@ public:
      *   - The file format is not supported
      *   - The file is corrupted or cannot be read
      * 
-     * @note Supported formats: PNG, JPEG, BMP, TGA
-     * @see Image::loadNewImage() for underlying loading implementation
+     * @note Supported formats: PNG, JPEG, BMP, TGA (+ WebP with libwebp)
+     * @see ImageCodecs::load() for underlying loading implementation
      * @see QFileInfo for file validation
      * 
      * @example
@@ -97,9 +101,7 @@ public:
         if (!fi.exists() || !fi.isFile()) {
             throw std::invalid_argument("File does not exist");
         }
-        Image img;
-        img.loadNewImage(path.toStdString());
-        return img;
+        return ImageCodecs::load(path.toStdString());
     }
 
     /**
@@ -111,17 +113,20 @@ public:
      * 
      * @param image Const reference to the Image object to save
      * @param path Qt string containing the file path where to save the image
+     * @param options JPEG/WebP quality and PNG compression level
      * 
      * @throws std::invalid_argument if:
      *   - The path is empty
      *   - The file extension is not supported
-     *   - The directory does not exist or is not writable
-     *   - There is insufficient disk space
      *   - The image data is invalid
+     * @throws std::runtime_error if the file cannot be written (missing or
+     *   read-only directory, insufficient disk space)
      * 
-     * @note Supported formats: PNG, JPEG, BMP, TGA
+     * @note Supported formats: PNG, JPEG, BMP, TGA (+ WebP with libwebp)
      * @note The format is determined by the file extension
-     * @see Image::saveImage() for underlying saving implementation
+     * @note An existing file is replaced atomically and survives a failed save.
+     *       Safe to call on a worker thread with a copy of the edited image.
+     * @see ImageCodecs::save() for underlying saving implementation
      * 
      * @example
      * @code
@@ -133,13 +138,52 @@ public:
      * }
      * @endcode
      */
-    static void saveToFile(const Image& image, const QString& path)
+    static void saveToFile(const Image& image, const QString& path,
+                           const ImageEncodeOptions& options = ImageEncodeOptions())
     {
         if (path.isEmpty()) {
             throw std::invalid_argument("Empty file path");
         }
-        Image copy = image; // saveImage is non-const in current API
-        copy.saveImage(path.toStdString());
+        ImageCodecs::save(image, path.toStdString(), options);
+    }
+
+    /**
+     * @brief True if files with this suffix ("png", any case) can be loaded and saved.
+     */
+    static bool isSupportedSuffix(const QString& suffix)
+    {
+        return ImageCodecs::isSupported(suffix.toStdString());
+    }
+
+    /**
+     * @brief File dialog filter for opening images in any built-in format.
+     *
+     * @return e.g. "Image Files (*.png *.jpg *.jpeg *.bmp *.tga);;All Files (*)"
+     */
+    static QString openDialogFilter()
+    {
+        std::string patterns;
+        for (const std::string& ext : ImageCodecs::extensions()) {
+            patterns += (patterns.empty() ? "*" : " *") + ext;
+        }
+        return QString::fromStdString("Image Files (" + patterns + ");;All Files (*)");
+    }
+
+    /**
+     * @brief File dialog filter for saving, one entry per built-in format.
+     *
+     * @return e.g. "PNG Files (*.png);;JPEG Files (*.jpg);;...;;All Files (*)"
+     */
+    static QString saveDialogFilter()
+    {
+        std::string filter;
+        for (const std::string& ext : ImageCodecs::extensions()) {
+            if (ext == ".jpeg") continue; // listed once, as .jpg
+            std::string label = ext == ".jpg" ? "JPEG" : ext.substr(1);
+            for (char& ch : label) ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+            filter += label + " Files (*" + ext + ");;";
+        }
+        return QString::fromStdString(filter + "All Files (*)");
     }
 };
 
@@ -0,0 +1,392 @@
+/**
+ * @file ImageLoader.cpp
+ * @brief Implementation of the background image loader and its caches.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "ImageLoader.h"
+#include "ImageCodecs.h"
+#include "../image/ImagePyramid.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const char* levelSuffix(ImageLoader::Level level)
+{
+    switch (level) {
+    case ImageLoader::Level::Thumbnail: return "-t";
+    case ImageLoader::Level::Preview: return "-p";
+    case ImageLoader::Level::Full: break;
+    }
+    return "-f";
+}
+
+/**
+ * @brief Absolute, normalised form of @p path, so "./a.png" and "a.png" match.
+ */
+fs::path normalizedPath(const std::string& path, std::error_code& error)
+{
+    return fs::absolute(fs::path(path), error).lexically_normal();
+}
+
+/**
+ * @brief @p full fitted into the box, resampled from the nearest level of @p pyramid.
+ */
+Image fitInto(ImagePyramid& pyramid, const Image& full, int boxWidth, int boxHeight)
+{
+    const double scale = std::min({1.0, static_cast<double>(boxWidth) / full.width,
+                                   static_cast<double>(boxHeight) / full.height});
+    return pyramid.scaled(std::max(1, static_cast<int>(full.width * scale)),
+                          std::max(1, static_cast<int>(full.height * scale)));
+}
+
+std::uint64_t fnv1a(const std::string& text)
+{
+    std::uint64_t hash = 1469598103934665603ull;
+    for (unsigned char ch : text) {
+        hash ^= ch;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+ImageLoader::ImageLoader(Callback onLoaded, const ImageLoaderOptions& options)
+    : onLoaded(std::move(onLoaded)), options(options)
+{
+    if (!this->options.cacheDir.empty()) {
+        std::error_code ignored;
+        fs::create_directories(this->options.cacheDir, ignored);
+    }
+    const int count = std::max(1, this->options.threads);
+    for (int i = 0; i < count; ++i) {
+        workers.emplace_back([this, i]() {
+            if (i == 0) pruneDisk();
+            workerLoop();
+        });
+    }
+}
+
+ImageLoader::~ImageLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+        queue.clear();
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+}
+
+void ImageLoader::open(const std::string& path, Level level)
+{
+    // Memory hits are delivered at once: the workers may all be busy prefetching
+    const std::string key = cacheKey(path, level);
+    Image cached;
+    const bool hit = !key.empty() && findInMemory(key, cached);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.clear(); // whatever was queued for the previous image is no longer wanted
+        if (!hit) queue.push_back({path, level, false, false});
+        if (options.prefetchRadius > 0) queue.push_back({path, Level::Preview, true, true});
+    }
+    wake.notify_all();
+    if (hit) onLoaded({path, level, cached, std::string(), false});
+}
+
+void ImageLoader::prefetch(const std::vector<std::string>& paths, Level level)
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        for (const std::string& path : paths) queue.push_back({path, level, true, false});
+    }
+    wake.notify_all();
+}
+
+std::vector<std::string> ImageLoader::siblings(const std::string& path)
+{
+    std::error_code error;
+    const fs::path dir = normalizedPath(path, error).parent_path();
+    const auto modified = static_cast<std::int64_t>(fs::last_write_time(dir, error).time_since_epoch().count());
+    if (error) return {};
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        const auto it = listings.find(dir.string());
+        if (it != listings.end() && it->second.modified == modified) return it->second.files;
+    }
+
+    std::vector<std::string> files;
+    for (const fs::directory_entry& entry : fs::directory_iterator(dir, error)) {
+        if (entry.is_regular_file(error) && ImageCodecs::isSupported(entry.path().extension().string())) {
+            files.push_back(entry.path().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    listings[dir.string()] = {modified, files};
+    return files;
+}
+
+std::string ImageLoader::neighbour(const std::string& path, int offset)
+{
+    const std::vector<std::string> files = siblings(path);
+    std::error_code error;
+    const auto it = std::find(files.begin(), files.end(), normalizedPath(path, error).string());
+    if (it == files.end()) return std::string();
+    const auto index = static_cast<long long>(it - files.begin()) + offset;
+    if (index < 0 || index >= static_cast<long long>(files.size())) return std::string();
+    return files[static_cast<std::size_t>(index)];
+}
+
+std::size_t ImageLoader::memoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return memoryBytes;
+}
+
+void ImageLoader::workerLoop()
+{
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            wake.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (stopping) return;
+            task = std::move(queue.front());
+            queue.pop_front();
+        }
+        if (task.neighbours) {
+            queueNeighbours(task.path);
+        } else {
+            run(task);
+        }
+    }
+}
+
+void ImageLoader::run(const Task& task)
+{
+    Result result;
+    result.path = task.path;
+    result.level = task.level;
+    result.prefetched = task.prefetched;
+    try {
+        if (task.level == Level::Full) {
+            // Show the cached preview while the full image decodes
+            const std::string previewKey = cacheKey(task.path, Level::Preview);
+            Image preview;
+            const bool hasPreview = !previewKey.empty()
+                                    && (findInMemory(previewKey, preview) || findOnDisk(previewKey, preview));
+            if (hasPreview && !task.prefetched) {
+                onLoaded({task.path, Level::Preview, preview, std::string(), false});
+            }
+
+            const std::string key = cacheKey(task.path, Level::Full);
+            if (key.empty() || !findInMemory(key, result.image)) {
+                result.image = ImageCodecs::load(task.path);
+                if (!key.empty()) storeInMemory(key, result.image);
+            }
+            onLoaded(result);
+            if (!hasPreview) cacheReductions(task.path, result.image);
+            return;
+        }
+        result.image = reduced(task.path, task.level);
+    } catch (const std::exception& e) {
+        result.image = Image();
+        result.error = e.what();
+    }
+    onLoaded(std::move(result));
+}
+
+void ImageLoader::queueNeighbours(const std::string& path)
+{
+    std::vector<std::string> order;
+    for (int step = 1; step <= options.prefetchRadius; ++step) {
+        // Forward first: browsing mostly moves to the next image
+        for (int offset : {step, -step}) {
+            std::string file = neighbour(path, offset);
+            if (!file.empty()) order.push_back(std::move(file));
+        }
+    }
+    std::vector<std::string> missing;
+    for (const std::string& file : order) {
+        const std::string key = cacheKey(file, Level::Preview);
+        Image unused;
+        if (!key.empty() && !findInMemory(key, unused)) missing.push_back(file);
+    }
+    prefetch(missing, Level::Preview);
+}
+
+Image ImageLoader::reduced(const std::string& path, Level level)
+{
+    const std::string key = cacheKey(path, level);
+    if (key.empty()) throw std::invalid_argument("Invalid filename, File Does not Exist");
+    {
+        // A prefetch of the same file may be decoding it right now; its result is about to be cached
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        decodeFinished.wait(lock, [&]() { return decoding.count(key) == 0; });
+        decoding.insert(key);
+    }
+    struct DoneDecoding {
+        ImageLoader* loader;
+        const std::string& key;
+        ~DoneDecoding()
+        {
+            {
+                std::lock_guard<std::mutex> lock(loader->cacheMutex);
+                loader->decoding.erase(key);
+            }
+            loader->decodeFinished.notify_all();
+        }
+    } done{this, key};
+
+    Image image;
+    if (findInMemory(key, image)) return image;
+    if (findOnDisk(key, image)) {
+        storeInMemory(key, image);
+        return image;
+    }
+
+    // Decode as small as the codec allows (JPEG scales in the DCT), then reduce the rest. Both sides
+    // at least the shorter side of the box keeps the fitted preview sharp for any aspect ratio.
+    const int shortSide = std::min(options.previewWidth, options.previewHeight);
+    const Image decoded = ImageCodecs::load(path, {shortSide, shortSide});
+    cacheReductions(path, decoded);
+    if (findInMemory(key, image)) return image;
+    return decoded; // memory cache too small to hold it
+}
+
+std::string ImageLoader::cacheKey(const std::string& path, Level level)
+{
+    std::error_code error;
+    const fs::path absolute = normalizedPath(path, error);
+    const auto modified = fs::last_write_time(absolute, error).time_since_epoch().count();
+    if (error) return std::string();
+    const auto size = fs::file_size(absolute, error);
+    if (error) return std::string();
+
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx",
+                  static_cast<unsigned long long>(fnv1a(absolute.string() + '\n' + std::to_string(modified) + '\n'
+                                                        + std::to_string(size))));
+    return hex + std::string(levelSuffix(level));
+}
+
+bool ImageLoader::findInMemory(const std::string& key, Image& found)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    const auto it = memory.find(key);
+    if (it == memory.end()) return false;
+    recent.splice(recent.begin(), recent, it->second.lru);
+    found = it->second.image; // shares the pixels
+    return true;
+}
+
+void ImageLoader::storeInMemory(const std::string& key, const Image& image)
+{
+    if (image.byteSize() > options.memoryBytes) return;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    const auto it = memory.find(key);
+    if (it != memory.end()) {
+        memoryBytes -= it->second.image.byteSize();
+        recent.erase(it->second.lru);
+        memory.erase(it);
+    }
+    while (!recent.empty() && memoryBytes + image.byteSize() > options.memoryBytes) {
+        const auto oldest = memory.find(recent.back());
+        memoryBytes -= oldest->second.image.byteSize();
+        memory.erase(oldest);
+        recent.pop_back();
+    }
+    recent.push_front(key);
+    memory[key] = {image, recent.begin()};
+    memoryBytes += image.byteSize();
+}
+
+bool ImageLoader::findOnDisk(const std::string& key, Image& found)
+{
+    if (options.cacheDir.empty()) return false;
+    const fs::path file = fs::path(options.cacheDir) / (key + ".jpg");
+    std::error_code error;
+    if (!fs::is_regular_file(file, error)) return false;
+    try {
+        found = ImageCodecs::load(file.string());
+    } catch (const std::exception&) {
+        fs::remove(file, error); // damaged entry: decode the original again
+        return false;
+    }
+    fs::last_write_time(file, fs::file_time_type::clock::now(), error); // recently used, pruned last
+    return true;
+}
+
+void ImageLoader::storeOnDisk(const std::string& key, const Image& image)
+{
+    if (options.cacheDir.empty()) return;
+    const fs::path file = fs::path(options.cacheDir) / (key + ".jpg");
+    try {
+        // Replaced atomically, so a concurrent reader never sees half a file
+        ImageEncodeOptions encode;
+        encode.quality = 85;
+        ImageCodecs::save(image, file.string(), encode);
+    } catch (const std::exception&) {
+        // A read-only or full cache directory only costs speed
+    }
+}
+
+void ImageLoader::cacheReductions(const std::string& path, const Image& full)
+{
+    ImagePyramid pyramid;
+    pyramid.sync(full);
+    const Image preview = fitInto(pyramid, full, options.previewWidth, options.previewHeight);
+    const Image thumbnail = fitInto(pyramid, full, options.thumbnailSize, options.thumbnailSize);
+    for (const auto& [level, image] : {std::pair<Level, const Image*>{Level::Preview, &preview},
+                                       std::pair<Level, const Image*>{Level::Thumbnail, &thumbnail}}) {
+        const std::string key = cacheKey(path, level);
+        if (key.empty()) continue;
+        storeInMemory(key, *image);
+        storeOnDisk(key, *image);
+    }
+}
+
+void ImageLoader::pruneDisk()
+{
+    if (options.cacheDir.empty()) return;
+    struct CachedFile {
+        fs::path path;
+        fs::file_time_type used;
+        std::uintmax_t size;
+    };
+    std::vector<CachedFile> files;
+    std::uintmax_t total = 0;
+    std::error_code error;
+    for (const fs::directory_entry& entry : fs::directory_iterator(options.cacheDir, error)) {
+        if (!entry.is_regular_file(error)) continue;
+        const CachedFile file{entry.path(), entry.last_write_time(error), entry.file_size(error)};
+        files.push_back(file);
+        total += file.size;
+    }
+    if (total <= options.diskBytes) return;
+    std::sort(files.begin(), files.end(), [](const CachedFile& a, const CachedFile& b) { return a.used < b.used; });
+    for (const CachedFile& file : files) {
+        if (total <= options.diskBytes) break;
+        if (fs::remove(file.path, error)) total -= file.size;
+    }
+}
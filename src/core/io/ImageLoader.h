@@ -0,0 +1,228 @@
+/**
+ * @file ImageLoader.h
+ * @brief Background image loading with neighbour prefetch and a persistent preview cache.
+ *
+ * This file declares the ImageLoader class, which decodes images on its own
+ * worker threads so the GUI never blocks on a file. Browsing a directory only
+ * needs screen-sized previews; those are kept in memory and on disk, so a
+ * picture seen once comes back without decoding it again.
+ *
+ * @details Every image is available at three levels:
+ * - Thumbnail: for file browsers, fitted into options.thumbnailSize
+ * - Preview: for display, fitted into previewWidth x previewHeight
+ *   (area-averaged from the nearest ImagePyramid level)
+ * - Full: the decoded file, only produced when asked for
+ *
+ * Thumbnails and previews are stored as JPEG files in options.cacheDir, keyed
+ * by the file's absolute path, modification time and size, so editing or
+ * replacing a file invalidates its entries. Recent results of every level are
+ * also kept in memory (options.memoryBytes, least recently used first out).
+ *
+ * After each open() the images next to it in its directory are prefetched at
+ * preview level, nearest first, so stepping through a folder finds them ready.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef IMAGELOADER_H
+#define IMAGELOADER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../image/Image_Class.h"
+
+/**
+ * @brief Sizes and limits for an ImageLoader.
+ */
+struct ImageLoaderOptions {
+    int previewWidth = 1920;            ///< Box previews are shown in, usually the screen
+    int previewHeight = 1080;
+    int thumbnailSize = 256;            ///< Square box thumbnails are shown in
+    int prefetchRadius = 2;             ///< Neighbours on each side prefetched after open()
+    int threads = 2;                    ///< Decoding threads
+    std::size_t memoryBytes = std::size_t(384) << 20; ///< In-memory cache limit (all levels)
+    std::size_t diskBytes = std::size_t(512) << 20;   ///< On-disk cache limit, enforced at start-up
+    std::string cacheDir;               ///< Directory for cached previews; empty = memory only
+};
+
+/**
+ * @class ImageLoader
+ * @brief Decodes images on background threads and caches their previews.
+ *
+ * @code
+ * ImageLoader loader([](ImageLoader::Result result) {
+ *     // Runs on a loader thread: hand the result to the GUI thread
+ * }, options);
+ * loader.open("photos/IMG_0042.jpg", ImageLoader::Level::Preview); // browsing
+ * loader.open("photos/IMG_0042.jpg", ImageLoader::Level::Full);    // editing
+ * @endcode
+ *
+ * @note A call to open() drops every request still queued from earlier calls,
+ *       so only the latest image and its neighbours are worked on. Decodes
+ *       already running finish and are delivered; callers compare
+ *       Result::path with the image they are waiting for.
+ */
+class ImageLoader {
+public:
+    /**
+     * @brief Resolution of a delivered image.
+     */
+    enum class Level { Thumbnail, Preview, Full };
+
+    /**
+     * @brief One finished request.
+     */
+    struct Result {
+        std::string path;  ///< File as passed to open() or prefetch()
+        Level level = Level::Full; ///< Level of @ref image
+        Image image;               ///< Decoded pixels; empty when @ref error is set
+        std::string error;         ///< Why the file could not be read, or empty
+        bool prefetched = false;   ///< True for neighbours loaded ahead of time
+    };
+
+    /// Receives every result, on one of the loader's threads (or inside open() for memory-cache hits).
+    using Callback = std::function<void(Result)>;
+
+    /**
+     * @param onLoaded Called once per finished request
+     * @param options Preview sizes, cache limits and the cache directory
+     */
+    explicit ImageLoader(Callback onLoaded, const ImageLoaderOptions& options = ImageLoaderOptions());
+
+    /**
+     * @brief Stops the threads; queued requests are dropped, running decodes finish first.
+     */
+    ~ImageLoader();
+
+    ImageLoader(const ImageLoader&) = delete;
+    ImageLoader& operator=(const ImageLoader&) = delete;
+
+    /**
+     * @brief Loads @p path at @p level, then prefetches its neighbours' previews.
+     *
+     * A Full request also delivers the cached preview first when there is
+     * one, so something can be shown while the full decode runs.
+     */
+    void open(const std::string& path, Level level);
+
+    /**
+     * @brief Queues @p paths at @p level behind the current requests.
+     */
+    void prefetch(const std::vector<std::string>& paths, Level level);
+
+    /**
+     * @brief The supported images in the directory of @p path, sorted by name.
+     *
+     * Paths are absolute and normalised.
+     * Listings are cached until the directory's modification time changes.
+     */
+    std::vector<std::string> siblings(const std::string& path);
+
+    /**
+     * @brief The image @p offset places from @p path among its siblings(), or empty if there is none.
+     */
+    std::string neighbour(const std::string& path, int offset);
+
+    /**
+     * @brief Bytes held by the in-memory cache.
+     */
+    std::size_t memoryUsage() const;
+
+private:
+    /**
+     * @brief One queued request.
+     */
+    struct Task {
+        std::string path;
+        Level level = Level::Preview;
+        bool prefetched = false;
+        bool neighbours = false; ///< List the directory and queue the neighbours instead
+    };
+
+    /**
+     * @brief A cached image and where it sits in the LRU list.
+     */
+    struct Entry {
+        Image image;
+        std::list<std::string>::iterator lru;
+    };
+
+    /**
+     * @brief A directory listing and the directory time it was taken at.
+     */
+    struct Listing {
+        std::int64_t modified = 0;
+        std::vector<std::string> files;
+    };
+
+    void workerLoop();
+    void run(const Task& task);
+
+    /**
+     * @brief Queues previews of the images around @p path, nearest first.
+     */
+    void queueNeighbours(const std::string& path);
+
+    /**
+     * @brief Thumbnail or preview of @p path, from a cache or decoded (and then cached).
+     */
+    Image reduced(const std::string& path, Level level);
+
+    /**
+     * @brief Cache key for @p path at @p level: path, time and size hashed, or empty if missing.
+     */
+    static std::string cacheKey(const std::string& path, Level level);
+
+    bool findInMemory(const std::string& key, Image& found);
+    void storeInMemory(const std::string& key, const Image& image);
+    bool findOnDisk(const std::string& key, Image& found);
+    void storeOnDisk(const std::string& key, const Image& image);
+
+    /**
+     * @brief Makes the thumbnail and preview of @p full and caches both.
+     */
+    void cacheReductions(const std::string& path, const Image& full);
+
+    /**
+     * @brief Deletes the oldest files in the cache directory beyond options.diskBytes.
+     */
+    void pruneDisk();
+
+    Callback onLoaded;
+    ImageLoaderOptions options;
+
+    std::mutex queueMutex;                 ///< Guards queue and stopping
+    std::condition_variable wake;
+    std::deque<Task> queue;
+    bool stopping = false;
+
+    mutable std::mutex cacheMutex;         ///< Guards the fields below
+    std::unordered_map<std::string, Entry> memory;
+    std::list<std::string> recent;         ///< Keys, most recently used first
+    std::size_t memoryBytes = 0;
+    std::unordered_map<std::string, Listing> listings;
+    std::unordered_set<std::string> decoding; ///< Keys of thumbnails/previews being decoded
+    std::condition_variable decodeFinished;   ///< Signalled when a key leaves decoding
+
+    std::vector<std::thread> workers;
+};
+
+#endif // IMAGELOADER_H
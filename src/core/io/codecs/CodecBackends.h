@@ -0,0 +1,61 @@
+/**
+ * @file CodecBackends.h
+ * @brief Factories for the codec backends compiled into this build.
+ *
+ * Only used by ImageCodecs.cpp. Each optional backend is compiled, and its
+ * factory declared, only when CMake found its library and defined the
+ * matching PHOTOSMITH_HAVE_* macro.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef CODECBACKENDS_H
+#define CODECBACKENDS_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../ImageCodecs.h"
+
+/**
+ * @brief Reads a whole file into memory.
+ *
+ * @throws std::invalid_argument If the file cannot be opened or read
+ */
+std::vector<unsigned char> readCodecFile(const std::string& filename);
+
+/**
+ * @brief Writes @p size bytes to @p filename, replacing it.
+ *
+ * @throws std::runtime_error If the file cannot be written
+ */
+void writeCodecFile(const std::string& filename, const unsigned char* data, std::size_t size);
+
+/// PNG, JPEG, BMP and TGA through stb_image / stb_image_write (always available).
+std::unique_ptr<ImageCodec> makeStbCodec();
+
+#ifdef PHOTOSMITH_HAVE_JPEG_TURBO
+/// JPEG through the libjpeg API of libjpeg-turbo.
+std::unique_ptr<ImageCodec> makeJpegTurboCodec();
+#endif
+
+#ifdef PHOTOSMITH_HAVE_SPNG
+/// PNG through libspng.
+std::unique_ptr<ImageCodec> makeSpngCodec();
+#endif
+
+#ifdef PHOTOSMITH_HAVE_WEBP
+/// WebP through libwebp.
+std::unique_ptr<ImageCodec> makeWebpCodec();
+#endif
+
+#endif // CODECBACKENDS_H
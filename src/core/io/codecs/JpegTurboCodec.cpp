@@ -0,0 +1,167 @@
+/**
+ * @file JpegTurboCodec.cpp
+ * @brief JPEG codec backed by libjpeg-turbo.
+ *
+ * Uses the classic libjpeg API, which libjpeg-turbo implements with SIMD
+ * IDCT/colour conversion. The same source also builds against IJG libjpeg,
+ * just without the speed-up.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "CodecBackends.h"
+#include <csetjmp>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <jpeglib.h>
+
+namespace {
+
+/**
+ * @brief libjpeg error handler that jumps back instead of calling exit().
+ *
+ * libjpeg is C, so its errors cannot unwind as exceptions; error_exit
+ * longjmps to the caller, which cleans up and throws. Nothing with a
+ * destructor is created between setjmp() and the libjpeg calls.
+ */
+struct JpegErrors {
+    jpeg_error_mgr base;
+    std::jmp_buf jump;
+    char message[JMSG_LENGTH_MAX];
+};
+
+void onJpegError(j_common_ptr info)
+{
+    JpegErrors* errors = reinterpret_cast<JpegErrors*>(info->err);
+    (*info->err->format_message)(info, errors->message);
+    std::longjmp(errors->jump, 1);
+}
+
+void ignoreJpegMessage(j_common_ptr) {}
+
+class JpegTurboCodec : public ImageCodec {
+public:
+    std::string name() const override { return "libjpeg-turbo"; }
+
+    std::vector<std::string> extensions() const override { return {".jpg", ".jpeg"}; }
+
+    bool canDecode(const unsigned char* signature, std::size_t size) const override
+    {
+        return size >= 3 && signature[0] == 0xFF && signature[1] == 0xD8 && signature[2] == 0xFF;
+    }
+
+    Image decode(const std::string& filename, const ImageDecodeOptions& options) const override
+    {
+        const std::vector<unsigned char> data = readCodecFile(filename);
+        Image image;
+
+        jpeg_decompress_struct info;
+        JpegErrors errors;
+        info.err = jpeg_std_error(&errors.base);
+        errors.base.error_exit = onJpegError;
+        errors.base.output_message = ignoreJpegMessage; // corrupt-data warnings are not fatal
+        if (setjmp(errors.jump)) {
+            jpeg_destroy_decompress(&info);
+            throw std::invalid_argument("Cannot decode " + filename + ": " + errors.message);
+        }
+
+        jpeg_create_decompress(&info);
+        jpeg_mem_src(&info, data.data(), static_cast<unsigned long>(data.size()));
+        jpeg_read_header(&info, TRUE);
+        // Gray JPEGs decode to one channel when the caller takes it: a third of the memory and no expansion
+        const bool gray = info.jpeg_color_space == JCS_GRAYSCALE && options.formats.contains(PixelFormat::gray8());
+        info.out_color_space = gray ? JCS_GRAYSCALE : JCS_RGB;
+
+        // DCT-domain scaling: decoding at 1/2, 1/4 or 1/8 skips most of the IDCT work
+        if (options.minWidth > 0 || options.minHeight > 0) {
+            for (unsigned int denom : {8u, 4u, 2u}) {
+                const auto scaledWidth = static_cast<int>((info.image_width + denom - 1) / denom);
+                const auto scaledHeight = static_cast<int>((info.image_height + denom - 1) / denom);
+                if (scaledWidth >= options.minWidth && scaledHeight >= options.minHeight) {
+                    info.scale_num = 1;
+                    info.scale_denom = denom;
+                    info.dct_method = JDCT_IFAST; // previews trade exactness for speed
+                    break;
+                }
+            }
+        }
+
+        jpeg_start_decompress(&info);
+        try {
+            image = Image(static_cast<int>(info.output_width), static_cast<int>(info.output_height),
+                          gray ? PixelFormat::gray8() : PixelFormat::rgb8());
+        } catch (const std::bad_alloc&) {
+            jpeg_destroy_decompress(&info);
+            throw;
+        }
+        const ImageView view = image.view();
+        while (info.output_scanline < info.output_height) {
+            JSAMPROW row = view.row(static_cast<int>(info.output_scanline));
+            jpeg_read_scanlines(&info, &row, 1);
+        }
+        jpeg_finish_decompress(&info);
+        jpeg_destroy_decompress(&info);
+        return image;
+    }
+
+    PixelFormatSet encodeFormats() const override { return {PixelFormat::gray8(), PixelFormat::rgb8()}; }
+
+    void encode(const Image& image, const std::string& filename, const ImageEncodeOptions& options) const override
+    {
+        const ConstImageView view = image.constView();
+        unsigned char* buffer = nullptr;
+        unsigned long size = 0;
+
+        jpeg_compress_struct info;
+        JpegErrors errors;
+        info.err = jpeg_std_error(&errors.base);
+        errors.base.error_exit = onJpegError;
+        if (setjmp(errors.jump)) {
+            jpeg_destroy_compress(&info);
+            std::free(buffer);
+            throw std::runtime_error("Cannot encode " + filename + ": " + errors.message);
+        }
+
+        jpeg_create_compress(&info);
+        jpeg_mem_dest(&info, &buffer, &size);
+        info.image_width = static_cast<JDIMENSION>(view.width);
+        info.image_height = static_cast<JDIMENSION>(view.height);
+        info.input_components = view.channels;
+        info.in_color_space = view.channels == 1 ? JCS_GRAYSCALE : JCS_RGB;
+        jpeg_set_defaults(&info);
+        jpeg_set_quality(&info, options.quality, TRUE);
+        if (options.quality > 90) {
+            // Same as stb_image_write: full-resolution chroma above quality 90, 4:2:0 below
+            info.comp_info[0].h_samp_factor = 1;
+            info.comp_info[0].v_samp_factor = 1;
+        }
+
+        jpeg_start_compress(&info, TRUE);
+        while (info.next_scanline < info.image_height) {
+            JSAMPROW row = const_cast<JSAMPROW>(view.row(static_cast<int>(info.next_scanline)));
+            jpeg_write_scanlines(&info, &row, 1);
+        }
+        jpeg_finish_compress(&info);
+        jpeg_destroy_compress(&info);
+
+        std::unique_ptr<unsigned char, void (*)(void*)> owned(buffer, std::free);
+        writeCodecFile(filename, owned.get(), size);
+    }
+};
+
+} // namespace
+
+std::unique_ptr<ImageCodec> makeJpegTurboCodec()
+{
+    return std::make_unique<JpegTurboCodec>();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file SpngCodec.cpp
+ * @brief PNG codec backed by libspng.
+ *
+ * libspng decodes straight into the Image buffer and encodes with a
+ * selectable zlib level; its optimised inflate (or zlib-ng, when libspng is
+ * built against it) is much faster than stb's built-in deflate.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "CodecBackends.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <spng.h>
+
+namespace {
+
+using SpngContext = std::unique_ptr<spng_ctx, void (*)(spng_ctx*)>;
+
+class SpngCodec : public ImageCodec {
+public:
+    std::string name() const override { return "spng"; }
+
+    std::vector<std::string> extensions() const override { return {".png"}; }
+
+    bool canDecode(const unsigned char* signature, std::size_t size) const override
+    {
+        static const unsigned char png[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        return size >= sizeof(png) && std::memcmp(signature, png, sizeof(png)) == 0;
+    }
+
+    Image decode(const std::string& filename, const ImageDecodeOptions&) const override
+    {
+        const std::vector<unsigned char> data = readCodecFile(filename);
+        SpngContext ctx(spng_ctx_new(0), spng_ctx_free);
+        if (!ctx) throw std::bad_alloc();
+
+        spng_ihdr header;
+        std::size_t bytes = 0;
+        int error = spng_set_png_buffer(ctx.get(), data.data(), data.size());
+        if (!error) error = spng_get_ihdr(ctx.get(), &header);
+        if (!error) error = spng_decoded_image_size(ctx.get(), SPNG_FMT_RGB8, &bytes);
+        if (error) throw std::invalid_argument("Cannot decode " + filename + ": " + spng_strerror(error));
+
+        // RGB8 output expands palettes and grey, and drops alpha, like stb's STBI_rgb
+        Image image(static_cast<int>(header.width), static_cast<int>(header.height));
+        error = spng_decode_image(ctx.get(), image.view().row(0), bytes, SPNG_FMT_RGB8, 0);
+        if (error) throw std::invalid_argument("Cannot decode " + filename + ": " + spng_strerror(error));
+        return image;
+    }
+
+    void encode(const Image& image, const std::string& filename, const ImageEncodeOptions& options) const override
+    {
+        SpngContext ctx(spng_ctx_new(SPNG_CTX_ENCODER), spng_ctx_free);
+        if (!ctx) throw std::bad_alloc();
+
+        spng_ihdr header = {};
+        header.width = static_cast<std::uint32_t>(image.width);
+        header.height = static_cast<std::uint32_t>(image.height);
+        header.bit_depth = 8;
+        header.color_type = SPNG_COLOR_TYPE_TRUECOLOR;
+
+        int error = spng_set_option(ctx.get(), SPNG_ENCODE_TO_BUFFER, 1);
+        if (!error && options.pngLevel >= 0) error = spng_set_option(ctx.get(), SPNG_IMG_COMPRESSION_LEVEL, options.pngLevel);
+        if (!error) error = spng_set_ihdr(ctx.get(), &header);
+        if (!error) error = spng_encode_image(ctx.get(), image.constView().row(0), image.byteSize(), SPNG_FMT_PNG,
+                                              SPNG_ENCODE_FINALIZE);
+        if (error) throw std::runtime_error("Cannot encode " + filename + ": " + spng_strerror(error));
+
+        std::size_t size = 0;
+        std::unique_ptr<void, void (*)(void*)> png(spng_get_png_buffer(ctx.get(), &size, &error), std::free);
+        if (!png) throw std::runtime_error("Cannot encode " + filename + ": " + spng_strerror(error));
+        writeCodecFile(filename, static_cast<const unsigned char*>(png.get()), size);
+    }
+};
+
+} // namespace
+
+std::unique_ptr<ImageCodec> makeSpngCodec()
+{
+    return std::make_unique<SpngCodec>();
+}
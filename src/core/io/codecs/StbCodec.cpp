@@ -0,0 +1,105 @@
+/**
+ * @file StbCodec.cpp
+ * @brief Fallback codec backed by stb_image and stb_image_write.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "CodecBackends.h"
+#include <cctype>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+
+// Defined with the rest of stb_image_write in Image_Class.cpp
+extern "C" int stbi_write_png_compression_level;
+
+namespace {
+
+/// stb_image_write's own default zlib level
+constexpr int StbDefaultPngLevel = 8;
+
+class StbCodec : public ImageCodec {
+public:
+    std::string name() const override { return "stb"; }
+
+    std::vector<std::string> extensions() const override { return {".png", ".jpg", ".jpeg", ".bmp", ".tga"}; }
+
+    bool canDecode(const unsigned char*, std::size_t) const override
+    {
+        // stb_image identifies the format itself and reports anything it cannot read
+        return true;
+    }
+
+    Image decode(const std::string& filename, const ImageDecodeOptions& options) const override
+    {
+        Image image;
+        image.loadNewImage(filename, options.formats); // keeps stb's buffer, no copy
+        return image;
+    }
+
+    PixelFormatSet encodeFormats() const override
+    {
+        // stb_image_write takes any 8-bit channel count; JPEG ignores the alpha
+        return PixelFormatSet::interleaved8();
+    }
+
+    void encode(const Image& image, const std::string& filename, const ImageEncodeOptions& options) const override
+    {
+        const std::size_t dot = filename.rfind('.');
+        std::string ext = dot == std::string::npos ? std::string() : filename.substr(dot);
+        for (char& ch : ext) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+
+        const char* path = filename.c_str();
+        const int w = image.width;
+        const int h = image.height;
+        const int channels = image.channels;
+        const unsigned char* data = image.constView().row(0);
+        int written = 0;
+        if (ext == ".png") {
+            written = writePng(path, w, h, channels, data, options.pngLevel < 0 ? StbDefaultPngLevel : options.pngLevel);
+        } else if (ext == ".jpg" || ext == ".jpeg") {
+            written = stbi_write_jpg(path, w, h, channels, data, options.quality);
+        } else if (ext == ".bmp") {
+            written = stbi_write_bmp(path, w, h, channels, data);
+        } else if (ext == ".tga") {
+            written = stbi_write_tga(path, w, h, channels, data);
+        }
+        if (!written) throw std::runtime_error("Cannot write " + filename);
+    }
+
+private:
+    /**
+     * @brief stbi_write_png() with a zlib level.
+     *
+     * stb keeps the level in a global, so writers holding the shared lock all
+     * use the current level; changing it waits for them to finish.
+     */
+    static int writePng(const char* path, int w, int h, int channels, const unsigned char* data, int level)
+    {
+        static std::shared_mutex levelMutex;
+        std::shared_lock<std::shared_mutex> shared(levelMutex);
+        if (stbi_write_png_compression_level != level) {
+            shared.unlock();
+            std::unique_lock<std::shared_mutex> exclusive(levelMutex);
+            stbi_write_png_compression_level = level;
+            return stbi_write_png(path, w, h, channels, data, w * channels);
+        }
+        return stbi_write_png(path, w, h, channels, data, w * channels);
+    }
+};
+
+} // namespace
+
+std::unique_ptr<ImageCodec> makeStbCodec()
+{
+    return std::make_unique<StbCodec>();
+}
@@ -0,0 +1,99 @@
+/**
+ * @file WebpCodec.cpp
+ * @brief WebP codec backed by libwebp.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "CodecBackends.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <webp/decode.h>
+#include <webp/encode.h>
+
+namespace {
+
+/// Largest width or height a WebP file can hold.
+constexpr int WebpMaxDimension = 16383;
+
+class WebpCodec : public ImageCodec {
+public:
+    std::string name() const override { return "libwebp"; }
+
+    std::vector<std::string> extensions() const override { return {".webp"}; }
+
+    bool canDecode(const unsigned char* signature, std::size_t size) const override
+    {
+        return size >= 12 && std::memcmp(signature, "RIFF", 4) == 0 && std::memcmp(signature + 8, "WEBP", 4) == 0;
+    }
+
+    Image decode(const std::string& filename, const ImageDecodeOptions& options) const override
+    {
+        const std::vector<unsigned char> data = readCodecFile(filename);
+        WebPDecoderConfig config;
+        if (!WebPInitDecoderConfig(&config) || WebPGetFeatures(data.data(), data.size(), &config.input) != VP8_STATUS_OK) {
+            throw std::invalid_argument("Cannot decode " + filename + ": not a valid WebP file");
+        }
+        int width = config.input.width;
+        int height = config.input.height;
+
+        // libwebp scales while decoding, so previews never hold the full image
+        if (options.minWidth > 0 || options.minHeight > 0) {
+            const double scale = std::max(static_cast<double>(options.minWidth) / width,
+                                          static_cast<double>(options.minHeight) / height);
+            if (scale < 1.0) {
+                width = std::max(1, static_cast<int>(std::ceil(width * scale)));
+                height = std::max(1, static_cast<int>(std::ceil(height * scale)));
+                config.options.use_scaling = 1;
+                config.options.scaled_width = width;
+                config.options.scaled_height = height;
+            }
+        }
+
+        Image image(width, height);
+        config.output.colorspace = MODE_RGB;
+        config.output.is_external_memory = 1;
+        config.output.u.RGBA.rgba = image.view().row(0);
+        config.output.u.RGBA.stride = width * 3;
+        config.output.u.RGBA.size = image.byteSize();
+        const VP8StatusCode status = WebPDecode(data.data(), data.size(), &config);
+        WebPFreeDecBuffer(&config.output);
+        if (status != VP8_STATUS_OK) {
+            throw std::invalid_argument("Cannot decode " + filename + ": WebP error " + std::to_string(status));
+        }
+        return image;
+    }
+
+    void encode(const Image& image, const std::string& filename, const ImageEncodeOptions& options) const override
+    {
+        if (image.width > WebpMaxDimension || image.height > WebpMaxDimension) {
+            throw std::invalid_argument("Image too large for WebP (over 16383 pixels)");
+        }
+        const unsigned char* rgb = image.constView().row(0);
+        std::uint8_t* output = nullptr;
+        const std::size_t size = options.lossless
+            ? WebPEncodeLosslessRGB(rgb, image.width, image.height, image.width * 3, &output)
+            : WebPEncodeRGB(rgb, image.width, image.height, image.width * 3, static_cast<float>(options.quality), &output);
+        std::unique_ptr<std::uint8_t, void (*)(void*)> owned(output, WebPFree);
+        if (size == 0) throw std::runtime_error("Cannot encode " + filename + " as WebP");
+        writeCodecFile(filename, owned.get(), size);
+    }
+};
+
+} // namespace
+
+std::unique_ptr<ImageCodec> makeWebpCodec()
+{
+    return std::make_unique<WebpCodec>();
+}
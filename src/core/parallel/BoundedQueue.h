@@ -0,0 +1,126 @@
+/**
+ * @file BoundedQueue.h
+ * @brief Blocking FIFO queue with a fixed capacity, for pipelines of worker threads.
+ *
+ * This file declares the BoundedQueue class template, the hand-off between
+ * stages of a producer/consumer pipeline (for example decode -> filter ->
+ * encode in the batch tool). A full queue blocks its producers, so a fast
+ * stage cannot run ahead of a slow one and the number of images in flight, and
+ * therefore the memory used, stays bounded.
+ *
+ * @details The queue provides:
+ * - push() that blocks while the queue is full
+ * - pop() that blocks while the queue is empty and reports the end of input
+ * - close() to signal that no more items will be pushed
+ * - cancel() to unblock every thread at once and drop queued items
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief Thread-safe FIFO holding at most a fixed number of items.
+ *
+ * @tparam T Item type (moved in and out)
+ *
+ * @code
+ * BoundedQueue<Image> decoded(4);
+ * // Producer
+ * decoded.push(std::move(image));
+ * decoded.close();
+ * // Consumer
+ * while (std::optional<Image> image = decoded.pop()) process(*image);
+ * @endcode
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * @param capacity Maximum queued items (at least 1)
+     */
+    explicit BoundedQueue(std::size_t capacity) : capacity(std::max<std::size_t>(1, capacity)) {}
+
+    /**
+     * @brief Appends @p item, waiting while the queue is full.
+     *
+     * @return False if the queue was closed or cancelled (the item is dropped)
+     */
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this]() { return items.size() < capacity || closed; });
+        if (closed) return false;
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest item, waiting while the queue is empty.
+     *
+     * @return The item, or std::nullopt once the queue is closed and drained
+     *         (or cancelled)
+     */
+    std::optional<T> pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this]() { return !items.empty() || closed; });
+        if (items.empty()) return std::nullopt;
+        std::optional<T> item(std::move(items.front()));
+        items.pop_front();
+        notFull.notify_one();
+        return item;
+    }
+
+    /**
+     * @brief Ends the input: consumers drain the queued items, then pop() ends.
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+    /**
+     * @brief Closes the queue and drops every queued item.
+     */
+    void cancel()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        items.clear();
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+private:
+    const std::size_t capacity;         ///< Maximum queued items
+    std::mutex mutex;                   ///< Guards the fields below
+    std::condition_variable notFull;    ///< Signals producers: space available or closed
+    std::condition_variable notEmpty;   ///< Signals consumers: item available or closed
+    std::deque<T> items;                ///< Queued items, oldest first
+    bool closed = false;                ///< No more pushes accepted
+};
+
+#endif // BOUNDEDQUEUE_H
@@ -0,0 +1,161 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the row-band worker pool.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace {
+// Set while a thread executes a band, so nested parallelRows() calls run serially
+thread_local bool insideBand = false;
+}
+
+ThreadPool& ThreadPool::instance()
+{
+    // PHOTOSMITH_THREADS overrides the thread count (including the caller)
+    static ThreadPool pool([]() {
+        int threads = static_cast<int>(std::thread::hardware_concurrency());
+        if (const char* env = std::getenv("PHOTOSMITH_THREADS")) {
+            threads = std::atoi(env);
+        }
+        return std::max(0, threads - 1);
+    }());
+    return pool;
+}
+
+ThreadPool::ThreadPool(int workerCount)
+{
+    for (int i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        shuttingDown = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop()
+{
+    unsigned seenGeneration = 0;
+    for (;;) {
+        Job* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            wake.wait(lock, [&]() { return shuttingDown || (current && generation != seenGeneration); });
+            if (shuttingDown) return;
+            seenGeneration = generation;
+            job = current;
+            ++activeWorkers;
+        }
+        runBands(*job, nullptr);
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            --activeWorkers;
+        }
+        finished.notify_all();
+    }
+}
+
+void ThreadPool::runBands(Job& job, const ProgressFunction* progress)
+{
+    insideBand = true;
+    while (!job.stop.load(std::memory_order_relaxed)) {
+        if (job.cancelRequested && job.cancelRequested->load(std::memory_order_relaxed)) {
+            job.stop = true;
+            break;
+        }
+        const int begin = job.nextRow.fetch_add(job.grain, std::memory_order_relaxed);
+        if (begin >= job.height) break;
+        const int end = std::min(begin + job.grain, job.height);
+        try {
+            (*job.band)(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.errorMutex);
+            if (!job.error) job.error = std::current_exception();
+            job.stop = true;
+            break;
+        }
+        const int done = job.rowsDone.fetch_add(end - begin, std::memory_order_relaxed) + (end - begin);
+        if (progress) (*progress)(done, job.height);
+    }
+    insideBand = false;
+}
+
+bool ThreadPool::parallelRows(int height, const BandFunction& band,
+                              const std::atomic<bool>* cancelRequested,
+                              const ProgressFunction& progress,
+                              int grain)
+{
+    if (height <= 0) return true;
+    if (grain <= 0) {
+        // Several bands per thread keeps the load balanced when rows differ in cost
+        grain = std::max(1, height / (concurrency() * 8));
+    }
+
+    // Serial path: no workers, nested call, or too little work to split
+    if (workers.empty() || insideBand || height <= grain) {
+        for (int begin = 0; begin < height; begin += grain) {
+            if (cancelRequested && cancelRequested->load()) return false;
+            const int end = std::min(begin + grain, height);
+            band(begin, end);
+            if (progress) progress(end, height);
+        }
+        return true;
+    }
+
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    Job job;
+    job.band = &band;
+    job.cancelRequested = cancelRequested;
+    job.height = height;
+    job.grain = grain;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        current = &job;
+        ++generation;
+    }
+    wake.notify_all();
+
+    // The calling thread works too, reporting progress between its own bands
+    runBands(job, progress ? &progress : nullptr);
+
+    // No bands are left to claim; wait for workers still inside one
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        current = nullptr;
+        while (activeWorkers > 0) {
+            finished.wait_for(lock, std::chrono::milliseconds(20));
+            if (progress && activeWorkers > 0) {
+                lock.unlock();
+                progress(job.rowsDone.load(std::memory_order_relaxed), height);
+                lock.lock();
+            }
+        }
+    }
+
+    if (job.error) std::rethrow_exception(job.error);
+    const int done = job.rowsDone.load();
+    if (progress) progress(done, height);
+    return done == height;
+}
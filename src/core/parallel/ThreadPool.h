@@ -0,0 +1,148 @@
+/**
+ * @file ThreadPool.h
+ * @brief Shared worker pool that runs image kernels over row bands on all cores.
+ *
+ * This file declares the ThreadPool class, the parallel execution layer used by
+ * ImageFilters and BlurEngine. Work is split into bands of whole rows; workers
+ * (and the calling thread) claim bands from a shared atomic counter, so faster
+ * threads automatically take more bands and the load balances itself.
+ *
+ * @details The pool provides:
+ * - Persistent worker threads sized to std::thread::hardware_concurrency()
+ *   (overridable through the PHOTOSMITH_THREADS environment variable)
+ * - Dynamic (self-balancing) band scheduling through an atomic cursor
+ * - Cooperative cancellation checked by every worker between bands
+ * - Progress reported on the calling thread only, so callers may touch Qt widgets
+ * - Exceptions thrown by a band are re-thrown on the calling thread
+ *
+ * @note Bands only ever write their own rows. Neighbourhood kernels read their
+ *       halo rows from an unmodified source image, so no halo copies are needed.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Process-wide pool executing row-band jobs.
+ *
+ * @code
+ * bool completed = ThreadPool::instance().parallelRows(img.height,
+ *     [&](int rowBegin, int rowEnd) {
+ *         for (int y = rowBegin; y < rowEnd; ++y) processRow(y);
+ *     },
+ *     &cancelRequested,
+ *     [&](int done, int total) { updateProgress(done, total); });
+ * @endcode
+ *
+ * @note One job runs at a time; concurrent callers queue on an internal mutex.
+ *       A parallelRows() call made from inside a band runs serially.
+ */
+class ThreadPool {
+public:
+    /// Processes rows [rowBegin, rowEnd).
+    using BandFunction = std::function<void(int rowBegin, int rowEnd)>;
+    /// Receives rows finished so far; always invoked on the calling thread.
+    using ProgressFunction = std::function<void(int rowsDone, int totalRows)>;
+
+    /**
+     * @brief Returns the shared pool, creating it on first use.
+     */
+    static ThreadPool& instance();
+
+    /**
+     * @brief Creates a pool with @p workerCount background threads.
+     *
+     * @param workerCount Background threads (the caller also runs bands);
+     *        0 makes every job run on the calling thread.
+     */
+    explicit ThreadPool(int workerCount);
+
+    /**
+     * @brief Stops and joins all workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Number of threads that execute bands, including the caller.
+     */
+    int concurrency() const { return static_cast<int>(workers.size()) + 1; }
+
+    /**
+     * @brief Runs @p band over all rows in [0, height) across the pool.
+     *
+     * @param height Number of rows to process
+     * @param band Function processing one band of rows; must only write its own rows
+     * @param cancelRequested Optional flag; when set, no further bands start
+     * @param progress Optional progress callback, invoked on the calling thread
+     * @param grain Rows per band (0 picks a size giving several bands per thread)
+     * @return true if every row was processed, false if cancelled
+     *
+     * @throws Any exception thrown by @p band (the first one, after all workers stop)
+     */
+    bool parallelRows(int height, const BandFunction& band,
+                      const std::atomic<bool>* cancelRequested = nullptr,
+                      const ProgressFunction& progress = {},
+                      int grain = 0);
+
+private:
+    /**
+     * @brief State of the job currently being executed.
+     */
+    struct Job {
+        const BandFunction* band = nullptr;
+        const std::atomic<bool>* cancelRequested = nullptr;
+        int height = 0;
+        int grain = 1;
+        std::atomic<int> nextRow{0};
+        std::atomic<int> rowsDone{0};
+        std::atomic<bool> stop{false};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+    };
+
+    /**
+     * @brief Worker thread body: waits for jobs and runs their bands.
+     */
+    void workerLoop();
+
+    /**
+     * @brief Claims and runs bands of @p job until none are left or it stops.
+     *
+     * @param progress Non-null only on the calling thread.
+     */
+    void runBands(Job& job, const ProgressFunction* progress);
+
+    std::vector<std::thread> workers;
+    std::mutex submitMutex;           ///< Serialises parallelRows() callers.
+    std::mutex stateMutex;            ///< Guards the fields below.
+    std::condition_variable wake;     ///< Signals workers: new job or shutdown.
+    std::condition_variable finished; ///< Signals the caller: a worker left the job.
+    Job* current = nullptr;
+    unsigned generation = 0;
+    int activeWorkers = 0;
+    bool shuttingDown = false;
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,970 @@
+/**
+ * @file PointKernels.cpp
+ * @brief Scalar, SSE4.1, AVX2 and NEON implementations of the RGB24 point kernels.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "PointKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PHOTOSMITH_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define PHOTOSMITH_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+// GCC and Clang need per-function target attributes to emit wider instructions
+// than the build baseline; MSVC accepts the intrinsics anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define PHOTOSMITH_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PHOTOSMITH_TARGET(isa)
+#endif
+
+namespace {
+
+constexpr int kFixedShift = 14;        // ChannelMap fixed point: Q14
+constexpr std::uint16_t kThird = 21846; // mulhi(s, kThird) == s / 3 for s <= 765
+constexpr int kLumaR = 77;              // Rec. 601 weights in 1/256; the sum fits 16-bit lanes
+constexpr int kLumaG = 150;
+constexpr int kLumaB = 29;
+
+// ===================== Scalar reference =====================
+
+void mapChannelsScalar(const unsigned char* src, unsigned char* dst, int width, const PointKernels::ChannelMap& map)
+{
+    for (int x = 0; x < width; ++x, src += 3, dst += 3) {
+        dst[0] = map.lut[0][src[0]];
+        dst[1] = map.lut[1][src[1]];
+        dst[2] = map.lut[2][src[2]];
+    }
+}
+
+void grayscaleScalar(unsigned char* p, int width)
+{
+    for (int x = 0; x < width; ++x, p += 3) {
+        const unsigned char gray = static_cast<unsigned char>((p[0] + p[1] + p[2]) / 3);
+        p[0] = gray;
+        p[1] = gray;
+        p[2] = gray;
+    }
+}
+
+void thresholdScalar(unsigned char* p, int width, int level)
+{
+    for (int x = 0; x < width; ++x, p += 3) {
+        const unsigned char bw = ((p[0] + p[1] + p[2]) / 3 > level) ? 255 : 0;
+        p[0] = bw;
+        p[1] = bw;
+        p[2] = bw;
+    }
+}
+
+void infraredScalar(unsigned char* p, int width)
+{
+    for (int x = 0; x < width; ++x, p += 3) {
+        // 255 - sum / 3, truncated: the integer form of the original float expression
+        const unsigned char inverted = static_cast<unsigned char>((765 - (p[0] + p[1] + p[2])) / 3);
+        p[0] = 255;
+        p[1] = inverted;
+        p[2] = inverted;
+    }
+}
+
+void invertScalar(unsigned char* p, std::size_t bytes)
+{
+    for (std::size_t i = 0; i < bytes; ++i) {
+        p[i] = static_cast<unsigned char>(255 - p[i]);
+    }
+}
+
+/// round(x / 255) for 0 <= x <= 65025, with only adds and shifts (exact in 16-bit lanes)
+inline int divide255(int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+inline int blendMix(PointKernels::BlendMode mode, int a, int b)
+{
+    switch (mode) {
+    case PointKernels::BlendMode::Multiply: return divide255(a * b);
+    case PointKernels::BlendMode::Screen:   return a + b - divide255(a * b); // == 255 - (255 - a)(255 - b) / 255
+    case PointKernels::BlendMode::Overlay:
+        return a < 128 ? divide255(2 * a * b) : 255 - divide255(2 * (255 - a) * (255 - b));
+    default:                                return b;
+    }
+}
+
+void blendScalar(const unsigned char* overlay, unsigned char* base, std::size_t bytes, PointKernels::BlendMode mode,
+                 int opacity)
+{
+    for (std::size_t i = 0; i < bytes; ++i) {
+        const int a = base[i];
+        base[i] = static_cast<unsigned char>(divide255(a * (255 - opacity) + blendMix(mode, a, overlay[i]) * opacity));
+    }
+}
+
+void lumaScalar(const unsigned char* p, unsigned char* out, int width)
+{
+    for (int x = 0; x < width; ++x, p += 3) {
+        out[x] = static_cast<unsigned char>((kLumaR * p[0] + kLumaG * p[1] + kLumaB * p[2] + 128) >> 8);
+    }
+}
+
+void spreadGrayScalar(const unsigned char* gray, unsigned char* p, int width)
+{
+    for (int x = 0; x < width; ++x, p += 3) {
+        p[0] = gray[x];
+        p[1] = gray[x];
+        p[2] = gray[x];
+    }
+}
+
+/**
+ * Finds scale/offset with min(255, (x * scale + offset) >> 14) == lut[x] for
+ * every x, or returns false. For a fixed scale each x bounds the offset from
+ * both sides, so checking a candidate scale is a single interval intersection.
+ */
+bool fitFixedPoint(const unsigned char* lut, std::uint16_t& scale, std::uint32_t& offset)
+{
+    for (int x = 1; x < 256; ++x) {
+        if (lut[x] < lut[x - 1]) return false; // only non-decreasing maps are affine here
+    }
+    const std::int64_t one = std::int64_t(1) << kFixedShift;
+
+    // Slope estimate from the unsaturated range bounds the scales worth trying
+    int last = 255;
+    while (last > 0 && lut[last] == 255) --last;
+    const double slope = last > 0 ? double(lut[last] - lut[0]) / last : 0.0;
+    const int center = static_cast<int>(std::lround(slope * one));
+    const int reach = last > 0 ? static_cast<int>(2 * one / last) + 2 : 2;
+
+    for (int step = 0; step <= reach; ++step) {
+        for (int sign : {1, -1}) {
+            if (step == 0 && sign < 0) continue;
+            const int candidate = center + sign * step;
+            if (candidate < 0 || candidate > 0xFFFF) continue;
+            std::int64_t low = 0, high = std::int64_t(256) * one;
+            for (int x = 0; x < 256 && low <= high; ++x) {
+                const std::int64_t product = std::int64_t(x) * candidate;
+                low = std::max(low, lut[x] * one - product);
+                if (lut[x] < 255) high = std::min(high, (lut[x] + 1) * one - 1 - product);
+            }
+            if (low <= high) {
+                scale = static_cast<std::uint16_t>(candidate);
+                offset = static_cast<std::uint32_t>(low);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+#if defined(PHOTOSMITH_SIMD_X86)
+
+// ===================== x86 shared tables =====================
+
+/**
+ * Byte shuffles for a block of 16 RGB pixels held in three 16-byte vectors:
+ * gather[c][v] pulls channel c of every pixel out of vector v (0x80 = zero),
+ * scatter[v] spreads 16 per-pixel bytes back to vector v's byte positions, and
+ * scatterGB/redMask do the same for green and blue only, with red forced to 255.
+ */
+struct ShuffleTables {
+    alignas(16) std::int8_t gather[3][3][16];
+    alignas(16) std::int8_t scatter[3][16];
+    alignas(16) std::int8_t scatterGB[3][16];
+    alignas(16) std::int8_t redMask[3][16];
+
+    ShuffleTables()
+    {
+        for (int c = 0; c < 3; ++c) {
+            for (int v = 0; v < 3; ++v) {
+                for (int p = 0; p < 16; ++p) {
+                    const int byte = 3 * p + c;
+                    gather[c][v][p] = (byte / 16 == v) ? static_cast<std::int8_t>(byte % 16) : std::int8_t(-128);
+                }
+            }
+        }
+        for (int v = 0; v < 3; ++v) {
+            for (int i = 0; i < 16; ++i) {
+                const int byte = 16 * v + i;
+                const bool red = byte % 3 == 0;
+                scatter[v][i] = static_cast<std::int8_t>(byte / 3);
+                scatterGB[v][i] = red ? std::int8_t(-128) : static_cast<std::int8_t>(byte / 3);
+                redMask[v][i] = red ? std::int8_t(-1) : std::int8_t(0);
+            }
+        }
+    }
+};
+
+const ShuffleTables& shuffleTables()
+{
+    static const ShuffleTables tables;
+    return tables;
+}
+
+/// Per-byte Q14 coefficients for one 48-byte period (16 pixels), in byte order.
+struct FixedPointPattern {
+    alignas(32) std::uint16_t scale[48];
+    alignas(32) std::uint32_t offset[48];
+
+    explicit FixedPointPattern(const PointKernels::ChannelMap& map)
+    {
+        for (int i = 0; i < 48; ++i) {
+            scale[i] = map.scale[i % 3];
+            offset[i] = map.offset[i % 3];
+        }
+    }
+};
+
+// ===================== SSE4.1 =====================
+
+/// Q14 multiply-add of 8 zero-extended bytes, returning 8 x int16 (unsaturated).
+PHOTOSMITH_TARGET("sse4.1")
+inline __m128i fixedPoint8(__m128i x, const std::uint16_t* scale, const std::uint32_t* offset)
+{
+    const __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(scale));
+    const __m128i lo = _mm_mullo_epi16(x, m);
+    const __m128i hi = _mm_mulhi_epu16(x, m);
+    __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+    __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+    p0 = _mm_add_epi32(p0, _mm_load_si128(reinterpret_cast<const __m128i*>(offset)));
+    p1 = _mm_add_epi32(p1, _mm_load_si128(reinterpret_cast<const __m128i*>(offset + 4)));
+    p0 = _mm_srli_epi32(p0, kFixedShift);
+    p1 = _mm_srli_epi32(p1, kFixedShift);
+    return _mm_packs_epi32(p0, p1);
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void mapChannelsSse41(const unsigned char* src, unsigned char* dst, int width, const PointKernels::ChannelMap& map)
+{
+    if (!map.fixedPoint) {
+        mapChannelsScalar(src, dst, width, map);
+        return;
+    }
+    const FixedPointPattern pattern(map);
+    const __m128i zero = _mm_setzero_si128();
+    const std::size_t bytes = static_cast<std::size_t>(width) * 3;
+    std::size_t i = 0;
+    for (; i + 48 <= bytes; i += 48) {
+        for (int v = 0; v < 3; ++v) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16 * v));
+            const __m128i lo = fixedPoint8(_mm_unpacklo_epi8(in, zero), pattern.scale + 16 * v, pattern.offset + 16 * v);
+            const __m128i hi = fixedPoint8(_mm_unpackhi_epi8(in, zero), pattern.scale + 16 * v + 8, pattern.offset + 16 * v + 8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 16 * v), _mm_packus_epi16(lo, hi));
+        }
+    }
+    mapChannelsScalar(src + i, dst + i, static_cast<int>((bytes - i) / 3), map);
+}
+
+/// Loads 16 pixels and returns one vector of 16 bytes per channel.
+PHOTOSMITH_TARGET("sse4.1")
+inline void gatherChannels16(const unsigned char* p, __m128i channels[3])
+{
+    const ShuffleTables& t = shuffleTables();
+    const __m128i v[3] = {
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)),
+    };
+    for (int c = 0; c < 3; ++c) {
+        __m128i channel = _mm_setzero_si128();
+        for (int k = 0; k < 3; ++k) {
+            const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(t.gather[c][k]));
+            channel = _mm_or_si128(channel, _mm_shuffle_epi8(v[k], mask));
+        }
+        channels[c] = channel;
+    }
+}
+
+/// Loads 16 pixels and returns their channel sums as two vectors of 8 x uint16.
+PHOTOSMITH_TARGET("sse4.1")
+inline void channelSums16(const unsigned char* p, __m128i& sumLo, __m128i& sumHi)
+{
+    __m128i channels[3];
+    gatherChannels16(p, channels);
+    const __m128i zero = _mm_setzero_si128();
+    sumLo = zero;
+    sumHi = zero;
+    for (int c = 0; c < 3; ++c) {
+        sumLo = _mm_add_epi16(sumLo, _mm_unpacklo_epi8(channels[c], zero));
+        sumHi = _mm_add_epi16(sumHi, _mm_unpackhi_epi8(channels[c], zero));
+    }
+}
+
+/// Writes one byte per pixel (16 pixels) to all three channels.
+PHOTOSMITH_TARGET("sse4.1")
+inline void storeGray16(unsigned char* p, __m128i values)
+{
+    const ShuffleTables& t = shuffleTables();
+    for (int k = 0; k < 3; ++k) {
+        const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(t.scatter[k]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 16 * k), _mm_shuffle_epi8(values, mask));
+    }
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void grayscaleSse41(unsigned char* p, int width)
+{
+    const __m128i third = _mm_set1_epi16(static_cast<short>(kThird));
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        __m128i sumLo, sumHi;
+        channelSums16(p, sumLo, sumHi);
+        const __m128i gray = _mm_packus_epi16(_mm_mulhi_epu16(sumLo, third), _mm_mulhi_epu16(sumHi, third));
+        storeGray16(p, gray);
+    }
+    grayscaleScalar(p, width - x);
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void thresholdSse41(unsigned char* p, int width, int level)
+{
+    const __m128i third = _mm_set1_epi16(static_cast<short>(kThird));
+    const __m128i limit = _mm_set1_epi16(static_cast<short>(level));
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        __m128i sumLo, sumHi;
+        channelSums16(p, sumLo, sumHi);
+        const __m128i lo = _mm_cmpgt_epi16(_mm_mulhi_epu16(sumLo, third), limit);
+        const __m128i hi = _mm_cmpgt_epi16(_mm_mulhi_epu16(sumHi, third), limit);
+        storeGray16(p, _mm_packs_epi16(lo, hi));
+    }
+    thresholdScalar(p, width - x, level);
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void infraredSse41(unsigned char* p, int width)
+{
+    const ShuffleTables& t = shuffleTables();
+    const __m128i third = _mm_set1_epi16(static_cast<short>(kThird));
+    const __m128i full = _mm_set1_epi16(765);
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        __m128i sumLo, sumHi;
+        channelSums16(p, sumLo, sumHi);
+        const __m128i lo = _mm_mulhi_epu16(_mm_sub_epi16(full, sumLo), third);
+        const __m128i hi = _mm_mulhi_epu16(_mm_sub_epi16(full, sumHi), third);
+        const __m128i inverted = _mm_packus_epi16(lo, hi);
+        for (int k = 0; k < 3; ++k) {
+            const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(t.scatterGB[k]));
+            const __m128i red = _mm_load_si128(reinterpret_cast<const __m128i*>(t.redMask[k]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 16 * k),
+                             _mm_or_si128(_mm_shuffle_epi8(inverted, mask), red));
+        }
+    }
+    infraredScalar(p, width - x);
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void invertSse41(unsigned char* p, std::size_t bytes)
+{
+    const __m128i ones = _mm_set1_epi8(-1);
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i* q = reinterpret_cast<__m128i*>(p + i);
+        _mm_storeu_si128(q, _mm_xor_si128(_mm_loadu_si128(q), ones));
+    }
+    invertScalar(p + i, bytes - i);
+}
+
+/// Weighted sum of 8 zero-extended pixels per channel, rounded to bytes in 16-bit lanes.
+PHOTOSMITH_TARGET("sse4.1")
+inline __m128i luma8(__m128i r, __m128i g, __m128i b)
+{
+    // 255 * 256 + 128 still fits an unsigned 16-bit lane
+    __m128i sum = _mm_mullo_epi16(r, _mm_set1_epi16(kLumaR));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(g, _mm_set1_epi16(kLumaG)));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(b, _mm_set1_epi16(kLumaB)));
+    return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(128)), 8);
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void lumaSse41(const unsigned char* p, unsigned char* out, int width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        __m128i c[3];
+        gatherChannels16(p, c);
+        const __m128i lo = luma8(_mm_unpacklo_epi8(c[0], zero), _mm_unpacklo_epi8(c[1], zero),
+                                 _mm_unpacklo_epi8(c[2], zero));
+        const __m128i hi = luma8(_mm_unpackhi_epi8(c[0], zero), _mm_unpackhi_epi8(c[1], zero),
+                                 _mm_unpackhi_epi8(c[2], zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_packus_epi16(lo, hi));
+    }
+    lumaScalar(p, out + x, width - x);
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+inline __m128i divide255x8(__m128i x)
+{
+    const __m128i t = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+/// blendScalar() on 8 zero-extended bytes; lanes of the unused overlay branch may wrap and are discarded.
+template <PointKernels::BlendMode mode>
+PHOTOSMITH_TARGET("sse4.1")
+inline __m128i blend8(__m128i a, __m128i b, __m128i opacity, __m128i remaining)
+{
+    __m128i mixed = b;
+    if constexpr (mode == PointKernels::BlendMode::Multiply) {
+        mixed = divide255x8(_mm_mullo_epi16(a, b));
+    } else if constexpr (mode == PointKernels::BlendMode::Screen) {
+        mixed = _mm_sub_epi16(_mm_add_epi16(a, b), divide255x8(_mm_mullo_epi16(a, b)));
+    } else if constexpr (mode == PointKernels::BlendMode::Overlay) {
+        const __m128i full = _mm_set1_epi16(255);
+        const __m128i dark = divide255x8(_mm_slli_epi16(_mm_mullo_epi16(a, b), 1));
+        const __m128i light = _mm_sub_epi16(full, divide255x8(_mm_slli_epi16(
+            _mm_mullo_epi16(_mm_sub_epi16(full, a), _mm_sub_epi16(full, b)), 1)));
+        mixed = _mm_blendv_epi8(dark, light, _mm_cmpgt_epi16(a, _mm_set1_epi16(127)));
+    }
+    return divide255x8(_mm_add_epi16(_mm_mullo_epi16(a, remaining), _mm_mullo_epi16(mixed, opacity)));
+}
+
+template <PointKernels::BlendMode mode>
+PHOTOSMITH_TARGET("sse4.1")
+void blendSse41(const unsigned char* overlay, unsigned char* base, std::size_t bytes, int opacity)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i weight = _mm_set1_epi16(static_cast<short>(opacity));
+    const __m128i remaining = _mm_set1_epi16(static_cast<short>(255 - opacity));
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(overlay + i));
+        const __m128i lo = blend8<mode>(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), weight, remaining);
+        const __m128i hi = blend8<mode>(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), weight, remaining);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(base + i), _mm_packus_epi16(lo, hi));
+    }
+    blendScalar(overlay + i, base + i, bytes - i, mode, opacity);
+}
+
+void blendSse41(const unsigned char* overlay, unsigned char* base, std::size_t bytes, PointKernels::BlendMode mode,
+                int opacity)
+{
+    switch (mode) {
+    case PointKernels::BlendMode::Multiply:
+        return blendSse41<PointKernels::BlendMode::Multiply>(overlay, base, bytes, opacity);
+    case PointKernels::BlendMode::Screen:
+        return blendSse41<PointKernels::BlendMode::Screen>(overlay, base, bytes, opacity);
+    case PointKernels::BlendMode::Overlay:
+        return blendSse41<PointKernels::BlendMode::Overlay>(overlay, base, bytes, opacity);
+    default:
+        return blendSse41<PointKernels::BlendMode::Normal>(overlay, base, bytes, opacity);
+    }
+}
+
+PHOTOSMITH_TARGET("sse4.1")
+void spreadGraySse41(const unsigned char* gray, unsigned char* p, int width)
+{
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        storeGray16(p, _mm_loadu_si128(reinterpret_cast<const __m128i*>(gray + x)));
+    }
+    spreadGrayScalar(gray + x, p, width - x);
+}
+
+// ===================== AVX2 =====================
+//
+// 256-bit unpack/pack instructions work within each 128-bit lane. The fixed-
+// point kernel stores its coefficients in that lane order, and the RGB kernels
+// put two independent 16-pixel blocks in the two lanes, so neither needs
+// cross-lane permutes.
+
+/// Coefficients for one 96-byte period, ordered to match in-lane unpacking.
+struct FixedPointPatternAvx2 {
+    alignas(32) std::uint16_t scale[2][3][16];   // [half][vector][lane order]
+    alignas(32) std::uint32_t offset[2][3][2][8];// [half][vector][product][lane order]
+
+    explicit FixedPointPatternAvx2(const PointKernels::ChannelMap& map)
+    {
+        for (int v = 0; v < 3; ++v) {
+            for (int half = 0; half < 2; ++half) {
+                // unpacklo takes bytes 0-7 of each lane, unpackhi bytes 8-15
+                for (int k = 0; k < 16; ++k) {
+                    const int byte = 32 * v + (k / 8) * 16 + half * 8 + (k % 8);
+                    scale[half][v][k] = map.scale[byte % 3];
+                }
+                // The 32-bit products split each lane's 8 words into 4 + 4
+                for (int product = 0; product < 2; ++product) {
+                    for (int k = 0; k < 8; ++k) {
+                        const int byte = 32 * v + (k / 4) * 16 + half * 8 + product * 4 + (k % 4);
+                        offset[half][v][product][k] = map.offset[byte % 3];
+                    }
+                }
+            }
+        }
+    }
+};
+
+PHOTOSMITH_TARGET("avx2")
+inline __m256i fixedPoint16(__m256i x, const std::uint16_t* scale, const std::uint32_t (*offset)[8])
+{
+    const __m256i m = _mm256_load_si256(reinterpret_cast<const __m256i*>(scale));
+    const __m256i lo = _mm256_mullo_epi16(x, m);
+    const __m256i hi = _mm256_mulhi_epu16(x, m);
+    __m256i p0 = _mm256_unpacklo_epi16(lo, hi);
+    __m256i p1 = _mm256_unpackhi_epi16(lo, hi);
+    p0 = _mm256_add_epi32(p0, _mm256_load_si256(reinterpret_cast<const __m256i*>(offset[0])));
+    p1 = _mm256_add_epi32(p1, _mm256_load_si256(reinterpret_cast<const __m256i*>(offset[1])));
+    p0 = _mm256_srli_epi32(p0, kFixedShift);
+    p1 = _mm256_srli_epi32(p1, kFixedShift);
+    return _mm256_packs_epi32(p0, p1);
+}
+
+PHOTOSMITH_TARGET("avx2")
+void mapChannelsAvx2(const unsigned char* src, unsigned char* dst, int width, const PointKernels::ChannelMap& map)
+{
+    if (!map.fixedPoint) {
+        mapChannelsScalar(src, dst, width, map);
+        return;
+    }
+    const FixedPointPatternAvx2 pattern(map);
+    const __m256i zero = _mm256_setzero_si256();
+    const std::size_t bytes = static_cast<std::size_t>(width) * 3;
+    std::size_t i = 0;
+    for (; i + 96 <= bytes; i += 96) {
+        for (int v = 0; v < 3; ++v) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32 * v));
+            const __m256i lo = fixedPoint16(_mm256_unpacklo_epi8(in, zero), pattern.scale[0][v], pattern.offset[0][v]);
+            const __m256i hi = fixedPoint16(_mm256_unpackhi_epi8(in, zero), pattern.scale[1][v], pattern.offset[1][v]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 32 * v), _mm256_packus_epi16(lo, hi));
+        }
+    }
+    mapChannelsSse41(src + i, dst + i, static_cast<int>((bytes - i) / 3), map);
+}
+
+/// Loads two consecutive 16-pixel blocks (one per lane) and returns their channel sums.
+PHOTOSMITH_TARGET("avx2")
+inline void channelSums32(const unsigned char* p, __m256i& sumLo, __m256i& sumHi)
+{
+    const ShuffleTables& t = shuffleTables();
+    __m256i v[3];
+    for (int k = 0; k < 3; ++k) {
+        v[k] = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48 + 16 * k)), 1);
+    }
+    const __m256i zero = _mm256_setzero_si256();
+    sumLo = zero;
+    sumHi = zero;
+    for (int c = 0; c < 3; ++c) {
+        __m256i channel = zero;
+        for (int k = 0; k < 3; ++k) {
+            const __m256i mask = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(t.gather[c][k])));
+            channel = _mm256_or_si256(channel, _mm256_shuffle_epi8(v[k], mask));
+        }
+        sumLo = _mm256_add_epi16(sumLo, _mm256_unpacklo_epi8(channel, zero));
+        sumHi = _mm256_add_epi16(sumHi, _mm256_unpackhi_epi8(channel, zero));
+    }
+}
+
+/// Scatters per-pixel bytes (two 16-pixel blocks) with @p masks, OR-ing in @p fill.
+PHOTOSMITH_TARGET("avx2")
+inline void storeBlocks32(unsigned char* p, __m256i values, const std::int8_t (*masks)[16], const std::int8_t (*fill)[16])
+{
+    for (int k = 0; k < 3; ++k) {
+        const __m256i mask = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(masks[k])));
+        __m256i out = _mm256_shuffle_epi8(values, mask);
+        if (fill) {
+            out = _mm256_or_si256(out, _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(fill[k]))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 16 * k), _mm256_castsi256_si128(out));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 48 + 16 * k), _mm256_extracti128_si256(out, 1));
+    }
+}
+
+PHOTOSMITH_TARGET("avx2")
+void grayscaleAvx2(unsigned char* p, int width)
+{
+    const __m256i third = _mm256_set1_epi16(static_cast<short>(kThird));
+    int x = 0;
+    for (; x + 32 <= width; x += 32, p += 96) {
+        __m256i sumLo, sumHi;
+        channelSums32(p, sumLo, sumHi);
+        const __m256i gray = _mm256_packus_epi16(_mm256_mulhi_epu16(sumLo, third), _mm256_mulhi_epu16(sumHi, third));
+        storeBlocks32(p, gray, shuffleTables().scatter, nullptr);
+    }
+    grayscaleSse41(p, width - x);
+}
+
+PHOTOSMITH_TARGET("avx2")
+void thresholdAvx2(unsigned char* p, int width, int level)
+{
+    const __m256i third = _mm256_set1_epi16(static_cast<short>(kThird));
+    const __m256i limit = _mm256_set1_epi16(static_cast<short>(level));
+    int x = 0;
+    for (; x + 32 <= width; x += 32, p += 96) {
+        __m256i sumLo, sumHi;
+        channelSums32(p, sumLo, sumHi);
+        const __m256i lo = _mm256_cmpgt_epi16(_mm256_mulhi_epu16(sumLo, third), limit);
+        const __m256i hi = _mm256_cmpgt_epi16(_mm256_mulhi_epu16(sumHi, third), limit);
+        storeBlocks32(p, _mm256_packs_epi16(lo, hi), shuffleTables().scatter, nullptr);
+    }
+    thresholdSse41(p, width - x, level);
+}
+
+PHOTOSMITH_TARGET("avx2")
+void infraredAvx2(unsigned char* p, int width)
+{
+    const __m256i third = _mm256_set1_epi16(static_cast<short>(kThird));
+    const __m256i full = _mm256_set1_epi16(765);
+    int x = 0;
+    for (; x + 32 <= width; x += 32, p += 96) {
+        __m256i sumLo, sumHi;
+        channelSums32(p, sumLo, sumHi);
+        const __m256i lo = _mm256_mulhi_epu16(_mm256_sub_epi16(full, sumLo), third);
+        const __m256i hi = _mm256_mulhi_epu16(_mm256_sub_epi16(full, sumHi), third);
+        storeBlocks32(p, _mm256_packus_epi16(lo, hi), shuffleTables().scatterGB, shuffleTables().redMask);
+    }
+    infraredSse41(p, width - x);
+}
+
+PHOTOSMITH_TARGET("avx2")
+void invertAvx2(unsigned char* p, std::size_t bytes)
+{
+    const __m256i ones = _mm256_set1_epi8(-1);
+    std::size_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        __m256i* q = reinterpret_cast<__m256i*>(p + i);
+        _mm256_storeu_si256(q, _mm256_xor_si256(_mm256_loadu_si256(q), ones));
+    }
+    invertSse41(p + i, bytes - i);
+}
+
+PHOTOSMITH_TARGET("avx2")
+void spreadGrayAvx2(const unsigned char* gray, unsigned char* p, int width)
+{
+    int x = 0;
+    for (; x + 32 <= width; x += 32, p += 96) {
+        storeBlocks32(p, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(gray + x)),
+                      shuffleTables().scatter, nullptr);
+    }
+    spreadGraySse41(gray + x, p, width - x);
+}
+
+/// Runtime CPU feature check (including OS support for the AVX register state).
+bool cpuSupports(const char* isa)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    const bool sse41 = (info[2] & (1 << 19)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (std::strcmp(isa, "sse4.1") == 0) return sse41;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return std::strcmp(isa, "avx2") == 0 && (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    if (std::strcmp(isa, "sse4.1") == 0) return __builtin_cpu_supports("sse4.1");
+    if (std::strcmp(isa, "avx2") == 0) return __builtin_cpu_supports("avx2");
+    return false;
+#endif
+}
+
+#endif // PHOTOSMITH_SIMD_X86
+
+#if defined(PHOTOSMITH_SIMD_NEON)
+
+// ===================== NEON =====================
+//
+// vld3q_u8/vst3q_u8 de-interleave 16 RGB pixels into one register per channel.
+
+inline uint8x8_t divideByThree(uint16x8_t sum)
+{
+    const uint16x4_t third = vdup_n_u16(kThird);
+    const uint32x4_t lo = vmull_u16(vget_low_u16(sum), third);
+    const uint32x4_t hi = vmull_u16(vget_high_u16(sum), third);
+    return vmovn_u16(vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16)));
+}
+
+inline uint8x16_t averageOf(const uint8x16x3_t& rgb)
+{
+    const uint16x8_t lo = vaddw_u8(vaddl_u8(vget_low_u8(rgb.val[0]), vget_low_u8(rgb.val[1])), vget_low_u8(rgb.val[2]));
+    const uint16x8_t hi = vaddw_u8(vaddl_u8(vget_high_u8(rgb.val[0]), vget_high_u8(rgb.val[1])), vget_high_u8(rgb.val[2]));
+    return vcombine_u8(divideByThree(lo), divideByThree(hi));
+}
+
+inline uint8x8_t fixedPointNeon(uint8x8_t x, std::uint16_t scale, std::uint32_t offset)
+{
+    const uint16x8_t wide = vmovl_u8(x);
+    const uint32x4_t add = vdupq_n_u32(offset);
+    const uint32x4_t lo = vshrq_n_u32(vmlal_n_u16(add, vget_low_u16(wide), scale), kFixedShift);
+    const uint32x4_t hi = vshrq_n_u32(vmlal_n_u16(add, vget_high_u16(wide), scale), kFixedShift);
+    return vqmovn_u16(vcombine_u16(vqmovn_u32(lo), vqmovn_u32(hi)));
+}
+
+void mapChannelsNeon(const unsigned char* src, unsigned char* dst, int width, const PointKernels::ChannelMap& map)
+{
+    if (!map.fixedPoint) {
+        mapChannelsScalar(src, dst, width, map);
+        return;
+    }
+    int x = 0;
+    for (; x + 16 <= width; x += 16, src += 48, dst += 48) {
+        uint8x16x3_t rgb = vld3q_u8(src);
+        for (int c = 0; c < 3; ++c) {
+            rgb.val[c] = vcombine_u8(fixedPointNeon(vget_low_u8(rgb.val[c]), map.scale[c], map.offset[c]),
+                                     fixedPointNeon(vget_high_u8(rgb.val[c]), map.scale[c], map.offset[c]));
+        }
+        vst3q_u8(dst, rgb);
+    }
+    mapChannelsScalar(src, dst, width - x, map);
+}
+
+void grayscaleNeon(unsigned char* p, int width)
+{
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        const uint8x16_t gray = averageOf(vld3q_u8(p));
+        uint8x16x3_t out;
+        out.val[0] = gray;
+        out.val[1] = gray;
+        out.val[2] = gray;
+        vst3q_u8(p, out);
+    }
+    grayscaleScalar(p, width - x);
+}
+
+void thresholdNeon(unsigned char* p, int width, int level)
+{
+    const uint8x16_t limit = vdupq_n_u8(static_cast<std::uint8_t>(std::max(0, std::min(255, level))));
+    int x = 0;
+    // Levels outside [0, 255) would saturate the byte compare; the scalar loop handles them
+    if (level >= 0 && level < 255) {
+        for (; x + 16 <= width; x += 16, p += 48) {
+            const uint8x16_t bw = vcgtq_u8(averageOf(vld3q_u8(p)), limit);
+            uint8x16x3_t out;
+            out.val[0] = bw;
+            out.val[1] = bw;
+            out.val[2] = bw;
+            vst3q_u8(p, out);
+        }
+    }
+    thresholdScalar(p, width - x, level);
+}
+
+void infraredNeon(unsigned char* p, int width)
+{
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        const uint8x16x3_t rgb = vld3q_u8(p);
+        const uint16x8_t full = vdupq_n_u16(765);
+        const uint16x8_t lo = vsubq_u16(full, vaddw_u8(vaddl_u8(vget_low_u8(rgb.val[0]), vget_low_u8(rgb.val[1])), vget_low_u8(rgb.val[2])));
+        const uint16x8_t hi = vsubq_u16(full, vaddw_u8(vaddl_u8(vget_high_u8(rgb.val[0]), vget_high_u8(rgb.val[1])), vget_high_u8(rgb.val[2])));
+        const uint8x16_t inverted = vcombine_u8(divideByThree(lo), divideByThree(hi));
+        uint8x16x3_t out;
+        out.val[0] = vdupq_n_u8(255);
+        out.val[1] = inverted;
+        out.val[2] = inverted;
+        vst3q_u8(p, out);
+    }
+    infraredScalar(p, width - x);
+}
+
+void invertNeon(unsigned char* p, std::size_t bytes)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        vst1q_u8(p + i, vmvnq_u8(vld1q_u8(p + i)));
+    }
+    invertScalar(p + i, bytes - i);
+}
+
+inline uint16x8_t divide255Neon(uint16x8_t x)
+{
+    const uint16x8_t t = vaddq_u16(x, vdupq_n_u16(128));
+    return vshrq_n_u16(vsraq_n_u16(t, t, 8), 8);
+}
+
+inline uint8x8_t blend8Neon(uint8x8_t a, uint8x8_t b, PointKernels::BlendMode mode, std::uint8_t opacity)
+{
+    uint16x8_t mixed = vmovl_u8(b);
+    if (mode == PointKernels::BlendMode::Multiply) {
+        mixed = divide255Neon(vmull_u8(a, b));
+    } else if (mode == PointKernels::BlendMode::Screen) {
+        mixed = vsubq_u16(vaddl_u8(a, b), divide255Neon(vmull_u8(a, b)));
+    } else if (mode == PointKernels::BlendMode::Overlay) {
+        const uint16x8_t dark = divide255Neon(vshlq_n_u16(vmull_u8(a, b), 1));
+        const uint16x8_t light = vsubq_u16(vdupq_n_u16(255), divide255Neon(vshlq_n_u16(vmull_u8(vmvn_u8(a), vmvn_u8(b)), 1)));
+        mixed = vbslq_u16(vcgeq_u16(vmovl_u8(a), vdupq_n_u16(128)), light, dark);
+    }
+    const uint16x8_t sum = vmlaq_u16(vmull_u8(a, vdup_n_u8(static_cast<std::uint8_t>(255 - opacity))), mixed,
+                                     vdupq_n_u16(opacity));
+    return vmovn_u16(divide255Neon(sum));
+}
+
+void blendNeon(const unsigned char* overlay, unsigned char* base, std::size_t bytes, PointKernels::BlendMode mode,
+               int opacity)
+{
+    const std::uint8_t weight = static_cast<std::uint8_t>(opacity);
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        const uint8x16_t a = vld1q_u8(base + i);
+        const uint8x16_t b = vld1q_u8(overlay + i);
+        vst1q_u8(base + i, vcombine_u8(blend8Neon(vget_low_u8(a), vget_low_u8(b), mode, weight),
+                                       blend8Neon(vget_high_u8(a), vget_high_u8(b), mode, weight)));
+    }
+    blendScalar(overlay + i, base + i, bytes - i, mode, opacity);
+}
+
+void lumaNeon(const unsigned char* p, unsigned char* out, int width)
+{
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        const uint8x16x3_t rgb = vld3q_u8(p);
+        uint16x8_t lo = vmull_u8(vget_low_u8(rgb.val[0]), vdup_n_u8(kLumaR));
+        uint16x8_t hi = vmull_u8(vget_high_u8(rgb.val[0]), vdup_n_u8(kLumaR));
+        lo = vmlal_u8(lo, vget_low_u8(rgb.val[1]), vdup_n_u8(kLumaG));
+        hi = vmlal_u8(hi, vget_high_u8(rgb.val[1]), vdup_n_u8(kLumaG));
+        lo = vmlal_u8(lo, vget_low_u8(rgb.val[2]), vdup_n_u8(kLumaB));
+        hi = vmlal_u8(hi, vget_high_u8(rgb.val[2]), vdup_n_u8(kLumaB));
+        vst1q_u8(out + x, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+    }
+    lumaScalar(p, out + x, width - x);
+}
+
+void spreadGrayNeon(const unsigned char* gray, unsigned char* p, int width)
+{
+    int x = 0;
+    for (; x + 16 <= width; x += 16, p += 48) {
+        uint8x16x3_t out;
+        out.val[0] = vld1q_u8(gray + x);
+        out.val[1] = out.val[0];
+        out.val[2] = out.val[0];
+        vst3q_u8(p, out);
+    }
+    spreadGrayScalar(gray + x, p, width - x);
+}
+
+#endif // PHOTOSMITH_SIMD_NEON
+
+// ===================== Dispatch =====================
+
+struct KernelTable {
+    const char* name;
+    void (*mapChannels)(const unsigned char*, unsigned char*, int, const PointKernels::ChannelMap&);
+    void (*grayscale)(unsigned char*, int);
+    void (*threshold)(unsigned char*, int, int);
+    void (*infrared)(unsigned char*, int);
+    void (*invert)(unsigned char*, std::size_t);
+    void (*luma)(const unsigned char*, unsigned char*, int);
+    void (*spreadGray)(const unsigned char*, unsigned char*, int);
+    void (*blend)(const unsigned char*, unsigned char*, std::size_t, PointKernels::BlendMode, int);
+};
+
+const KernelTable& kernels()
+{
+    static const KernelTable table = []() {
+        // PHOTOSMITH_SIMD caps the instruction set (e.g. "scalar" for comparisons)
+        const char* env = std::getenv("PHOTOSMITH_SIMD");
+        const std::string cap = env ? env : "";
+        const KernelTable scalar = {"scalar", mapChannelsScalar, grayscaleScalar, thresholdScalar, infraredScalar, invertScalar,
+                                     lumaScalar, spreadGrayScalar, blendScalar};
+        if (cap == "scalar") return scalar;
+#if defined(PHOTOSMITH_SIMD_X86)
+        if (cap != "sse4.1" && cpuSupports("avx2")) {
+            return KernelTable{"avx2", mapChannelsAvx2, grayscaleAvx2, thresholdAvx2, infraredAvx2, invertAvx2,
+                               lumaSse41, spreadGrayAvx2, blendSse41};
+        }
+        if (cpuSupports("sse4.1")) {
+            return KernelTable{"sse4.1", mapChannelsSse41, grayscaleSse41, thresholdSse41, infraredSse41, invertSse41,
+                               lumaSse41, spreadGraySse41, blendSse41};
+        }
+#elif defined(PHOTOSMITH_SIMD_NEON)
+        return KernelTable{"neon", mapChannelsNeon, grayscaleNeon, thresholdNeon, infraredNeon, invertNeon,
+                           lumaNeon, spreadGrayNeon, blendNeon};
+#endif
+        return scalar;
+    }();
+    return table;
+}
+
+} // namespace
+
+PointKernels::ChannelMap PointKernels::makeChannelMap(const std::function<int(int channel, int value)>& transform)
+{
+    ChannelMap map;
+    for (int c = 0; c < 3; ++c) {
+        for (int v = 0; v < 256; ++v) {
+            map.lut[c][v] = static_cast<unsigned char>(std::max(0, std::min(255, transform(c, v))));
+        }
+    }
+    map.fixedPoint = true;
+    for (int c = 0; c < 3 && map.fixedPoint; ++c) {
+        map.fixedPoint = fitFixedPoint(map.lut[c], map.scale[c], map.offset[c]);
+    }
+    return map;
+}
+
+void PointKernels::mapChannels(const unsigned char* src, unsigned char* dst, int width, const ChannelMap& map)
+{
+    kernels().mapChannels(src, dst, width, map);
+}
+
+void PointKernels::grayscale(unsigned char* row, int width)
+{
+    kernels().grayscale(row, width);
+}
+
+void PointKernels::threshold(unsigned char* row, int width, int level)
+{
+    // Averages lie in [0, 255], so clamping keeps the result and fits 16-bit lanes
+    kernels().threshold(row, width, std::max(-1, std::min(255, level)));
+}
+
+void PointKernels::infrared(unsigned char* row, int width)
+{
+    kernels().infrared(row, width);
+}
+
+void PointKernels::invert(unsigned char* data, std::size_t bytes)
+{
+    kernels().invert(data, bytes);
+}
+
+void PointKernels::luma(const unsigned char* rgb, unsigned char* out, int width)
+{
+    kernels().luma(rgb, out, width);
+}
+
+void PointKernels::spreadGray(const unsigned char* gray, unsigned char* rgb, int width)
+{
+    kernels().spreadGray(gray, rgb, width);
+}
+
+void PointKernels::blend(const unsigned char* overlay, unsigned char* base, std::size_t bytes, BlendMode mode,
+                         int opacity)
+{
+    kernels().blend(overlay, base, bytes, mode, std::max(0, std::min(255, opacity)));
+}
+
+const char* PointKernels::activeIsa()
+{
+    return kernels().name;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file PointKernels.h
+ * @brief Vectorized per-pixel colour kernels for interleaved RGB24 rows.
+ *
+ * This file declares the PointKernels class, the SIMD layer used by the point
+ * operations in ImageFilters (grayscale, black & white, invert, infrared and
+ * every per-channel colour transform) and by the luma planes of EdgeEngine.
+ * Each kernel processes one row of packed RGB pixels in place or from a source
+ * row, using integer fixed-point math.
+ *
+ * @details The library provides:
+ * - AVX2 and SSE4.1 implementations on x86, selected at runtime from the CPU
+ *   features, and a NEON implementation on ARM64
+ * - A portable scalar fallback that defines the exact expected output
+ * - Per-channel transforms described by a 256-entry lookup table; when the
+ *   table is a clamped affine function it is re-expressed in Q14 fixed point
+ *   and run with SIMD, otherwise the table itself is applied
+ * - Output identical to the scalar code on every instruction set
+ *
+ * @note The PHOTOSMITH_SIMD environment variable ("scalar", "sse4.1", "avx2")
+ *       caps the instruction set, which is useful for benchmarking.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef POINTKERNELS_H
+#define POINTKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @class PointKernels
+ * @brief Static dispatcher for the vectorized RGB24 point operations.
+ *
+ * @code
+ * PointKernels::ChannelMap map = PointKernels::makeChannelMap([](int channel, int value) {
+ *     return channel == 2 ? value : std::min(255, int(value * 1.4));
+ * });
+ * for (int y = 0; y < img.height; ++y) {
+ *     PointKernels::mapChannels(img.row(y), img.row(y), img.width, map);
+ * }
+ * @endcode
+ */
+class PointKernels {
+public:
+    /**
+     * @brief How blend() combines a base byte a with an overlay byte b (both 0-255).
+     */
+    enum class BlendMode {
+        Normal,   ///< b
+        Multiply, ///< a * b / 255, darkens
+        Screen,   ///< 255 - (255 - a) * (255 - b) / 255, lightens
+        Overlay   ///< Multiply (doubled) where a < 128, screen (doubled) elsewhere: more contrast
+    };
+
+    /**
+     * @brief Independent per-channel transform out[c] = lut[c][in[c]].
+     *
+     * Built by makeChannelMap(). When every channel matches
+     * min(255, (value * scale + offset) >> 14) for all 256 inputs, the
+     * fixed-point form is used by the SIMD kernels.
+     */
+    struct ChannelMap {
+        unsigned char lut[3][256];   ///< Exact result per channel and input value
+        bool fixedPoint = false;     ///< True if the Q14 form reproduces lut exactly
+        std::uint16_t scale[3] = {}; ///< Q14 multiplier per channel
+        std::uint32_t offset[3] = {};///< Q14 addend per channel
+    };
+
+    /**
+     * @brief Builds a ChannelMap from a per-channel transform.
+     *
+     * @param transform Function returning the output for (channel, value);
+     *        results are clamped to [0, 255]
+     * @return The tabulated transform, with its fixed-point form if one exists
+     */
+    static ChannelMap makeChannelMap(const std::function<int(int channel, int value)>& transform);
+
+    /**
+     * @brief Applies @p map to @p width pixels; @p src may equal @p dst.
+     */
+    static void mapChannels(const unsigned char* src, unsigned char* dst, int width, const ChannelMap& map);
+
+    /**
+     * @brief Replaces every pixel by its channel average (R + G + B) / 3, in place.
+     */
+    static void grayscale(unsigned char* row, int width);
+
+    /**
+     * @brief Sets pixels whose channel average exceeds @p level to white, others to black, in place.
+     */
+    static void threshold(unsigned char* row, int width, int level);
+
+    /**
+     * @brief Infrared look: red saturated, green and blue set to the inverted average, in place.
+     */
+    static void infrared(unsigned char* row, int width);
+
+    /**
+     * @brief Inverts @p bytes bytes (255 - value), in place.
+     */
+    static void invert(unsigned char* data, std::size_t bytes);
+
+    /**
+     * @brief Blends @p bytes bytes of @p overlay into @p base, in place.
+     *
+     * base = (base * (255 - opacity) + mode(base, overlay) * opacity) / 255,
+     * every division by 255 rounded to nearest in 16-bit fixed point. Channels
+     * are independent, so any interleaved 8-bit layout works.
+     *
+     * @param opacity Weight of the blended result, 0 (base unchanged) to 255
+     */
+    static void blend(const unsigned char* overlay, unsigned char* base, std::size_t bytes, BlendMode mode,
+                      int opacity);
+
+    /**
+     * @brief Writes the Rec. 601 luma (77 R + 150 G + 29 B + 128) >> 8 of each pixel, one byte per pixel.
+     */
+    static void luma(const unsigned char* rgb, unsigned char* out, int width);
+
+    /**
+     * @brief Expands one byte per pixel into grey RGB pixels (the inverse layout of luma()).
+     */
+    static void spreadGray(const unsigned char* gray, unsigned char* rgb, int width);
+
+    /**
+     * @brief Name of the instruction set in use ("avx2", "sse4.1", "neon" or "scalar").
+     */
+    static const char* activeIsa();
+};
+
+#endif // POINTKERNELS_H
@@ -214,6 +214,9 @@ void ColorWheelDialog::setupUI()
         frameWidthSpinBox->setValue(defaultWidth);
         frameLayout->addRow("Frame Width (px):", frameWidthSpinBox);
         
+        connect(frameTypeCombo, &QComboBox::currentIndexChanged, this, &ColorWheelDialog::selectionChanged);
+        connect(frameWidthSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, &ColorWheelDialog::selectionChanged);
+        
         frameMainLayout->addLayout(frameLayout);
         
         mainLayout->addWidget(frameGroup);
@@ -499,6 +502,7 @@ void ColorWheelDialog::updateColorPreview()
         .toUpper();
     hexLabel->setText(QString("Hex: %1").arg(hex));
     
+    emit selectionChanged();
 }
 
 
@@ -129,6 +129,14 @@ public:
      */
     int getFrameWidth() const;
 
+signals:
+    /**
+     * @brief Emitted whenever the colour, frame type or frame width changes.
+     * 
+     * Lets the caller preview the current choice while the dialog is open.
+     */
+    void selectionChanged();
+
 private slots:
     /**
      * @brief Updates color preview when RGB sliders change.
@@ -0,0 +1,142 @@
+/**
+ * @file DiagnosticsDialog.cpp
+ * @brief Implementation of the diagnostics panel.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "DiagnosticsDialog.h"
+#include "../core/image/BufferPool.h"
+#include "../core/image/Image_Class.h"
+#include <QDir>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace {
+
+QString formatMiB(std::size_t bytes)
+{
+    return QString::number(static_cast<double>(bytes) / (1024.0 * 1024.0), 'f', 1);
+}
+
+QTableWidgetItem* numberItem(const QString& text)
+{
+    auto* item = new QTableWidgetItem(text);
+    item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    return item;
+}
+
+} // namespace
+
+DiagnosticsDialog::DiagnosticsDialog(OperationTrace& trace, std::function<std::size_t()> historyBytes,
+                                     QWidget* parent)
+    : QDialog(parent), trace(trace), historyBytes(std::move(historyBytes))
+{
+    setWindowTitle("Diagnostics");
+    resize(860, 420);
+
+    summaryLabel = new QLabel(this);
+
+    table = new QTableWidget(0, 9, this);
+    table->setHorizontalHeaderLabels({"Operation", "Type", "Result", "Time (ms)", "Megapixels", "MPix/s",
+                                      "Allocated (MiB)", "Peak (MiB)", "History (MiB)"});
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->verticalHeader()->setVisible(false);
+    table->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+
+    QPushButton* exportButton = new QPushButton("Export Chrome Trace...", this);
+    QPushButton* clearButton = new QPushButton("Clear", this);
+    QPushButton* closeButton = new QPushButton("Close", this);
+    connect(exportButton, &QPushButton::clicked, this, &DiagnosticsDialog::exportChromeTrace);
+    connect(clearButton, &QPushButton::clicked, this, [this]() {
+        this->trace.clear();
+        refresh();
+    });
+    connect(closeButton, &QPushButton::clicked, this, &QDialog::close);
+
+    QHBoxLayout* buttons = new QHBoxLayout();
+    buttons->addWidget(exportButton);
+    buttons->addWidget(clearButton);
+    buttons->addStretch();
+    buttons->addWidget(closeButton);
+
+    QVBoxLayout* layout = new QVBoxLayout(this);
+    layout->addWidget(summaryLabel);
+    layout->addWidget(table);
+    layout->addLayout(buttons);
+
+    refreshTimer.setInterval(1000);
+    connect(&refreshTimer, &QTimer::timeout, this, &DiagnosticsDialog::refresh);
+}
+
+void DiagnosticsDialog::refresh()
+{
+    const std::vector<OperationTrace::Record> records = trace.records();
+    const BufferPool::Stats pool = BufferPool::instance().stats();
+    summaryLabel->setText(QString("Pixel memory in use: %1 MiB    Undo history: %2 MiB    Operations kept: %3 of %4"
+                                  "    Buffer pool: %5 MiB idle, %6 of %7 buffers reused")
+                              .arg(formatMiB(Image::pixelBytesInUse()),
+                                   formatMiB(historyBytes ? historyBytes() : 0))
+                              .arg(records.size())
+                              .arg(trace.capacity())
+                              .arg(formatMiB(pool.idleBytes))
+                              .arg(pool.reused)
+                              .arg(pool.reused + pool.mapped));
+
+    table->setRowCount(static_cast<int>(records.size()));
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const OperationTrace::Record& record = records[records.size() - 1 - i]; // Newest first
+        const int row = static_cast<int>(i);
+        const double mpixPerSecond = record.megapixelsPerSecond();
+        table->setItem(row, 0, new QTableWidgetItem(QString::fromStdString(record.name)));
+        table->setItem(row, 1, new QTableWidgetItem(QString::fromStdString(record.category)));
+        table->setItem(row, 2, new QTableWidgetItem(QString::fromStdString(record.outcome)));
+        table->setItem(row, 3, numberItem(QString::number(record.durationUs / 1000.0, 'f', 1)));
+        table->setItem(row, 4, numberItem(QString::number(record.pixels / 1e6, 'f', 2)));
+        table->setItem(row, 5, numberItem(mpixPerSecond > 0 ? QString::number(mpixPerSecond, 'f', 1) : QString("-")));
+        table->setItem(row, 6, numberItem(formatMiB(record.allocatedBytes)));
+        table->setItem(row, 7, numberItem(formatMiB(record.peakBytes)));
+        table->setItem(row, 8, numberItem(formatMiB(record.historyBytes)));
+    }
+}
+
+void DiagnosticsDialog::showEvent(QShowEvent* event)
+{
+    QDialog::showEvent(event);
+    refresh();
+    refreshTimer.start();
+}
+
+void DiagnosticsDialog::hideEvent(QHideEvent* event)
+{
+    refreshTimer.stop();
+    QDialog::hideEvent(event);
+}
+
+void DiagnosticsDialog::exportChromeTrace()
+{
+    const QString fileName = QFileDialog::getSaveFileName(this, "Export Chrome Trace",
+        QDir::homePath() + "/photosmith-trace.json", "Chrome Trace (*.json)");
+    if (fileName.isEmpty()) return;
+    try {
+        trace.writeChromeTrace(fileName.toStdString());
+    } catch (const std::exception& e) {
+        QMessageBox::critical(this, "Error", QString("Failed to export trace: %1").arg(e.what()));
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * @file DiagnosticsDialog.h
+ * @brief Panel listing recent operations with their time and memory use.
+ *
+ * This file declares the DiagnosticsDialog class, the viewer for the
+ * application's OperationTrace. It shows one row per filter, undo/redo and
+ * file operation, the current pixel and history memory, and exports the trace
+ * as Chrome trace JSON for chrome://tracing or Perfetto.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef DIAGNOSTICSDIALOG_H
+#define DIAGNOSTICSDIALOG_H
+
+#include <QDialog>
+#include <QLabel>
+#include <QTableWidget>
+#include <QTimer>
+#include <cstddef>
+#include <functional>
+#include "../core/diagnostics/OperationTrace.h"
+
+/**
+ * @class DiagnosticsDialog
+ * @brief Modeless window over an OperationTrace, refreshed while visible.
+ *
+ * @code
+ * DiagnosticsDialog* diagnostics = new DiagnosticsDialog(trace, [this]() { return history.memoryUsage(); }, this);
+ * diagnostics->show();
+ * @endcode
+ */
+class DiagnosticsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @param trace Operations to show; Clear empties it (must outlive the dialog)
+     * @param historyBytes Returns the current undo history memory
+     * @param parent Parent widget
+     */
+    DiagnosticsDialog(OperationTrace& trace, std::function<std::size_t()> historyBytes, QWidget* parent = nullptr);
+
+    /**
+     * @brief Reloads the table and the memory summary.
+     */
+    void refresh();
+
+protected:
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+
+private:
+    /**
+     * @brief Asks for a file name and writes the trace to it.
+     */
+    void exportChromeTrace();
+
+    OperationTrace& trace;                      ///< Source of the rows
+    std::function<std::size_t()> historyBytes;  ///< Current undo history memory
+    QTableWidget* table;                        ///< One row per operation, newest first
+    QLabel* summaryLabel;                       ///< Current memory figures
+    QTimer refreshTimer;                        ///< Refreshes the view while it is visible
+};
+
+#endif // DIAGNOSTICSDIALOG_H
@@ -0,0 +1,65 @@
+/**
+ * @file QtProgressReporter.cpp
+ * @brief Implementation of the Qt progress and status reporter.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "QtProgressReporter.h"
+#include <QtWidgets/QProgressBar>
+#include <QtWidgets/QStatusBar>
+#include <QtCore/QMetaObject>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <utility>
+
+void QtProgressReporter::beginProgress(int total)
+{
+    if (!progressBar) return;
+    QProgressBar* bar = progressBar;
+    postToGui(bar, [bar, total]() {
+        bar->setVisible(true);
+        bar->setRange(0, total);
+        bar->setValue(0);
+    });
+}
+
+void QtProgressReporter::updateProgress(int value, int)
+{
+    if (!progressBar) return;
+    QProgressBar* bar = progressBar;
+    postToGui(bar, [bar, value]() { bar->setValue(value); });
+}
+
+void QtProgressReporter::endProgress()
+{
+    if (!progressBar) return;
+    QProgressBar* bar = progressBar;
+    postToGui(bar, [bar]() { bar->setVisible(false); });
+}
+
+void QtProgressReporter::showStatus(const std::string& message)
+{
+    if (!statusBar) return;
+    QStatusBar* bar = statusBar;
+    postToGui(bar, [bar, text = QString::fromStdString(message)]() { bar->showMessage(text); });
+}
+
+void QtProgressReporter::postToGui(QObject* widget, std::function<void()> update)
+{
+    if (!widget) return;
+    if (QThread::currentThread() == widget->thread()) {
+        update();
+        return;
+    }
+    // Queued calls are dropped automatically if the widget is destroyed first
+    QMetaObject::invokeMethod(widget, std::move(update), Qt::QueuedConnection);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file QtProgressReporter.h
+ * @brief ProgressReporter that drives a QProgressBar and a QStatusBar.
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef QTPROGRESSREPORTER_H
+#define QTPROGRESSREPORTER_H
+
+#include <functional>
+#include "../core/filters/ProgressReporter.h"
+
+class QObject;
+class QProgressBar;
+class QStatusBar;
+
+/**
+ * @class QtProgressReporter
+ * @brief Forwards filter reports to the GUI's progress bar and status bar.
+ *
+ * Filters run on a worker thread while the widgets belong to the GUI thread,
+ * so every update is queued to the widget's event loop instead of touching it
+ * directly. Calls made from the widget's own thread run immediately.
+ */
+class QtProgressReporter : public ProgressReporter {
+public:
+    /**
+     * @param progressBar Progress bar to drive (can be nullptr)
+     * @param statusBar Status bar for messages (can be nullptr)
+     */
+    QtProgressReporter(QProgressBar* progressBar, QStatusBar* statusBar)
+        : progressBar(progressBar), statusBar(statusBar) {}
+
+    void beginProgress(int total) override;
+    void updateProgress(int value, int total) override;
+    void endProgress() override;
+    void showStatus(const std::string& message) override;
+
+private:
+    /**
+     * @brief Runs @p update on the thread that owns @p widget.
+     *
+     * @param widget Target widget (nothing happens if nullptr)
+     * @param update Function performing the widget update
+     */
+    static void postToGui(QObject* widget, std::function<void()> update);
+
+    QProgressBar* progressBar; ///< Progress bar, owned by the main window
+    QStatusBar* statusBar;     ///< Status bar, owned by the main window
+};
+
+#endif // QTPROGRESSREPORTER_H
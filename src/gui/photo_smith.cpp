@@ -56,10 +56,14 @@
 #include <QInputDialog>
 #include <QDialog>
 #include <QSlider>
+#include <QComboBox>
+#include <QListWidget>
 #include <QPixmap>
+#include <QPainter>
 #include <QImage>
 #include <QIcon>
 #include <QMenuBar>
+#include <QMenu>
 #include <QStatusBar>
 #include <QFileInfo>
 #include <QDir>
@@ -77,20 +81,37 @@
 #include <QImageCapture>
 #include <QCameraDevice>
 #include <QMediaDevices>
-#include <QVideoWidget>
+#include <QVideoSink>
+#include <QVideoFrame>
+#include <QFutureWatcher>
+#include <QScreen>
+#include <QStandardPaths>
+#include <QtConcurrent/QtConcurrentRun>
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 #include <stack>
 #include <random>
 #include <chrono>
 #include <atomic>
 #include <functional>
+#include <utility>
+#include <memory>
+#include <optional>
 #include "../core/image/Image_Class.h"
+#include "../core/image/ImagePyramid.h"
+#include "../core/image/DirtyRegion.h"
 #include "../core/filters/ImageFilters.h"
+#include "../core/filters/FilterPipeline.h"
 #include "ui_mainwindow.h"
 #include "../core/history/HistoryManager.h"
+#include "../core/history/CommandHistory.h"
 #include "../core/io/ImageIO.h"
+#include "../core/io/ImageLoader.h"
+#include "../core/diagnostics/OperationTrace.h"
 #include "ColorWheelDialog.h"
+#include "DiagnosticsDialog.h"
+#include "QtProgressReporter.h"
 
 /**
  * @class PhotoSmith
@@ -143,9 +164,9 @@ class PhotoSmith : public QMainWindow
     Q_OBJECT
 
 private:
-    // File filter constants for Qt file dialogs
-    static constexpr const char* IMAGE_FILTER = "Image Files (*.png *.jpg *.jpeg *.bmp *.tga);;All Files (*)";
-    static constexpr const char* SAVE_FILTER = "PNG Files (*.png);;JPEG Files (*.jpg);;BMP Files (*.bmp);;All Files (*)";
+    // File filters for Qt file dialogs, listing the formats the built-in codecs handle
+    const QString IMAGE_FILTER = ImageIO::openDialogFilter();
+    const QString SAVE_FILTER = ImageIO::saveDialogFilter();
 
 public:
     /**
@@ -237,6 +258,8 @@ public:
         connect(ui.sunlightButton, &QPushButton::clicked, this, &PhotoSmith::applyEnhanceSunlight);
         connect(ui.fishEyeButton, &QPushButton::clicked, this, &PhotoSmith::applyFishEye);
         connect(ui.cancelButton, &QPushButton::clicked, this, &PhotoSmith::cancelFilter);
+        connect(&filterWatcher, &QFutureWatcher<FilterResult>::finished, this, &PhotoSmith::finishFilter);
+        connect(&saveWatcher, &QFutureWatcher<SaveResult>::finished, this, [this]() { (void)finishSave(); });
         // Wire Skew button in controls section
         connect(ui.skewButton, &QPushButton::clicked, this, &PhotoSmith::applySkew);
         
@@ -247,6 +270,9 @@ public:
         connect(ui.actionResetImage, &QAction::triggered, this, &PhotoSmith::resetImage);
         connect(ui.actionUndo, &QAction::triggered, this, &PhotoSmith::undo);
         connect(ui.actionRedo, &QAction::triggered, this, &PhotoSmith::redo);
+        connect(ui.actionPreviousImage, &QAction::triggered, this, &PhotoSmith::showPreviousImage);
+        connect(ui.actionNextImage, &QAction::triggered, this, &PhotoSmith::showNextImage);
+        connect(ui.actionDiagnostics, &QAction::triggered, this, &PhotoSmith::showDiagnostics);
         connect(ui.actionExit, &QAction::triggered, this, &QWidget::close);
         connect(ui.actionGrayscale, &QAction::triggered, this, &PhotoSmith::applyGrayscale);
         connect(ui.actionBlackWhite, &QAction::triggered, this, &PhotoSmith::applyBlackAndWhite);
@@ -263,6 +289,7 @@ public:
         connect(ui.actionInfrared, &QAction::triggered, this, &PhotoSmith::applyInfrared);
         connect(ui.actionPurpleFilter, &QAction::triggered, this, &PhotoSmith::applyPurpleFilter);
         connect(ui.actionTVFilter, &QAction::triggered, this, &PhotoSmith::applyTVFilter);
+        connect(ui.actionFilterChain, &QAction::triggered, this, &PhotoSmith::applyFilterChain);
         
         // Create status bar
         statusBar()->showMessage("Ready - Drag an image here or click 'Load Image'");
@@ -281,7 +308,32 @@ public:
         ui.imageLabel->installEventFilter(this);
         
         // Initialize image filters
-        imageFilters = new ImageFilters(ui.progressBar, statusBar());
+        progressReporter = new QtProgressReporter(ui.progressBar, statusBar());
+        imageFilters = new ImageFilters(progressReporter);
+        previewFilters = new ImageFilters(nullptr); // Silent: live previews report nothing
+        
+        // Background loader: previews sized for this screen, cached on disk between runs
+        ImageLoaderOptions loaderOptions;
+        if (const QScreen *screen = QGuiApplication::primaryScreen()) {
+            const QSize pixels = screen->size() * screen->devicePixelRatio();
+            loaderOptions.previewWidth = pixels.width();
+            loaderOptions.previewHeight = pixels.height();
+        }
+        const QString cacheRoot = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+        if (!cacheRoot.isEmpty()) loaderOptions.cacheDir = QDir(cacheRoot).filePath("previews").toStdString();
+        imageLoader = std::make_unique<ImageLoader>([this](ImageLoader::Result result) {
+            // Runs on a loader thread: hand the result to the GUI thread
+            QMetaObject::invokeMethod(this, [this, result = std::move(result)]() { finishLoad(result); },
+                                      Qt::QueuedConnection);
+        }, loaderOptions);
+        
+        // Browsing shows previews; the full image is decoded once the user stops on one
+        fullLoadTimer = new QTimer(this);
+        fullLoadTimer->setSingleShot(true);
+        fullLoadTimer->setInterval(300);
+        connect(fullLoadTimer, &QTimer::timeout, this, [this]() {
+            if (!loadingPath.isEmpty()) imageLoader->open(loadingPath.toStdString(), ImageLoader::Level::Full);
+        });
         
         // Initially disable filter buttons
         refreshButtons(false);
@@ -303,7 +355,14 @@ public:
      *       or the application exits.
      */
     ~PhotoSmith() {
+        // Stop a running filter before the ImageFilters instance it uses goes away
+        cancelRequested = true;
+        filterWatcher.waitForFinished();
+        saveWatcher.waitForFinished(); // closeEvent() reported it; a file is never left half-written
+        imageLoader.reset(); // Joins the loader threads; undelivered results are dropped with this window
         delete imageFilters;
+        delete previewFilters;
+        delete progressReporter;
     }
 
 private slots:
@@ -320,6 +379,22 @@ private slots:
         }
     }
     
+    /**
+     * @brief Show the previous image in the current file's directory.
+     */
+    void showPreviousImage()
+    {
+        browse(-1);
+    }
+    
+    /**
+     * @brief Show the next image in the current file's directory.
+     */
+    void showNextImage()
+    {
+        browse(+1);
+    }
+    
     /**
      * @brief Save the current image to a file.
      * 
@@ -331,7 +406,8 @@ private slots:
      * - Checks if an image is currently loaded
      * - Shows a warning if no image is available
      * - Opens a Qt file dialog for save location selection
-     * - Handles file format selection (PNG, JPEG, BMP)
+     * - Handles file format selection (every format ImageIO::saveDialogFilter() lists)
+     * - Writes the file in the background; editing continues meanwhile
      * - Updates the unsaved changes flag on successful save
      * - Provides user feedback through status bar messages
      * ;pl
@@ -350,6 +426,18 @@ private slots:
 
     /**
      * @brief Capture a single frame from the default camera and load it.
+     * 
+     * Shows the camera in a preview dialog. The viewfinder can run a live
+     * point filter (see cameraFilter()) on every frame; the captured photo gets
+     * the same filter, so what is shown is what is loaded.
+     * 
+     * @details Frames and the capture are copied straight from Qt's video
+     * frames into an Image; nothing is encoded or written to disk. The
+     * viewfinder only keeps the newest frame: frames arriving while one is
+     * being filtered replace each other instead of queueing up, so a slow
+     * filter lowers the frame rate rather than adding delay.
+     * 
+     * @see installCapturedImage() for how the photo replaces the current image
      */
     void loadFromCamera()
     {
@@ -364,37 +452,77 @@ private slots:
             // Parent the session to the dialog to ensure it stays alive
             QMediaCaptureSession *session = new QMediaCaptureSession(dlg);
             session->setCamera(camera);
-            QVideoWidget *view = new QVideoWidget(dlg);
-            view->setAspectRatioMode(Qt::KeepAspectRatio);
-            view->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+            QLabel *view = new QLabel(dlg);
+            view->setAlignment(Qt::AlignCenter);
+            view->setSizePolicy(QSizePolicy::Ignored, QSizePolicy::Ignored);
             view->setMinimumSize(640, 480);
-            session->setVideoOutput(view);
+            QVideoSink *sink = new QVideoSink(dlg);
+            session->setVideoSink(sink);
             QImageCapture *imageCapture = new QImageCapture(dlg);
             session->setImageCapture(imageCapture);
 
+            QComboBox *filterCombo = new QComboBox(dlg);
+            filterCombo->addItems({"None", "Grayscale", "Black & White", "Invert", "Infrared", "Purple",
+                                   "Enhance Sunlight", "Darken", "Lighten"});
             QPushButton *captureBtn = new QPushButton("Capture", dlg);
             QPushButton *closeBtn = new QPushButton("Close", dlg);
+            captureBtn->setEnabled(imageCapture->isReadyForCapture());
             QHBoxLayout *btns = new QHBoxLayout();
+            btns->addWidget(new QLabel("Live filter:", dlg));
+            btns->addWidget(filterCombo);
             btns->addStretch(); btns->addWidget(captureBtn); btns->addWidget(closeBtn);
-            layout->addWidget(view);
+            layout->addWidget(view, 1);
             layout->addLayout(btns);
             dlg->resize(900, 700);
 
-            // Temp file
-            QString tempPath = QDir::temp().filePath("photosmith_capture.png");
-            QFile::remove(tempPath);
+            // Shared by the callbacks below; the GUI thread is the only one touching it
+            struct LiveView {
+                FilterPipeline pipeline;
+                QVideoFrame latest;
+                bool scheduled = false;
+            };
+            auto live = std::make_shared<LiveView>();
 
-            QObject::connect(captureBtn, &QPushButton::clicked, dlg, [this, imageCapture, tempPath]() {
-                imageCapture->captureToFile(tempPath);
+            QObject::connect(filterCombo, &QComboBox::currentTextChanged, dlg, [live](const QString &filter) {
+                live->pipeline = cameraFilter(filter);
+            });
+            QObject::connect(sink, &QVideoSink::videoFrameChanged, dlg, [live, view](const QVideoFrame &frame) {
+                live->latest = frame;
+                if (live->scheduled) return;
+                live->scheduled = true;
+                QTimer::singleShot(0, view, [live, view]() {
+                    live->scheduled = false;
+                    Image image = imageFromQImage(std::exchange(live->latest, QVideoFrame()).toImage());
+                    if (image.byteSize() == 0) return;
+                    live->pipeline.apply(image.view());
+                    view->setPixmap(QPixmap::fromImage(
+                        buildQImage(image).scaled(view->size(), Qt::KeepAspectRatio, Qt::FastTransformation)));
+                });
+            });
+            QObject::connect(imageCapture, &QImageCapture::readyForCaptureChanged, captureBtn, &QPushButton::setEnabled);
+            QObject::connect(captureBtn, &QPushButton::clicked, dlg, [imageCapture]() {
+                imageCapture->capture();
             });
             QObject::connect(closeBtn, &QPushButton::clicked, dlg, [camera, dlg]() {
                 camera->stop();
                 dlg->reject();
             });
-            QObject::connect(imageCapture, &QImageCapture::imageSaved, dlg, [this, camera, dlg](int, const QString &filePath){
+            QObject::connect(imageCapture, &QImageCapture::imageAvailable, dlg,
+                             [this, camera, dlg, live](int, const QVideoFrame &frame) {
+                OperationTrace::Stopwatch stopwatch("Camera capture", "io");
+                Image image = imageFromQImage(frame.toImage());
+                if (image.byteSize() == 0) {
+                    QMessageBox::critical(dlg, "Camera Error", "The camera returned an empty image.");
+                    return;
+                }
+                live->pipeline.apply(image.view());
                 camera->stop();
                 dlg->accept();
-                loadImageFromPath(filePath, false);
+                OperationTrace::Record record = stopwatch.stop();
+                record.pixels = pixelCount(image);
+                installCapturedImage(image, live->pipeline.empty() ? QString()
+                                                                   : QString::fromStdString(live->pipeline.description()));
+                recordOperation(std::move(record));
             });
             QObject::connect(imageCapture, &QImageCapture::errorOccurred, dlg, [camera, dlg](int, QImageCapture::Error, const QString &errorString){
                 camera->stop();
@@ -415,6 +543,54 @@ private slots:
             QMessageBox::warning(this, "Camera", "No camera device found.");
         }
     }
+
+    /**
+     * @brief The point filter chosen in the camera dialog, as a pipeline.
+     * 
+     * @param filter Entry of the dialog's "Live filter" list; "None" gives an empty pipeline
+     */
+    static FilterPipeline cameraFilter(const QString &filter)
+    {
+        FilterPipeline pipeline;
+        if (filter == "Grayscale") {
+            pipeline.grayscale();
+        } else if (filter == "Black & White") {
+            pipeline.blackAndWhite();
+        } else if (filter == "Invert") {
+            pipeline.invert();
+        } else if (filter == "Infrared") {
+            pipeline.infrared();
+        } else if (filter == "Purple") {
+            pipeline.purple();
+        } else if (filter == "Enhance Sunlight") {
+            pipeline.sunlight();
+        } else if (filter == "Darken" || filter == "Lighten") {
+            pipeline.darkAndLight(filter == "Darken", 50);
+        }
+        return pipeline;
+    }
+
+    /**
+     * @brief Make a camera photo the current image.
+     * 
+     * @param image Captured pixels, already filtered
+     * @param filterName Description of the live filter applied, or empty
+     * 
+     * The photo replaces the current image like a loaded file, but has no
+     * file yet, so it starts out as unsaved changes. A file load still in
+     * progress is abandoned.
+     */
+    void installCapturedImage(const Image &image, const QString &filterName)
+    {
+        if (!loadingPath.isEmpty()) endLoad();
+        originalImage = image;
+        currentImage = originalImage;
+        hasImage = true;
+        finalizeSuccessfulLoad(QString(), false);
+        hasUnsavedChanges = true;
+        if (!filterName.isEmpty()) ui.activeFilterValue->setText(filterName);
+        statusBar()->showMessage(QString("Captured from camera (%1 x %2)").arg(image.width).arg(image.height));
+    }
     
     /**
      * @brief Unload the current image with optional save confirmation.
@@ -462,7 +638,7 @@ private slots:
         }
         
         if (reply == QMessageBox::Save) {
-            if (!saveImageWithDialog()) {
+            if (!saveImageWithDialog(true)) {
                 return; // Don't unload if save failed or cancelled
             }
         } else if (reply == QMessageBox::Cancel) {
@@ -493,12 +669,9 @@ private slots:
     void applyGrayscale()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() {
-            imageFilters->applyGrayscale(currentImage, preFilterImage, cancelRequested);
-        });
-        setActiveFilterValue("Grayscale");
-        ui.colorModeValue->setText("Grayscale");
-        updatePropertiesPanel();
+        runCancelableFilter("Grayscale", [this](Image& image, Image& before) {
+            imageFilters->applyGrayscale(image, before, cancelRequested);
+        }, [this]() { ui.colorModeValue->setText("Grayscale"); });
     }
     
     /**
@@ -513,11 +686,11 @@ private slots:
     void applyTVFilter()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() {
-            imageFilters->applyTVFilter(currentImage, preFilterImage, cancelRequested);
+        // A fresh seed per run, captured so the command log can replay the same noise
+        const std::uint64_t seed = NoiseSource::randomSeed();
+        runCancelableFilter("TV/CRT Filter", [this, seed](Image& image, Image& before) {
+            imageFilters->applyTVFilter(image, before, cancelRequested, seed);
         });
-        setActiveFilterValue("TV/CRT Filter");
-        updatePropertiesPanel();
     }
     
     /**
@@ -526,14 +699,18 @@ private slots:
      * Restores the current image to the state it was in when first loaded,
      * discarding all modifications made since loading.
      * 
-     * @note This operation does not affect the undo/redo history.
+     * @note The reset is recorded like any other edit, so it can be undone;
+     *       the command log keeps its result, since it is not replayable.
      * @see originalImage for the stored original image state
      */
     void resetImage()
     {
         if (!hasImage) return;
         
-        currentImage = originalImage;
+        // Recorded with its dirty map, so the history and display stay in step with currentImage
+        const DirtyRegion changed = DirtyRegion::between(currentImage, originalImage);
+        saveStateForUndo(originalImage, {}, ReplayInfo{{}, true}, changed);
+        replaceCurrentImage(originalImage, changed);
         updateImageDisplay();
         statusBar()->showMessage("Image reset to original");
         setActiveFilterValue("None");
@@ -552,12 +729,9 @@ private slots:
     void applyBlackAndWhite()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() {
-            imageFilters->applyBlackAndWhite(currentImage, preFilterImage, cancelRequested);
-        });
-        setActiveFilterValue("Black & White");
-        ui.colorModeValue->setText("Grayscale");
-        updatePropertiesPanel();
+        runCancelableFilter("Black & White", [this](Image& image, Image& before) {
+            imageFilters->applyBlackAndWhite(image, before, cancelRequested);
+        }, [this]() { ui.colorModeValue->setText("Grayscale"); });
     }
     
     /**
@@ -572,25 +746,23 @@ private slots:
     void applyInvert()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() {
-            imageFilters->applyInvert(currentImage, preFilterImage, cancelRequested);
-        });
-        setActiveFilterValue("Invert");
-        ui.colorModeValue->setText("RGB");
-        updatePropertiesPanel();
+        FilterCall invert = [this](Image& image, Image& before) {
+            imageFilters->applyInvert(image, before, cancelRequested);
+        };
+        // Inverting twice restores the image
+        runCancelableFilter("Invert", invert, [this]() { ui.colorModeValue->setText("RGB"); }, ReplayInfo{invert, false});
     }
     
     /**
      * @brief Merge the current image with another image.
      * 
-     * Opens a file dialog to select a second image and merges it with the current
-     * image by averaging their pixel values. The resulting image will have the
-     * dimensions of the smaller input image.
+     * Opens a file dialog to select a second image and blends it over the
+     * current image with the chosen mode and opacity.
      * 
      * @details This method:
      * - Opens a file dialog for image selection
      * - Loads the selected image using the Image class
-     * - Merges the images by averaging pixel values
+     * - Blends the images (normal, multiply, screen or overlay)
      * - Handles errors gracefully with user feedback
      * - Updates the display after successful merge
      * 
@@ -614,17 +786,17 @@ private slots:
      * @brief Merge the current image with another image from the specified path.
      * 
      * Loads an image from the given file path and merges it with the current image.
-     * Handles different image dimensions by offering resize options or merging
-     * the common overlapping area.
+     * A merge image of another size is scaled to the current image while it is
+     * blended; alternatively the smaller image is resized to the larger first.
      * 
      * @param fileName Qt string containing the path to the image file to merge
      * 
      * @details This method:
-     * - Saves the current state for undo functionality
      * - Loads the merge image from the specified path
      * - Handles dimension mismatches with user dialog options
-     * - Applies the merge operation using ImageFilters
-     * - Updates the display and properties panel
+     * - Asks for the blend mode and opacity
+     * - Applies the merge operation using ImageFilters on the filter worker
+     * - Saves the previous state for undo once the merge completes
      * - Provides comprehensive error handling
      * 
      * @note This is an immediate operation without progress tracking.
@@ -636,13 +808,12 @@ private slots:
     void mergeWithPath(const QString &fileName)
     {
         try {
-            saveStateForUndo();
-            Image mergeImage;
-            mergeImage.loadNewImage(fileName.toStdString());
+            Image mergeImage = ImageIO::loadFromFile(fileName);
+            bool resizeToLarger = false;
             // If dimensions differ, ask user how to merge
             if (mergeImage.width != currentImage.width || mergeImage.height != currentImage.height) {
                 QStringList options;
-                options << "Resize smaller image to match larger" << "Merge common overlapping area";
+                options << "Scale merged image to this image" << "Resize smaller image to match larger";
                 bool ok = false;
                 QString choice = QInputDialog::getItem(this, "Merge Images",
                     "Images have different sizes. Choose merge option:", options, 0, false, &ok);
@@ -650,24 +821,32 @@ private slots:
                     return; // user cancelled
                 }
 
-                if (choice == options[0]) {
+                resizeToLarger = (choice == options[1]);
+                // else: BlendEngine scales the merge image band by band while blending
+            }
+
+            const QStringList modes = {"Normal", "Multiply", "Screen", "Overlay"};
+            const QString modeName = getInputFromList("Merge Images", "Blend mode:", modes);
+            if (modeName.isEmpty()) return;
+            const BlendEngine::Mode mode = BlendEngine::parse(modeName.toLower().toStdString());
+            bool ok = false;
+            const int opacity = getPercentWithSlider("Merge Images", "Opacity of the merged image", 50, &ok);
+            if (!ok) return;
+
+            runSimpleFilter("Merge", [this, mergeImage, resizeToLarger, mode, opacity](Image& image, Image&) mutable {
+                if (resizeToLarger) {
                     // Resize the smaller image to match the larger image dimensions
-                    const int targetW = std::max((int)currentImage.width, (int)mergeImage.width);
-                    const int targetH = std::max((int)currentImage.height, (int)mergeImage.height);
-                    if (currentImage.width != targetW || currentImage.height != targetH) {
-                        imageFilters->applyResize(currentImage, targetW, targetH);
+                    const int targetW = std::max((int)image.width, (int)mergeImage.width);
+                    const int targetH = std::max((int)image.height, (int)mergeImage.height);
+                    if (image.width != targetW || image.height != targetH) {
+                        imageFilters->applyResize(image, targetW, targetH);
                     }
                     if (mergeImage.width != targetW || mergeImage.height != targetH) {
                         imageFilters->applyResize(mergeImage, targetW, targetH);
                     }
                 }
-                // else: Merge common overlapping area by default behavior below
-            }
-
-            imageFilters->applyMerge(currentImage, mergeImage);
-            updateImageDisplay();
-            setActiveFilterValue("Merge");
-            updatePropertiesPanel();
+                imageFilters->applyMerge(image, mergeImage, mode, opacity);
+            }, {}, ReplayInfo{{}, true}); // Keep the result, not a second copy of mergeImage
         } catch (const std::exception& e) {
             QMessageBox::critical(this, "Error", QString("Merge failed: %1").arg(e.what()));
         }
@@ -701,16 +880,10 @@ private slots:
         QString choice = getInputFromList("Flip Image", "Choose flip direction:", options);
         
         if (!choice.isEmpty()) {
-            saveStateForUndo();
-            
-            try {
-                imageFilters->applyFlip(currentImage, choice);
-                updateImageDisplay();
-                setActiveFilterValue("Flip");
-                updatePropertiesPanel();
-            } catch (const std::exception& e) {
-                QMessageBox::critical(this, "Error", QString("Filter failed: %1").arg(e.what()));
-            }
+            FilterCall flip = [this, direction = choice.toStdString()](Image& image, Image&) {
+                imageFilters->applyFlip(image, direction);
+            };
+            runSimpleFilter("Flip", flip, {}, ReplayInfo{flip, false});
         }
     }
     
@@ -764,16 +937,16 @@ private slots:
         
         if (dialog.exec() != QDialog::Accepted) return;
         
-        saveStateForUndo();
-        
-        try {
-            imageFilters->applyRotate(currentImage, chosenAngle);
-            updateImageDisplay();
-            setActiveFilterValue("Rotate");
-            updatePropertiesPanel();
-        } catch (const std::exception& e) {
-            QMessageBox::critical(this, "Error", QString("Filter failed: %1").arg(e.what()));
+        // Quarter turns are undone exactly by turning back
+        ReplayInfo replay{};
+        if (chosenAngle % 90 == 0) {
+            replay.inverse = [this, chosenAngle](Image& image, Image&) {
+                imageFilters->applyRotate(image, (360 - chosenAngle) % 360);
+            };
         }
+        runSimpleFilter("Rotate", [this, chosenAngle](Image& image, Image&) {
+            imageFilters->applyRotate(image, chosenAngle);
+        }, {}, std::move(replay));
     }
     
     /**
@@ -786,7 +959,8 @@ private slots:
      * @details This method:
      * - Validates that an image is currently loaded
      * - Shows a selection dialog for dark/light choice
-     * - Shows a slider dialog for intensity percentage (0-100%)
+     * - Shows a slider dialog for intensity percentage (0-100%), previewing
+     *   each value live on a screen-sized proxy
      * - Applies the brightness adjustment using ImageFilters
      * - Updates the display and properties panel
      * - Handles user cancellation gracefully
@@ -805,17 +979,21 @@ private slots:
         QString choice = getInputFromList("Darken or Lighten", "Choose:", options);
         if (choice.isEmpty()) return;
 
-        // Ask for percentage 0-100 via slider dialog
+        // Ask for percentage 0-100 via slider dialog, previewing each value
         bool ok = false;
-        int percent = getPercentWithSlider("Adjust Brightness", choice == "dark" ? "Darken percentage" : "Lighten percentage", 50, &ok);
+        beginPreview();
+        int percent = getPercentWithSlider("Adjust Brightness", choice == "dark" ? "Darken percentage" : "Lighten percentage", 50, &ok,
+            [this, mode = choice.toStdString()](int value) {
+                showPreview([this, mode, value](Image& image, Image&) {
+                    previewFilters->applyDarkAndLight(image, mode, value);
+                });
+            });
+        endPreview();
         if (!ok) return;
 
-        runSimpleFilter([&]() {
-            imageFilters->applyDarkAndLight(currentImage, choice, percent);
-        });
-        setActiveFilterValue("Dark & Light");
-        ui.colorModeValue->setText("RGB");
-        updatePropertiesPanel();
+        runSimpleFilter("Dark & Light", [this, mode = choice.toStdString(), percent](Image& image, Image&) {
+            imageFilters->applyDarkAndLight(image, mode, percent);
+        }, [this]() { ui.colorModeValue->setText("RGB"); });
     }
     
     /**
@@ -826,7 +1004,8 @@ private slots:
      * 
      * @details This method:
      * - Validates that an image is currently loaded
-     * - Shows a selection dialog with multiple frame options
+     * - Shows a selection dialog with multiple frame options, previewing the
+     *   current choice live on a screen-sized proxy
      * - Applies the selected frame using ImageFilters
      * - Updates the display and properties panel
      * - Handles user cancellation gracefully
@@ -849,17 +1028,32 @@ private slots:
         // Always use color wheel for all frame types - they're all customizable now!
         // Pass image dimensions to calculate default frame width
         ColorWheelDialog colorDialog(this, QColor(0, 0, 255), true, currentImage.width, currentImage.height);
-        if (colorDialog.exec() == QDialog::Accepted) {
+        
+        // Preview the current choice live while the dialog is open
+        beginPreview();
+        QTimer *previewTimer = makePreviewTimer(&colorDialog, [this, &colorDialog]() {
+            int r, g, b;
+            colorDialog.getRGB(r, g, b);
+            const std::string frameType = colorDialog.getFrameType().toStdString();
+            const int frameWidth = colorDialog.getFrameWidth();
+            showPreview([this, frameType, frameWidth, r, g, b](Image& image, Image&) {
+                previewFilters->applyFrame(image, frameType, frameWidth, r, g, b);
+            });
+        });
+        connect(&colorDialog, &ColorWheelDialog::selectionChanged, previewTimer, qOverload<>(&QTimer::start));
+        const bool accepted = colorDialog.exec() == QDialog::Accepted;
+        endPreview();
+        
+        if (accepted) {
             int r, g, b;
             colorDialog.getRGB(r, g, b);
             QString frameType = colorDialog.getFrameType();
             int frameWidth = colorDialog.getFrameWidth();
             
-            runSimpleFilter([&]() {
-                imageFilters->applyFrame(currentImage, frameType, frameWidth, r, g, b);
+            runSimpleFilter(QString("%1 (RGB: %2, %3, %4)").arg(frameType).arg(r).arg(g).arg(b),
+                            [this, frame = frameType.toStdString(), frameWidth, r, g, b](Image& image, Image&) {
+                imageFilters->applyFrame(image, frame, frameWidth, r, g, b);
             });
-            setActiveFilterValue(QString("%1 (RGB: %2, %3, %4)").arg(frameType).arg(r).arg(g).arg(b));
-            updatePropertiesPanel();
         }
     }
     
@@ -881,29 +1075,37 @@ private slots:
      * 3. Uses 3x3 Sobel kernels for edge detection
      * 4. Calculates gradient magnitude and applies threshold
      * 
+     * The user picks hard black-and-white edges or the gradient strength as
+     * shades of grey.
+     * 
      * @note This is an immediate operation without progress tracking.
      * @see ImageFilters::applyEdges() for the actual edge detection implementation
      */
     void applyEdges()
     {
         if (!hasImage) return;
-        runSimpleFilter([&]() {
-            imageFilters->applyEdges(currentImage);
+        
+        const QStringList outputs = {"Threshold (black & white)", "Magnitude (shades of grey)"};
+        const QString choice = getInputFromList("Edge Detection", "Edge output:", outputs);
+        if (choice.isEmpty()) return;
+        const EdgeEngine::Output output = outputs.indexOf(choice) == 0 ? EdgeEngine::Output::Threshold
+                                                                       : EdgeEngine::Output::Magnitude;
+        runSimpleFilter("Edge Detection", [this, output](Image& image, Image&) {
+            imageFilters->applyEdges(image, output);
         });
-        setActiveFilterValue("Edge Detection");
-        updatePropertiesPanel();
     }
     
     /**
      * @brief Resize the current image to specified dimensions.
      * 
      * Presents dialogs to the user to input new width and height values,
-     * then resizes the current image using nearest-neighbor interpolation.
+     * then resizes the current image with the resampling filter the user picks.
      * 
      * @details This method:
      * - Validates that an image is currently loaded
      * - Shows input dialogs for width and height (1-10000 pixels)
      * - Uses current image dimensions as default values
+     * - Asks for the resampling filter (Lanczos, bicubic, bilinear, box, nearest)
      * - Applies resize transformation using ImageFilters
      * - Updates the display and properties panel
      * - Handles user cancellation gracefully
@@ -922,13 +1124,19 @@ private slots:
         int height = QInputDialog::getInt(this, "Resize Image", "Enter new height:", 
             currentImage.height, 1, 10000, 1, &ok2);
         
-        if (ok1 && ok2) {
-            runSimpleFilter([&]() {
-                imageFilters->applyResize(currentImage, width, height);
-            });
-            setActiveFilterValue("Resize");
-            updatePropertiesPanel();
-        }
+        if (!ok1 || !ok2) return;
+        
+        const QStringList filters = {"Lanczos (sharpest)", "Bicubic", "Bilinear", "Box (area average)",
+                                     "Nearest neighbor"};
+        const QString choice = getInputFromList("Resize Image", "Resampling filter:", filters);
+        if (choice.isEmpty()) return;
+        const Resampler::Filter kinds[] = {Resampler::Filter::Lanczos3, Resampler::Filter::Bicubic,
+                                           Resampler::Filter::Bilinear, Resampler::Filter::Box,
+                                           Resampler::Filter::Nearest};
+        const Resampler::Filter filter = kinds[filters.indexOf(choice)];
+        runSimpleFilter("Resize", [this, width, height, filter](Image& image, Image&) {
+            imageFilters->applyResize(image, width, height, filter);
+        });
     }
     
     /**
@@ -940,7 +1148,9 @@ private slots:
      * 
      * @details This method:
      * - Validates that an image is currently loaded
-     * - Shows a slider dialog for blur strength (0-100%)
+     * - Lets the user pick a box or Gaussian blur style
+     * - Shows a slider dialog for blur strength (0-100%), previewing each
+     *   value live on a screen-sized proxy
      * - Uses 60% as the default blur strength
      * - Applies blur with progress tracking and cancellation support
      * - Updates the display and properties panel
@@ -953,15 +1163,30 @@ private slots:
     void applyBlur()
     {
         if (!hasImage) return;
-        // Ask user for blur strength 0..100
+        QString style = getInputFromList("Blur Style", "Choose blur style:", {"Box", "Gaussian"});
+        if (style.isEmpty()) return;
+        bool gaussian = (style == "Gaussian");
+        // Ask user for blur strength 0..100, previewing each value
         bool ok = false;
-        int percent = getPercentWithSlider("Blur Strength", "Choose blur level (0-100%)", 60, &ok);
+        beginPreview();
+        int percent = getPercentWithSlider("Blur Strength", "Choose blur level (0-100%)", 60, &ok, [this, gaussian](int value) {
+            showPreview([this, gaussian, value](Image& image, Image& before) {
+                if (gaussian) {
+                    previewFilters->applyGaussianBlur(image, before, previewCancelRequested, value);
+                } else {
+                    previewFilters->applyBlur(image, before, previewCancelRequested, value);
+                }
+            });
+        });
+        endPreview();
         if (!ok) return;
-        runCancelableFilter([&]() {
-            imageFilters->applyBlur(currentImage, preFilterImage, cancelRequested, percent);
+        runCancelableFilter(gaussian ? "Gaussian Blur" : "Blur", [this, gaussian, percent](Image& image, Image& before) {
+            if (gaussian) {
+                imageFilters->applyGaussianBlur(image, before, cancelRequested, percent);
+            } else {
+                imageFilters->applyBlur(image, before, cancelRequested, percent);
+            }
         });
-        setActiveFilterValue("Blur");
-        updatePropertiesPanel();
     }
     
     /**
@@ -970,11 +1195,9 @@ private slots:
     void applyInfrared()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() {
-            imageFilters->applyInfrared(currentImage, preFilterImage, cancelRequested);
+        runCancelableFilter("Infrared", [this](Image& image, Image& before) {
+            imageFilters->applyInfrared(image, before, cancelRequested);
         });
-        setActiveFilterValue("Infrared");
-        updatePropertiesPanel();
     }
     
     /**
@@ -991,55 +1214,195 @@ private slots:
             int r, g, b;
             colorDialog.getRGB(r, g, b);
             
-            // Ask for intensity
+            // Ask for intensity, previewing each value
             bool ok = false;
+            beginPreview();
             int intensityPercent = getPercentWithSlider("Color Tint Intensity", 
-                                                       "Choose tint intensity (0-100%)", 50, &ok);
+                                                       "Choose tint intensity (0-100%)", 50, &ok, [this, r, g, b](int value) {
+                showPreview([this, r, g, b, value](Image& image, Image& before) {
+                    previewFilters->applyColorTint(image, before, previewCancelRequested, r, g, b, value / 100.0);
+                });
+            });
+            endPreview();
             if (!ok) return;
             
             double intensity = intensityPercent / 100.0;
             
-            runCancelableFilter([&]() {
-                imageFilters->applyColorTint(currentImage, preFilterImage, cancelRequested, r, g, b, intensity);
+            runCancelableFilter(QString("Color Tint (RGB: %1, %2, %3)").arg(r).arg(g).arg(b),
+                                [this, r, g, b, intensity](Image& image, Image& before) {
+                imageFilters->applyColorTint(image, before, cancelRequested, r, g, b, intensity);
             });
-            setActiveFilterValue(QString("Color Tint (RGB: %1, %2, %3)").arg(r).arg(g).arg(b));
-            updatePropertiesPanel();
         }
     }
+    
+    /**
+     * @brief Build a chain of point filters and apply it as a single step.
+     * 
+     * Presents a dialog where the user adds colour filters (grayscale, black & white,
+     * invert, infrared, purple, sunlight, dark & light, colour tint) in order. The
+     * chain runs in one fused pass over the image and creates one undo entry.
+     * 
+     * @details This method:
+     * - Validates that an image is currently loaded
+     * - Asks for each filter's parameters as it is added to the chain
+     * - Applies the whole chain with progress tracking and cancellation
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     * @see FilterPipeline for the fused execution
+     * @see ImageFilters::applyPipeline() for implementation details
+     */
+    void applyFilterChain()
+    {
+        if (!hasImage) return;
+        
+        FilterPipeline pipeline;
+        QDialog dialog(this);
+        dialog.setWindowTitle("Filter Chain");
+        QVBoxLayout *layout = new QVBoxLayout(&dialog);
+        QListWidget *stepList = new QListWidget(&dialog);
+        QComboBox *filterCombo = new QComboBox(&dialog);
+        filterCombo->addItems({"Grayscale", "Black & White", "Invert", "Infrared", "Purple",
+                               "Enhance Sunlight", "Dark & Light", "Color Tint"});
+        QPushButton *addBtn = new QPushButton("Add", &dialog);
+        QPushButton *clearBtn = new QPushButton("Clear", &dialog);
+        QHBoxLayout *editRow = new QHBoxLayout();
+        editRow->addWidget(filterCombo, 1);
+        editRow->addWidget(addBtn);
+        editRow->addWidget(clearBtn);
+        QHBoxLayout *buttons = new QHBoxLayout();
+        QPushButton *okBtn = new QPushButton("Apply", &dialog);
+        QPushButton *cancelBtn = new QPushButton("Cancel", &dialog);
+        okBtn->setEnabled(false);
+        buttons->addStretch();
+        buttons->addWidget(okBtn);
+        buttons->addWidget(cancelBtn);
+        layout->addWidget(new QLabel("Filters are applied top to bottom:", &dialog));
+        layout->addWidget(stepList);
+        layout->addLayout(editRow);
+        layout->addLayout(buttons);
+        
+        QObject::connect(addBtn, &QPushButton::clicked, &dialog, [&]() {
+            const QString filter = filterCombo->currentText();
+            if (filter == "Grayscale") {
+                pipeline.grayscale();
+            } else if (filter == "Black & White") {
+                pipeline.blackAndWhite();
+            } else if (filter == "Invert") {
+                pipeline.invert();
+            } else if (filter == "Infrared") {
+                pipeline.infrared();
+            } else if (filter == "Purple") {
+                pipeline.purple();
+            } else if (filter == "Enhance Sunlight") {
+                pipeline.sunlight();
+            } else if (filter == "Dark & Light") {
+                QString choice = getInputFromList("Darken or Lighten", "Choose:", {"dark", "light"});
+                if (choice.isEmpty()) return;
+                bool ok = false;
+                int percent = getPercentWithSlider("Adjust Brightness", choice == "dark" ? "Darken percentage" : "Lighten percentage", 50, &ok);
+                if (!ok) return;
+                pipeline.darkAndLight(choice == "dark", percent);
+            } else if (filter == "Color Tint") {
+                ColorWheelDialog colorDialog(&dialog, QColor(128, 0, 255));
+                if (colorDialog.exec() != QDialog::Accepted) return;
+                int r, g, b;
+                colorDialog.getRGB(r, g, b);
+                bool ok = false;
+                int intensityPercent = getPercentWithSlider("Color Tint Intensity",
+                                                           "Choose tint intensity (0-100%)", 50, &ok);
+                if (!ok) return;
+                pipeline.colorTint(r, g, b, intensityPercent / 100.0);
+            }
+            stepList->addItem(QString::fromStdString(pipeline.steps().back().name));
+            okBtn->setEnabled(true);
+        });
+        QObject::connect(clearBtn, &QPushButton::clicked, &dialog, [&]() {
+            pipeline.clear();
+            stepList->clear();
+            okBtn->setEnabled(false);
+        });
+        QObject::connect(okBtn, &QPushButton::clicked, &dialog, &QDialog::accept);
+        QObject::connect(cancelBtn, &QPushButton::clicked, &dialog, &QDialog::reject);
+        
+        if (dialog.exec() != QDialog::Accepted || pipeline.empty()) return;
+        
+        runCancelableFilter("Filter Chain", [this, pipeline](Image& image, Image& before) {
+            imageFilters->applyPipeline(image, before, cancelRequested, pipeline);
+        });
+    }
     void applyEmboss()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() { imageFilters->applyEmboss(currentImage, preFilterImage, cancelRequested); });
-        setActiveFilterValue("Emboss");
-        updatePropertiesPanel();
+        runCancelableFilter("Emboss", [this](Image& image, Image& before) { imageFilters->applyEmboss(image, before, cancelRequested); });
     }
     void applyDoubleVision()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() { imageFilters->applyDoubleVision(currentImage, preFilterImage, cancelRequested, 15); });
-        setActiveFilterValue("Double Vision");
-        updatePropertiesPanel();
+        runCancelableFilter("Double Vision", [this](Image& image, Image& before) { imageFilters->applyDoubleVision(image, before, cancelRequested, 15); });
     }
+    /**
+     * @brief Apply the oil painting effect with a brush radius and intensity chosen via sliders.
+     * 
+     * The radius sets the brush size in pixels; the intensity sets how many
+     * brightness values share one paint level (higher is flatter). Cost does
+     * not grow with the radius, so large brushes are practical.
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     * @see ImageFilters::applyOilPainting() for implementation details
+     */
     void applyOilPainting()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() { imageFilters->applyOilPainting(currentImage, preFilterImage, cancelRequested, 3, 30); });
-        setActiveFilterValue("Oil Painting");
-        updatePropertiesPanel();
+        
+        QDialog dialog(this);
+        dialog.setWindowTitle("Oil Painting");
+        QVBoxLayout *layout = new QVBoxLayout(&dialog);
+        QLabel *radiusLabel = new QLabel(&dialog);
+        QSlider *radiusSlider = new QSlider(Qt::Horizontal, &dialog);
+        radiusSlider->setRange(1, 30);
+        radiusSlider->setValue(3);
+        QLabel *intensityLabel = new QLabel(&dialog);
+        QSlider *intensitySlider = new QSlider(Qt::Horizontal, &dialog);
+        intensitySlider->setRange(1, 100);
+        intensitySlider->setValue(30);
+        auto updateLabels = [=]() {
+            radiusLabel->setText(QString("Brush radius: %1 px").arg(radiusSlider->value()));
+            intensityLabel->setText(QString("Intensity: %1").arg(intensitySlider->value()));
+        };
+        updateLabels();
+        QObject::connect(radiusSlider, &QSlider::valueChanged, &dialog, updateLabels);
+        QObject::connect(intensitySlider, &QSlider::valueChanged, &dialog, updateLabels);
+        QHBoxLayout *buttons = new QHBoxLayout();
+        QPushButton *okBtn = new QPushButton("OK", &dialog);
+        QPushButton *cancelBtn = new QPushButton("Cancel", &dialog);
+        buttons->addStretch();
+        buttons->addWidget(okBtn);
+        buttons->addWidget(cancelBtn);
+        layout->addWidget(radiusLabel);
+        layout->addWidget(radiusSlider);
+        layout->addWidget(intensityLabel);
+        layout->addWidget(intensitySlider);
+        layout->addLayout(buttons);
+        QObject::connect(okBtn, &QPushButton::clicked, &dialog, &QDialog::accept);
+        QObject::connect(cancelBtn, &QPushButton::clicked, &dialog, &QDialog::reject);
+        
+        if (dialog.exec() != QDialog::Accepted) return;
+        
+        const int radius = radiusSlider->value();
+        const int intensity = intensitySlider->value();
+        runCancelableFilter("Oil Painting", [this, radius, intensity](Image& image, Image& before) {
+            imageFilters->applyOilPainting(image, before, cancelRequested, radius, intensity);
+        });
     }
     void applyEnhanceSunlight()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() { imageFilters->applyEnhanceSunlight(currentImage, preFilterImage, cancelRequested); });
-        setActiveFilterValue("Enhance Sunlight");
-        updatePropertiesPanel();
+        runCancelableFilter("Enhance Sunlight", [this](Image& image, Image& before) { imageFilters->applyEnhanceSunlight(image, before, cancelRequested); });
     }
     void applyFishEye()
     {
         if (!hasImage) return;
-        runCancelableFilter([&]() { imageFilters->applyFishEye(currentImage, preFilterImage, cancelRequested); });
-        setActiveFilterValue("Fish-Eye");
-        updatePropertiesPanel();
+        runCancelableFilter("Fish-Eye", [this](Image& image, Image& before) { imageFilters->applyFishEye(image, before, cancelRequested); });
     }
     
     /**
@@ -1077,11 +1440,9 @@ private slots:
 
         if (dialog.exec() != QDialog::Accepted) return;
 
-        runSimpleFilter([&]() {
-            imageFilters->applySkew(currentImage, chosenAngle);
+        runSimpleFilter("Skew", [this, chosenAngle](Image& image, Image&) {
+            imageFilters->applySkew(image, chosenAngle);
         });
-        setActiveFilterValue("Skew");
-        updatePropertiesPanel();
     }
     
     /**
@@ -1103,13 +1464,18 @@ private slots:
     void undo()
     {
         if (!hasImage) return;
-        if (!history.undo(currentImage)) return;
-        // Manage parallel filter name history
-        redoFilterNames.push(ui.activeFilterValue->text());
-        if (!undoFilterNames.empty()) {
-            setActiveFilterValue(undoFilterNames.top());
-            undoFilterNames.pop();
+        if (commandLogUndo) {
+            startHistoryMove(-1);
+            return;
         }
+        OperationTrace::Stopwatch stopwatch("Undo", "history", pixelCount(currentImage));
+        Image restored = currentImage; // O(1); currentImage keeps the displayed state until replaced
+        DirtyRegion changed;
+        if (!history.undo(restored, &changed)) return;
+        replaceCurrentImage(std::move(restored), changed);
+        recordOperation(stopwatch.stop());
+        // Manage parallel filter name history
+        moveActiveFilterName(undoFilterNames, redoFilterNames);
         
         updateImageDisplay();
         updateUndoRedoButtons();
@@ -1122,13 +1488,18 @@ private slots:
     void redo()
     {
         if (!hasImage) return;
-        if (!history.redo(currentImage)) return;
-        // Manage parallel filter name history
-        undoFilterNames.push(ui.activeFilterValue->text());
-        if (!redoFilterNames.empty()) {
-            setActiveFilterValue(redoFilterNames.top());
-            redoFilterNames.pop();
+        if (commandLogUndo) {
+            startHistoryMove(+1);
+            return;
         }
+        OperationTrace::Stopwatch stopwatch("Redo", "history", pixelCount(currentImage));
+        Image restored = currentImage;
+        DirtyRegion changed;
+        if (!history.redo(restored, &changed)) return;
+        replaceCurrentImage(std::move(restored), changed);
+        recordOperation(stopwatch.stop());
+        // Manage parallel filter name history
+        moveActiveFilterName(redoFilterNames, undoFilterNames);
         
         updateImageDisplay();
         updateUndoRedoButtons();
@@ -1144,17 +1515,75 @@ private slots:
         statusBar()->showMessage("Cancelling filter...");
     }
 
+    /**
+     * @brief Show the diagnostics panel with recent operation timings.
+     */
+    void showDiagnostics()
+    {
+        if (!diagnosticsDialog) {
+            diagnosticsDialog = new DiagnosticsDialog(operationTrace, [this]() { return historyMemory(); }, this);
+        }
+        diagnosticsDialog->show();
+        diagnosticsDialog->raise();
+        diagnosticsDialog->activateWindow();
+    }
+
 private:
     Ui::MainWindow ui;
     
+    /**
+     * @brief Outcome of a filter run on the worker thread.
+     */
+    struct FilterResult {
+        Image image;                  ///< Filtered image (the pre-filter image if cancelled)
+        DirtyRegion changed;          ///< Tiles in which the filtered image differs from the pre-filter one
+        QString error;                ///< Exception message; empty on success
+        OperationTrace::Record trace; ///< Timing and memory of the run, logged by the GUI thread
+    };
+    /**
+     * @brief Outcome of a save run on the worker thread.
+     */
+    struct SaveResult {
+        QString error;                ///< Exception message; empty on success
+        OperationTrace::Record trace; ///< Timing and memory of the encode
+    };
+    /**
+     * @brief Filter applied to the worker's copy of the image.
+     * 
+     * Receives the working image and the pre-filter snapshot used to restore
+     * it on cancellation. Everything it needs must be captured by value.
+     */
+    using FilterCall = std::function<void(Image &image, Image &before)>;
+    /**
+     * @brief How the command-log history may rebuild a filter's result.
+     * 
+     * Value-initialised ({}) it describes a replayable filter without an inverse.
+     */
+    struct ReplayInfo {
+        FilterCall inverse; ///< Exact inverse of the filter; empty if none
+        bool keepResult;    ///< True if the result is not a pure function of the input
+    };
+    
     /**
      * @brief Push current image state onto the undo stack and mark unsaved changes.
+     * 
+     * @param result The image about to replace the current one
+     * @param operation The filter that turned the current image into @p result;
+     *        the command log replays it instead of storing pixels
+     * @param replay How the command log may rebuild or invert the edit
+     * @param changed Where @p result differs from the current image, if known;
+     *        the delta history packs only those rows
      */
-    void saveStateForUndo()
+    void saveStateForUndo(const Image &result, const FilterCall &operation = {}, const ReplayInfo &replay = {},
+                          const DirtyRegion &changed = {})
     {
         if (!hasImage) return;
         // Save current state to history
-        history.pushUndo(currentImage);
+        if (commandLogUndo) {
+            commandHistory.record(currentImage, makeHistoryStep(operation, replay), result);
+        } else {
+            history.pushUndo(currentImage, changed);
+        }
         // Mark as having unsaved changes
         hasUnsavedChanges = true;
         // Track active filter name in parallel with history
@@ -1170,8 +1599,107 @@ private:
      */
     void updateUndoRedoButtons()
     {
-        ui.undoButton->setEnabled(history.canUndo());
-        ui.redoButton->setEnabled(history.canRedo());
+        ui.undoButton->setEnabled(commandLogUndo ? commandHistory.canUndo() : history.canUndo());
+        ui.redoButton->setEnabled(commandLogUndo ? commandHistory.canRedo() : history.canRedo());
+    }
+
+    /**
+     * @brief Wrap a filter and its replay information as a command-log step.
+     * 
+     * @param operation The filter that produced the edit (may be empty)
+     * @param replay Whether the filter can be replayed, and its exact inverse
+     * @return The step; its apply is empty when the edit cannot be replayed
+     */
+    static CommandHistory::Step makeHistoryStep(const FilterCall &operation, const ReplayInfo &replay)
+    {
+        auto wrap = [](FilterCall call) -> CommandHistory::Operation {
+            return [call = std::move(call)](Image &image) {
+                Image before = image; // O(1): shares the buffer copy-on-write
+                call(image, before);
+            };
+        };
+        CommandHistory::Step step;
+        if (operation && !replay.keepResult) step.apply = wrap(operation);
+        if (replay.inverse) step.inverse = wrap(replay.inverse);
+        return step;
+    }
+
+    /**
+     * @brief Move the active filter name across the parallel name stacks.
+     * 
+     * @param from Stack holding the name of the state being restored
+     * @param to Stack receiving the name of the state being left
+     */
+    void moveActiveFilterName(std::stack<QString> &from, std::stack<QString> &to)
+    {
+        to.push(ui.activeFilterValue->text());
+        if (!from.empty()) {
+            setActiveFilterValue(from.top());
+            from.pop();
+        }
+    }
+
+    /**
+     * @brief Rebuild the previous or next command-log state on a worker thread.
+     * 
+     * Replaying can take as long as a filter, so it runs like one: the UI is
+     * locked and finishFilter() swaps in the rebuilt image.
+     * 
+     * @param direction -1 to undo, +1 to redo
+     */
+    void startHistoryMove(int direction)
+    {
+        if (filterRunning) return;
+        if (direction < 0 ? !commandHistory.canUndo() : !commandHistory.canRedo()) return;
+        cancelRequested = false;
+        pendingHistoryMove = direction;
+        pendingHistoryTarget = direction < 0 ? commandHistory.position() - 1 : commandHistory.position() + 1;
+        setFilterRunning(true, false);
+        statusBar()->showMessage(direction < 0 ? "Undoing..." : "Redoing...");
+
+        // stateAt() is const, and the history is not touched until the result arrives
+        filterWatcher.setFuture(QtConcurrent::run(
+            [this, target = pendingHistoryTarget, image = currentImage, direction]() {
+                OperationTrace::Stopwatch stopwatch(direction < 0 ? "Undo" : "Redo", "history", pixelCount(image));
+                FilterResult result;
+                try {
+                    result.image = commandHistory.stateAt(target, image);
+                } catch (const std::exception& e) {
+                    result.error = QString::fromUtf8(e.what());
+                }
+                result.trace = stopwatch.stop();
+                return result;
+            }));
+    }
+
+    /**
+     * @brief Apply a command-log state rebuilt by startHistoryMove().
+     * 
+     * @param result The rebuilt image, or the error that prevented it
+     */
+    void finishHistoryMove(FilterResult &result)
+    {
+        const int direction = pendingHistoryMove;
+        pendingHistoryMove = 0;
+        if (!result.error.isEmpty()) {
+            recordOperation(std::move(result.trace), "failed");
+            QMessageBox::critical(this, "Error", QString("%1 failed: %2").arg(direction < 0 ? "Undo" : "Redo", result.error));
+            return;
+        }
+
+        currentImage = std::move(result.image);
+        commandHistory.moveTo(pendingHistoryTarget, currentImage);
+        recordOperation(std::move(result.trace));
+        if (direction < 0) {
+            moveActiveFilterName(undoFilterNames, redoFilterNames);
+        } else {
+            moveActiveFilterName(redoFilterNames, undoFilterNames);
+        }
+
+        updateImageDisplay();
+        updateUndoRedoButtons();
+        updatePropertiesPanel();
+        statusBar()->showMessage(direction < 0 ? "Undo applied" : "Redo applied");
     }
 
     /**
@@ -1236,13 +1764,14 @@ protected:
      */
     void closeEvent(QCloseEvent *event) override
     {
+        (void)waitForSave(); // A failed save leaves the changes unsaved, so the question below follows
         if (hasImage && hasUnsavedChanges) {
             QMessageBox::StandardButton reply = QMessageBox::question(this, "Save Changes",
                 "The image has unsaved changes. Do you want to save before exiting?",
                 QMessageBox::Save | QMessageBox::Discard | QMessageBox::Cancel);
             
             if (reply == QMessageBox::Save) {
-                if (saveImageWithDialog()) {
+                if (saveImageWithDialog(true)) {
                     event->accept();
                 } else {
                     event->ignore();
@@ -1266,7 +1795,7 @@ protected:
     {
         QMainWindow::resizeEvent(event);
         // Use timer to avoid too many updates during rapid resizing
-        if (hasImage) {
+        if (hasImage || !loadingPath.isEmpty()) {
             resizeTimer->start();
         }
     }
@@ -1276,6 +1805,10 @@ protected:
      */
     void dragEnterEvent(QDragEnterEvent *event) override
     {
+        if (filterRunning) {
+            event->ignore();
+            return;
+        }
         if (event->mimeData()->hasUrls()) {
             QList<QUrl> urls = event->mimeData()->urls();
             if (!urls.isEmpty()) {
@@ -1284,8 +1817,7 @@ protected:
                 QString suffix = fileInfo.suffix().toLower();
                 
                 // Check if it's a supported image format
-                if (suffix == "png" || suffix == "jpg" || suffix == "jpeg" || 
-                    suffix == "bmp" || suffix == "tga") {
+                if (ImageIO::isSupportedSuffix(suffix)) {
                     event->acceptProposedAction();
                     if (hasImage) {
                         statusBar()->showMessage("Drop image to merge: " + fileInfo.fileName());
@@ -1323,6 +1855,10 @@ protected:
      */
     void dropEvent(QDropEvent *event) override
     {
+        if (filterRunning) {
+            event->ignore();
+            return;
+        }
         if (event->mimeData()->hasUrls()) {
             QList<QUrl> urls = event->mimeData()->urls();
             if (!urls.isEmpty()) {
@@ -1331,8 +1867,7 @@ protected:
                 QString suffix = fileInfo.suffix().toLower();
                 
                 // Check if it's a supported image format
-                if (suffix == "png" || suffix == "jpg" || suffix == "jpeg" || 
-                    suffix == "bmp" || suffix == "tga") {
+                if (ImageIO::isSupportedSuffix(suffix)) {
                     
                     event->acceptProposedAction();
                     if (hasImage) {
@@ -1352,7 +1887,7 @@ protected:
     
     bool eventFilter(QObject *watched, QEvent *event) override
     {
-        if (watched == ui.imageLabel && cropping && hasImage) {
+        if (watched == ui.imageLabel && cropping && hasImage && !filterRunning) {
             if (event->type() == QEvent::MouseButtonPress) {
                 QMouseEvent *me = static_cast<QMouseEvent*>(event);
                 cropOrigin = me->pos();
@@ -1386,9 +1921,13 @@ protected:
      * Updates the status bar with detailed image information.
      * 
      * @details This method:
-     * - Converts the Image object to QPixmap for display
      * - Calculates optimal display size maintaining aspect ratio
-     * - Scales the image with smooth transformation
+     * - Reuses the cached display pixmap when neither the image nor the
+     *   display size changed (e.g. repeated resize timer ticks)
+     * - After an edit with a known dirty region (replaceCurrentImage()),
+     *   resamples and repaints only the pixmap pixels the changed tiles reach
+     * - Otherwise resamples the nearest pyramid level to the target size
+     *   (box filter, ImagePyramid::scaled()) and wraps it without a copy
      * - Updates the image label with the scaled pixmap
      * - Resizes the label to match the scaled image
      * - Updates the minimum window size to prevent scrollbars
@@ -1398,12 +1937,14 @@ protected:
      *       called from the main thread for UI updates.
      * @see buildQImage() for Image to QImage conversion
      * @see calculateAspectRatioSize() for size calculation
+     * @see ImagePyramid for the pre-scaled levels
      */
     void updateImageDisplay()
     {
-        if (!hasImage) return;
-        
-        QPixmap pixmap = QPixmap::fromImage(buildQImage(currentImage));
+        if (!hasImage) {
+            if (!loadingPath.isEmpty()) showLoadingPreview();
+            return;
+        }
         
         // Get the available space in the scroll area
         QSize scrollAreaSize = ui.scrollArea->size();
@@ -1412,8 +1953,22 @@ protected:
         // Calculate the target size maintaining aspect ratio
         QSize targetSize = calculateAspectRatioSize(QSize(currentImage.width, currentImage.height), availableSize);
          
-         // Scale the image with smooth transformation
-         QPixmap scaledPixmap = pixmap.scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+         // Scale from the smallest pyramid level that still covers the target
+         const bool imageChanged = displayPyramid.sync(currentImage);
+         if (imageChanged || displayPixmap.isNull() || targetSize != displayTargetSize) {
+             displayPixmap = QPixmap::fromImage(
+                 buildQImage(displayPyramid.scaled(std::max(1, targetSize.width()), std::max(1, targetSize.height()))));
+             displayTargetSize = targetSize;
+         } else if (displayChanges.covers(currentImage) && !displayChanges.empty()) {
+             // The pyramid already holds currentImage; repaint the pixels its changed tiles reach
+             QPainter painter(&displayPixmap);
+             for (const ImagePyramid::Patch &patch : displayPyramid.scaledPatches(targetSize.width(), targetSize.height(),
+                                                                                  displayChanges)) {
+                 painter.drawImage(patch.x, patch.y, buildQImage(patch.pixels));
+             }
+         }
+         displayChanges = DirtyRegion();
+         const QPixmap &scaledPixmap = displayPixmap;
          
          // Set the pixmap and ensure the label size matches the scaled image
          ui.imageLabel->setPixmap(scaledPixmap);
@@ -1436,6 +1991,29 @@ protected:
         updatePropertiesPanel();
     }
     
+    /**
+     * @brief Make @p next the current image, given where it differs from the current one.
+     * 
+     * The display pyramid reduces only the changed tiles again, and the next
+     * updateImageDisplay() repaints only the part of the pixmap they reach.
+     * An unknown region (or a pyramid holding another image) leaves the
+     * pyramid to be rebuilt in full, as after any other assignment.
+     * 
+     * @param next The new current image
+     * @param changed Every tile in which @p next differs from currentImage
+     */
+    void replaceCurrentImage(Image next, const DirtyRegion &changed)
+    {
+        if (displayPyramid.update(currentImage, next, changed)) {
+            if (displayChanges.covers(next)) {
+                displayChanges.merge(changed);
+            } else {
+                displayChanges = changed;
+            }
+        }
+        currentImage = std::move(next);
+    }
+
     /**
      * @brief Crop the current image using a selection rectangle relative to the label.
      * @param selectionOnLabel The selection bounds in label coordinates.
@@ -1445,16 +2023,9 @@ protected:
         if (!hasImage) return;
         if (selectionOnLabel.width() <= 1 || selectionOnLabel.height() <= 1) return;
         
-        // Determine the scale used to draw the pixmap on the label
-        QSize scrollAreaSize = ui.scrollArea->size();
-        QSize availableSize(scrollAreaSize.width() - 20, scrollAreaSize.height() - 20);
-        
-        // Calculate the target size maintaining aspect ratio
-        QSize targetSize = calculateAspectRatioSize(QSize(currentImage.width, currentImage.height), availableSize);
-        
-        // Build the current displayed pixmap to get its actual size
-        QPixmap pixmap = QPixmap::fromImage(buildQImage(currentImage));
-        QPixmap scaledPixmap = pixmap.scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        // Determine the scale used to draw the pixmap on the label: it shows the cached display pixmap
+        const QPixmap &scaledPixmap = displayPixmap;
+        if (scaledPixmap.isNull()) return;
         
         // The image is centered inside imageLabel.
         QSize labelSize = ui.imageLabel->size();
@@ -1480,16 +2051,15 @@ protected:
         
         if (newW <= 1 || newH <= 1) return;
         
-        saveStateForUndo();
-        Image result(newW, newH);
-        for (int y = 0; y < newH; y++) {
-            for (int x = 0; x < newW; x++) {
-                for (int c = 0; c < 3; c++) {
-                    result.setPixel(x, y, c, currentImage(x0 + x, y0 + y, c));
-                }
-            }
-        }
-        currentImage = result;
+        FilterCall crop = [x0, y0, newW, newH](Image& image, Image&) {
+            Image cropped(newW, newH);
+            cropped.view().copyFrom(image.constView().subView(x0, y0, newW, newH));
+            image = std::move(cropped);
+        };
+        Image result = currentImage;
+        crop(result, currentImage);
+        saveStateForUndo(result, crop);
+        currentImage = std::move(result);
         updateImageDisplay();
         setActiveFilterValue("Crop");
         updatePropertiesPanel();
@@ -1504,8 +2074,25 @@ protected:
     std::atomic<bool> cancelRequested{false};
     Image preFilterImage; // Store image state before filter for cancellation
     
-    // Undo/Redo system
-    HistoryManager history{20};
+    // Background filter execution
+    QFutureWatcher<FilterResult> filterWatcher; // Delivers the result to finishFilter()
+    bool filterRunning = false;
+    QString pendingFilterName;              // Active filter name once applied
+    std::function<void()> pendingOnApplied; // Extra UI update once applied
+    FilterCall pendingFilterCall;           // Recorded by the command log once applied
+    ReplayInfo pendingReplay{};
+    int pendingHistoryMove = 0;             // -1/+1 while a command-log undo/redo is rebuilt
+    std::size_t pendingHistoryTarget = 0;
+    
+    // Background save
+    QFutureWatcher<SaveResult> saveWatcher; // Delivers the written file to finishSave()
+    QString pendingSavePath;                // Target of the running save, empty if none
+    Image pendingSaveImage;                 // The snapshot being written
+    
+    // Undo/Redo system (PHOTOSMITH_UNDO=commands selects the command log)
+    const bool commandLogUndo = qEnvironmentVariable("PHOTOSMITH_UNDO") == "commands";
+    HistoryManager history; // Byte-budgeted, older states delta-compressed
+    CommandHistory commandHistory; // Operation log with periodic checkpoints
     std::stack<QString> undoFilterNames; // Parallel stack for active filter names
     std::stack<QString> redoFilterNames; // Parallel stack for active filter names
     
@@ -1515,13 +2102,38 @@ protected:
     // Resize handling
     QTimer *resizeTimer;
     
+    // Background loading
+    std::unique_ptr<ImageLoader> imageLoader;             // Decodes off the GUI thread, caches previews
+    QTimer *fullLoadTimer;                                // Starts the full decode once browsing pauses
+    QString loadingPath;                                  // File being loaded, empty when idle
+    bool loadingViaDrop = false;
+    bool imageBeforeLoad = false;                         // hasImage to restore if the load fails
+    Image loadingPreview;                                 // Shown until the full image arrives
+    std::optional<OperationTrace::Stopwatch> loadStopwatch;
+    
+    // Display cache
+    ImagePyramid displayPyramid; // currentImage and its halved copies
+    QPixmap displayPixmap;       // currentImage scaled to displayTargetSize
+    QSize displayTargetSize;
+    DirtyRegion displayChanges;  // Tiles of currentImage changed since displayPixmap was drawn
+    
     // Crop handling
     bool cropping = false;
     QRubberBand *rubberBand = nullptr;
     QPoint cropOrigin;
     
     // Image filters
+    QtProgressReporter* progressReporter; // Forwards filter reports to the progress and status bars
     ImageFilters* imageFilters;
+    
+    // Instrumentation
+    OperationTrace operationTrace;                      // Recent filters, undo/redo and file operations
+    DiagnosticsDialog* diagnosticsDialog = nullptr;     // Created on first use
+
+    // Live preview
+    ImageFilters* previewFilters;                      // Runs filters on previewProxy
+    Image previewProxy;                                // Screen-sized copy of currentImage
+    std::atomic<bool> previewCancelRequested{false};   // Never set: previews are short
 
     // Helpers
     /**
@@ -1603,39 +2215,94 @@ protected:
      * @brief Save the current image using a file dialog.
      * 
      * Opens a save dialog to allow the user to choose a location and format
-     * for saving the current image, then performs the save operation.
+     * for saving the current image, then encodes it on a worker thread.
      * 
-     * @return true if the image was saved successfully, false if cancelled or failed
+     * @param waitForCompletion Block until the file is written, for callers
+     *        that go on to close or replace the image
+     * @return true if the save was started (or, when waiting, succeeded),
+     *         false if cancelled or failed
      * 
      * @details This method:
      * - Opens a Qt file dialog for save location selection
-     * - Handles file format selection (PNG, JPEG, BMP)
-     * - Uses ImageIO for the actual save operation
-     * - Updates the unsaved changes flag on successful save
-     * - Updates the current file path and properties panel
-     * - Provides user feedback through status bar messages
-     * - Handles errors gracefully with error dialogs
+     * - Handles file format selection (every format ImageIO::saveDialogFilter() lists)
+     * - Waits for a previous save that is still being written
+     * - Encodes a snapshot of the image through QtConcurrent (O(1), copy-on-write),
+     *   so editing continues while the file is written
+     * - Leaves the result to finishSave(), which reports errors and marks the
+     *   image saved
      * 
      * @note This method is used internally by save operations and close events.
      * @see ImageIO::saveToFile() for the actual file writing
      * @see SAVE_FILTER for supported file formats
      */
-    bool saveImageWithDialog()
+    bool saveImageWithDialog(bool waitForCompletion = false)
     {
         QString fileName = QFileDialog::getSaveFileName(this,
             "Save Image", QDir::homePath(), SAVE_FILTER);
         if (fileName.isEmpty()) return false;
-        try {
-            ImageIO::saveToFile(currentImage, fileName);
-            hasUnsavedChanges = false; // Mark as saved
-            statusBar()->showMessage(QString("Saved: %1").arg(QFileInfo(fileName).fileName()));
+        if (!waitForSave()) return false;
+
+        pendingSavePath = fileName;
+        pendingSaveImage = currentImage; // O(1): edits made meanwhile detach from it
+        statusBar()->showMessage(QString("Saving %1...").arg(QFileInfo(fileName).fileName()));
+        saveWatcher.setFuture(QtConcurrent::run([image = pendingSaveImage, fileName]() {
+            OperationTrace::Stopwatch stopwatch(("Save " + QFileInfo(fileName).suffix().toLower()).toStdString(), "io",
+                                                pixelCount(image));
+            SaveResult result;
+            try {
+                ImageIO::saveToFile(image, fileName);
+            } catch (const std::exception& e) {
+                result.error = QString::fromUtf8(e.what());
+            }
+            result.trace = stopwatch.stop();
+            return result;
+        }));
+        return waitForCompletion ? waitForSave() : true;
+    }
+
+    /**
+     * @brief Report the save started by saveImageWithDialog() on the GUI thread.
+     * 
+     * @return true if the file was written
+     * 
+     * @details The image is marked saved only if it has not been edited or
+     * replaced since the snapshot was taken, i.e. currentImage still shares
+     * the snapshot's buffer. Does nothing when no save is pending, so the
+     * watcher signal and waitForSave() may both call it.
+     */
+    bool finishSave()
+    {
+        if (pendingSavePath.isEmpty()) return true;
+        SaveResult result = saveWatcher.result();
+        const QString fileName = std::exchange(pendingSavePath, QString());
+        const Image saved = std::exchange(pendingSaveImage, Image());
+
+        if (!result.error.isEmpty()) {
+            recordOperation(std::move(result.trace), "failed");
+            statusBar()->clearMessage();
+            QMessageBox::critical(this, "Error", QString("Failed to save image: %1").arg(result.error));
+            return false;
+        }
+        recordOperation(std::move(result.trace));
+        statusBar()->showMessage(QString("Saved: %1").arg(QFileInfo(fileName).fileName()));
+        if (hasImage && currentImage.imageData == saved.imageData) {
+            hasUnsavedChanges = false;
             currentFilePath = fileName;
             updatePropertiesPanel();
-            return true;
-        } catch (const std::exception& e) {
-            QMessageBox::critical(this, "Error", QString("Failed to save image: %1").arg(e.what()));
-            return false;
         }
+        return true;
+    }
+
+    /**
+     * @brief Block until a running save is written and report it.
+     * 
+     * @return false if the pending save failed
+     */
+    bool waitForSave()
+    {
+        if (pendingSavePath.isEmpty()) return true;
+        saveWatcher.waitForFinished();
+        return finishSave();
     }
 
     /**
@@ -1661,9 +2328,13 @@ protected:
     {
         // Clear undo/redo history
         history.clear();
+        commandHistory.clear();
         updateUndoRedoButtons();
-        // Reset image label
+        // Reset image label and release the display cache
         ui.imageLabel->clear();
+        displayPyramid.clear();
+        displayPixmap = QPixmap();
+        displayChanges = DirtyRegion();
         ui.imageLabel->setText("No image loaded\nClick 'Load Image' or drag & drop an image here");
         // Reset minimum window size and disable buttons
         updateMinimumWindowSize();
@@ -1711,6 +2382,7 @@ protected:
         updateMinimumWindowSize();
         refreshButtons(true);
         history.clear();
+        commandHistory.clear();
         updateUndoRedoButtons();
         const QString baseName = QFileInfo(filePath).fileName();
         statusBar()->showMessage(viaDrop ? QString("Loaded via drag & drop: %1").arg(baseName)
@@ -1724,38 +2396,161 @@ protected:
     }
 
     /**
-     * @brief Load an image from the specified file path.
+     * @brief Start loading an image from the specified file path.
      * 
-     * Loads an image from the given file path using the ImageIO class,
-     * handling errors gracefully and updating the application state.
+     * Hands the file to the background ImageLoader and returns at once; the
+     * UI stays responsive while it decodes. A cached preview, when there is
+     * one, is shown immediately and replaced by the full image once it
+     * arrives in finishLoad().
      * 
      * @param filePath The path to the image file to load
      * @param viaDrop Whether the image was loaded via drag and drop
      * 
      * @details This method:
-     * - Uses ImageIO to load the image with proper error handling
-     * - Sets both original and current image references
-     * - Marks that an image is loaded
-     * - Calls finalizeSuccessfulLoad() to complete the setup
-     * - Shows error dialogs and status messages on failure
-     * 
-     * @note This method is the main entry point for image loading operations.
-     * @see ImageIO::loadFromFile() for the actual file loading
-     * @see finalizeSuccessfulLoad() for post-load setup
+     * - Suspends the current image (editing is disabled until the load ends)
+     * - Requests the full-resolution image from the loader
+     * - Starts the load timing for the diagnostics trace
      * 
-     * @throws std::exception if image loading fails (handled internally)
+     * @note A failed load restores the previous image untouched.
+     * @see finishLoad() for installing the result
+     * @see ImageLoader for decoding and caching
      */
     void loadImageFromPath(const QString &filePath, bool viaDrop)
     {
-        try {
-            originalImage = ImageIO::loadFromFile(filePath);
-            currentImage = originalImage;
-            hasImage = true;
-            finalizeSuccessfulLoad(filePath, viaDrop);
-        } catch (const std::exception& e) {
-            QMessageBox::critical(this, "Error", QString("Failed to load image: %1").arg(e.what()));
+        beginLoad(filePath, viaDrop);
+        imageLoader->open(filePath.toStdString(), ImageLoader::Level::Full);
+    }
+
+    /**
+     * @brief Record that @p filePath is being fetched and lock editing until it arrives.
+     */
+    void beginLoad(const QString &filePath, bool viaDrop)
+    {
+        if (loadingPath.isEmpty()) imageBeforeLoad = hasImage;
+        hasImage = false; // the current image is kept for a failed load, but not editable meanwhile
+        refreshButtons(false);
+        fullLoadTimer->stop();
+        loadingPath = filePath;
+        loadingViaDrop = viaDrop;
+        loadingPreview = Image();
+        loadStopwatch.emplace(("Load " + QFileInfo(filePath).suffix().toLower()).toStdString(), "io");
+        statusBar()->showMessage(QString("Loading %1...").arg(QFileInfo(filePath).fileName()));
+    }
+
+    /**
+     * @brief Install a result delivered by the ImageLoader.
+     * 
+     * @param result Preview or full image for a requested file, or its error
+     * 
+     * @details Results for files other than the one being loaded (earlier
+     * requests, prefetched neighbours) are ignored. A preview is displayed
+     * until the full image arrives; the full image becomes the original and
+     * current image exactly as a synchronous load did.
+     */
+    void finishLoad(const ImageLoader::Result &result)
+    {
+        if (loadingPath.isEmpty() || QString::fromStdString(result.path) != loadingPath) return;
+        const QString filePath = loadingPath;
+
+        if (!result.error.empty()) {
+            recordOperation(loadStopwatch->stop(), "failed");
+            endLoad();
+            hasImage = imageBeforeLoad;
+            if (hasImage) {
+                refreshButtons(true);
+                updateUndoRedoButtons();
+                updateImageDisplay();
+            } else {
+                resetUiToNoImageState();
+            }
+            QMessageBox::critical(this, "Error", QString("Failed to load image: %1").arg(result.error.c_str()));
             statusBar()->showMessage("Failed to load image");
+            return;
+        }
+
+        if (result.level != ImageLoader::Level::Full) {
+            loadingPreview = result.image;
+            showLoadingPreview();
+            return;
         }
+
+        OperationTrace::Record record = loadStopwatch->stop();
+        record.pixels = pixelCount(result.image);
+        const bool viaDrop = loadingViaDrop;
+        endLoad();
+        originalImage = result.image;
+        recordOperation(std::move(record));
+        currentImage = originalImage;
+        hasImage = true;
+        finalizeSuccessfulLoad(filePath, viaDrop);
+    }
+
+    /**
+     * @brief Forget the load in progress.
+     */
+    void endLoad()
+    {
+        fullLoadTimer->stop();
+        loadingPath.clear();
+        loadingPreview = Image();
+        loadStopwatch.reset();
+    }
+
+    /**
+     * @brief Display the preview of the image being loaded, scaled to the window.
+     */
+    void showLoadingPreview()
+    {
+        if (loadingPreview.width <= 0 || loadingPreview.height <= 0) return;
+        const QSize scrollAreaSize = ui.scrollArea->size();
+        const QSize availableSize(scrollAreaSize.width() - 20, scrollAreaSize.height() - 20);
+        const QSize targetSize = calculateAspectRatioSize(QSize(loadingPreview.width, loadingPreview.height), availableSize);
+        displayPixmap = QPixmap::fromImage(
+            buildQImage(loadingPreview).scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+        displayTargetSize = QSize(); // the next full image repaints regardless
+        ui.imageLabel->setPixmap(displayPixmap);
+        ui.imageLabel->setText("");
+        ui.imageLabel->resize(displayPixmap.size());
+        statusBar()->showMessage(QString("%1 (preview)").arg(QFileInfo(loadingPath).fileName()));
+    }
+
+    /**
+     * @brief Step @p offset images through the directory of the current file.
+     * 
+     * Shows the neighbour's cached or quickly decoded preview at once; the
+     * full image is only decoded after browsing pauses (fullLoadTimer), so
+     * holding the key flips through previews without full decodes.
+     * 
+     * @param offset -1 for the previous image, +1 for the next
+     */
+    void browse(int offset)
+    {
+        const QString from = loadingPath.isEmpty() ? currentFilePath : loadingPath;
+        if (from.isEmpty() || filterRunning) return;
+        const std::string next = imageLoader->neighbour(from.toStdString(), offset);
+        if (next.empty()) {
+            statusBar()->showMessage(offset < 0 ? "First image in this folder" : "Last image in this folder");
+            return;
+        }
+        if (loadingPath.isEmpty() && hasImage && hasUnsavedChanges && !confirmDiscardChanges()) return;
+
+        beginLoad(QString::fromStdString(next), false);
+        imageLoader->open(loadingPath.toStdString(), ImageLoader::Level::Preview);
+        fullLoadTimer->start();
+    }
+
+    /**
+     * @brief Ask whether unsaved edits may be dropped, offering to save them first.
+     * 
+     * @return true to continue (saved or discarded), false if the user cancelled
+     */
+    bool confirmDiscardChanges()
+    {
+        const QMessageBox::StandardButton reply = QMessageBox::question(this, "Unsaved Changes",
+            "The image has unsaved changes. Do you want to save before opening another image?",
+            QMessageBox::Save | QMessageBox::Discard | QMessageBox::Cancel);
+        if (reply == QMessageBox::Save) return saveImageWithDialog(true);
+        return reply == QMessageBox::Discard;
     }
 
     /**
@@ -1789,6 +2584,8 @@ protected:
      * @param label The label text for the dialog
      * @param defaultValue The initial slider value (clamped to 0-100)
      * @param ok Pointer to boolean to receive success status (can be nullptr)
+     * @param onValueChanged Optional callback run with the initial value and
+     *        after every change, at most once per event-loop pass (live preview)
      * @return The selected percentage value (0-100)
      * 
      * @details The dialog includes:
@@ -1802,7 +2599,8 @@ protected:
      *       for operations like blur strength and brightness adjustment.
      * @see QSlider for the underlying slider widget
      */
-    int getPercentWithSlider(const QString &title, const QString &label, int defaultValue, bool *ok)
+    int getPercentWithSlider(const QString &title, const QString &label, int defaultValue, bool *ok,
+                             const std::function<void(int)> &onValueChanged = {})
     {
         // Build a tiny dialog with a slider 0-100 and OK/Cancel
         QDialog dialog(this);
@@ -1828,12 +2626,93 @@ protected:
         int resultPercent = slider->value();
         QObject::connect(okBtn, &QPushButton::clicked, &dialog, [&](){ resultPercent = slider->value(); dialog.accept(); });
         QObject::connect(cancelBtn, &QPushButton::clicked, &dialog, [&](){ dialog.reject(); });
+        if (onValueChanged) {
+            QTimer *previewTimer = makePreviewTimer(&dialog, [slider, onValueChanged]() { onValueChanged(slider->value()); });
+            QObject::connect(slider, &QSlider::valueChanged, previewTimer, qOverload<>(&QTimer::start));
+        }
 
         int res = dialog.exec();
         if (ok) *ok = (res == QDialog::Accepted);
         return resultPercent;
     }
 
+    /**
+     * @brief Prepare a live preview on a screen-sized proxy of the current image.
+     * 
+     * The proxy is the display pyramid level the viewport is drawn from, so it
+     * costs no extra memory, and previewFilters scales pixel-sized parameters
+     * (blur radius, frame width) to it. Call showPreview() for each parameter
+     * change and endPreview() once the dialog closes; only the committed filter
+     * runs at full resolution.
+     * 
+     * @see ImagePyramid::levelFor() for the proxy
+     * @see ImageFilters::setPixelScale() for parameter scaling
+     */
+    void beginPreview()
+    {
+        displayPyramid.sync(currentImage);
+        const QSize target = displayTargetSize.isValid() ? displayTargetSize : QSize(currentImage.width, currentImage.height);
+        previewProxy = displayPyramid.levelFor(target.width(), target.height());
+        previewFilters->setPixelScale(static_cast<double>(previewProxy.width) / currentImage.width);
+    }
+    
+    /**
+     * @brief Show a filter applied to the preview proxy in the image label.
+     * 
+     * @param preview Filter applied to a copy of the proxy; must use previewFilters
+     * 
+     * @note Runs on the GUI thread; at proxy resolution filters take milliseconds.
+     */
+    void showPreview(const FilterCall &preview)
+    {
+        if (previewProxy.byteSize() == 0) return;
+        Image image = previewProxy; // O(1): the filter detaches its own copy
+        Image before = previewProxy;
+        preview(image, before);
+        
+        // Display at the size the full-resolution result would have (frames grow the image)
+        const double scale = previewFilters->getPixelScale();
+        const QSize fullSize(static_cast<int>(std::lround(image.width / scale)), static_cast<int>(std::lround(image.height / scale)));
+        QSize scrollAreaSize = ui.scrollArea->size();
+        QSize availableSize(scrollAreaSize.width() - 20, scrollAreaSize.height() - 20);
+        QSize targetSize = calculateAspectRatioSize(fullSize, availableSize);
+        QPixmap pixmap = QPixmap::fromImage(buildQImage(image).scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+        ui.imageLabel->setPixmap(pixmap);
+        ui.imageLabel->resize(pixmap.size());
+    }
+    
+    /**
+     * @brief Leave preview mode and show the current image again.
+     */
+    void endPreview()
+    {
+        previewProxy = Image();
+        previewFilters->setPixelScale(1.0);
+        ui.imageLabel->setPixmap(displayPixmap);
+        ui.imageLabel->resize(displayPixmap.size());
+    }
+    
+    /**
+     * @brief Create a timer that coalesces parameter changes into one preview.
+     * 
+     * Start the timer whenever a parameter changes; @p render then runs once
+     * per event-loop pass, however many changes arrived. It also runs once
+     * right after the dialog opens.
+     * 
+     * @param dialog Dialog owning the timer
+     * @param render Function rendering the preview for the current parameters
+     * @return The timer, owned by @p dialog
+     */
+    QTimer *makePreviewTimer(QDialog *dialog, std::function<void()> render)
+    {
+        QTimer *timer = new QTimer(dialog);
+        timer->setSingleShot(true);
+        timer->setInterval(0);
+        QObject::connect(timer, &QTimer::timeout, dialog, std::move(render));
+        timer->start();
+        return timer;
+    }
+
     /**
      * @brief Calculate the optimal display size maintaining aspect ratio.
      * 
@@ -1884,35 +2763,20 @@ protected:
      * Runs a filter operation that can be cancelled by the user, providing
      * progress tracking and the ability to restore the previous state.
      * 
-     * @param filterCall Function to execute for the filter operation
-     * 
-     * @details This method:
-     * - Resets the cancellation flag
-     * - Saves the current image state for potential restoration
-     * - Saves state for undo functionality
-     * - Shows the cancel button for user interaction
-     * - Executes the filter operation
-     * - Updates the image display on success
-     * - Handles errors gracefully with error dialogs
-     * - Hides the cancel button when complete
+     * @param filterName Name shown in the properties panel once the filter is applied
+     * @param filterCall Function applying the filter to the worker's image copy
+     * @param onApplied Optional extra UI update run after the filter is applied
+     * @param replay How the command-log history may replay or invert the filter
      * 
      * @note This method is used for long-running operations that support
      *       cancellation, such as grayscale, blur, and infrared filters.
+     * @see startFilter() for how the filter is executed
      * @see runSimpleFilter() for operations without cancellation support
      */
-    void runCancelableFilter(const std::function<void()> &filterCall)
+    void runCancelableFilter(const QString &filterName, FilterCall filterCall, std::function<void()> onApplied = {},
+                             ReplayInfo replay = {})
     {
-        cancelRequested = false;
-        preFilterImage = currentImage;
-        saveStateForUndo();
-        ui.cancelButton->setVisible(true);
-        try {
-            filterCall();
-            updateImageDisplay();
-        } catch (const std::exception& e) {
-            QMessageBox::critical(this, "Error", QString("Filter failed: %1").arg(e.what()));
-        }
-        ui.cancelButton->setVisible(false);
+        startFilter(filterName, std::move(filterCall), std::move(onApplied), true, std::move(replay));
     }
 
     /**
@@ -1921,27 +2785,168 @@ protected:
      * Runs a filter operation that completes quickly and doesn't require
      * cancellation support or progress tracking.
      * 
-     * @param filterCall Function to execute for the filter operation
-     * 
-     * @details This method:
-     * - Saves state for undo functionality
-     * - Executes the filter operation
-     * - Updates the image display on success
-     * - Handles errors gracefully with error dialogs
+     * @param filterName Name shown in the properties panel once the filter is applied
+     * @param filterCall Function applying the filter to the worker's image copy
+     * @param onApplied Optional extra UI update run after the filter is applied
+     * @param replay How the command-log history may replay or invert the filter
      * 
      * @note This method is used for immediate operations that don't need
      *       cancellation support, such as flip, rotate, and edge detection.
+     * @see startFilter() for how the filter is executed
      * @see runCancelableFilter() for operations with cancellation support
      */
-    void runSimpleFilter(const std::function<void()> &filterCall)
+    void runSimpleFilter(const QString &filterName, FilterCall filterCall, std::function<void()> onApplied = {},
+                         ReplayInfo replay = {})
     {
-        saveStateForUndo();
-        try {
-            filterCall();
-            updateImageDisplay();
-        } catch (const std::exception& e) {
-            QMessageBox::critical(this, "Error", QString("Filter failed: %1").arg(e.what()));
+        startFilter(filterName, std::move(filterCall), std::move(onApplied), false, std::move(replay));
+    }
+
+    /**
+     * @brief Start a filter on a worker thread and return immediately.
+     * 
+     * @param filterName Name recorded for the properties panel and undo history
+     * @param filterCall Function applying the filter to the worker's image copy
+     * @param onApplied Optional extra UI update run after the filter is applied
+     * @param cancelable Whether to show the Cancel button while the filter runs
+     * @param replay How the command-log history may replay or invert the filter
+     * 
+     * @details This method:
+     * - Ignores the request if another filter is still running
+     * - Resets the cancellation flag
+     * - Snapshots the current image for cancellation (O(1), copy-on-write)
+     * - Locks the image controls and shows the cancel button if requested
+     * - Runs the filter through QtConcurrent on a copy of the image, so the
+     *   GUI keeps painting and handling events while it works
+     * 
+     * The displayed image and the undo history are untouched until
+     * finishFilter() receives the result on the GUI thread.
+     * 
+     * @see finishFilter() for result handling
+     */
+    void startFilter(const QString &filterName, FilterCall filterCall, std::function<void()> onApplied, bool cancelable,
+                     ReplayInfo replay = {})
+    {
+        if (filterRunning) return;
+        cancelRequested = false;
+        preFilterImage = currentImage; // O(1): shares the buffer copy-on-write
+        pendingFilterName = filterName;
+        pendingOnApplied = std::move(onApplied);
+        pendingFilterCall = filterCall;
+        pendingReplay = std::move(replay);
+        setFilterRunning(true, cancelable);
+
+        filterWatcher.setFuture(QtConcurrent::run(
+            [filterCall = std::move(filterCall), image = currentImage, before = preFilterImage,
+             name = filterName.toStdString()]() mutable {
+                OperationTrace::Stopwatch stopwatch(name, "filter", pixelCount(image));
+                FilterResult result;
+                try {
+                    filterCall(image, before);
+                    // Compared here, off the GUI thread; display and history then touch only these tiles
+                    result.changed = DirtyRegion::between(before, image);
+                    result.image = std::move(image);
+                } catch (const std::exception& e) {
+                    result.error = QString::fromUtf8(e.what());
+                }
+                result.trace = stopwatch.stop();
+                return result;
+            }));
+    }
+
+    /**
+     * @brief Apply the result of the finished filter on the GUI thread.
+     * 
+     * @details This method:
+     * - Unlocks the image controls and hides the cancel button
+     * - Reports filter exceptions with an error dialog
+     * - Hands command-log undo/redo results to finishHistoryMove()
+     * - Discards the result if the user cancelled
+     * - Otherwise saves the previous image for undo, swaps in the result and
+     *   updates the display and properties panel, passing both the tiles
+     *   the filter changed
+     */
+    void finishFilter()
+    {
+        FilterResult result = filterWatcher.result();
+        FilterCall operation = std::move(pendingFilterCall); // Release captures once handled
+        setFilterRunning(false, false);
+
+        if (pendingHistoryMove != 0) {
+            finishHistoryMove(result);
+            return;
+        }
+        if (!result.error.isEmpty()) {
+            recordOperation(std::move(result.trace), "failed");
+            QMessageBox::critical(this, "Error", QString("Filter failed: %1").arg(result.error));
+            return;
+        }
+        if (cancelRequested) {
+            recordOperation(std::move(result.trace), "cancelled");
+            statusBar()->showMessage(QString("%1 cancelled").arg(pendingFilterName));
+            return;
+        }
+
+        // currentImage still holds the pre-filter state
+        saveStateForUndo(result.image, operation, pendingReplay, result.changed);
+        recordOperation(std::move(result.trace));
+        replaceCurrentImage(std::move(result.image), result.changed);
+        updateImageDisplay();
+        setActiveFilterValue(pendingFilterName);
+        if (pendingOnApplied) pendingOnApplied();
+        updatePropertiesPanel();
+    }
+
+    /**
+     * @brief Lock or unlock the UI around a running filter.
+     * 
+     * While a filter runs, every control that could change or replace the
+     * current image is disabled; only the Cancel button stays usable.
+     * 
+     * @param running True while a filter is executing
+     * @param cancelable Whether to show the Cancel button
+     */
+    void setFilterRunning(bool running, bool cancelable)
+    {
+        filterRunning = running;
+        refreshButtons(!running);
+        ui.loadButton->setEnabled(!running);
+        ui.cameraButton->setEnabled(!running);
+        for (QMenu *menu : {ui.fileMenu, ui.filterMenu}) {
+            for (QAction *action : menu->actions()) {
+                if (action != ui.actionExit && action != ui.actionDiagnostics) action->setEnabled(!running);
+            }
         }
+        ui.cancelButton->setVisible(running && cancelable);
+        if (!running) updateUndoRedoButtons();
+    }
+
+    /**
+     * @brief Pixels in @p image, as counted by the operation trace.
+     */
+    static std::uint64_t pixelCount(const Image &image)
+    {
+        return static_cast<std::uint64_t>(image.width) * static_cast<std::uint64_t>(image.height);
+    }
+
+    /**
+     * @brief Bytes held by whichever undo history is active.
+     */
+    std::size_t historyMemory() const
+    {
+        return commandLogUndo ? commandHistory.memoryUsage() : history.memoryUsage();
+    }
+
+    /**
+     * @brief Log a finished operation in the diagnostics trace.
+     * 
+     * @param record Measurements from an OperationTrace::Stopwatch
+     * @param outcome "ok", "cancelled" or "failed"
+     */
+    void recordOperation(OperationTrace::Record record, const char *outcome = "ok")
+    {
+        record.outcome = outcome;
+        record.historyBytes = historyMemory();
+        operationTrace.add(std::move(record));
     }
 
     /**
@@ -1955,28 +2960,47 @@ protected:
      * @return QImage object ready for Qt display
      * 
      * @details This method:
-     * - Creates a QImage with RGB888 format
-     * - Iterates through all pixels in the image
-     * - Converts RGB values from the Image format to Qt format
-     * - Returns a QImage ready for display or further processing
+     * - Wraps the pixel buffer as an RGB888 QImage with a stride of width * 3,
+     *   without copying it
+     * - Keeps a copy-on-write reference to the buffer alive for as long as the
+     *   QImage (or any copy of it) exists, so later edits to @p img detach
+     *   instead of changing what the QImage shows
+     * - Returns a read-only QImage: Qt copies it if anything writes to it
      * 
-     * @note This method performs a complete copy of the image data and
-     *       should be used efficiently for large images.
      * @see QImage for Qt image format details
      * @see Image class for the source image format
      */
-    QImage buildQImage(const Image &img)
+    static QImage buildQImage(const Image &img)
     {
-        QImage qimg(img.width, img.height, QImage::Format_RGB888);
-        for (int y = 0; y < img.height; y++) {
-            for (int x = 0; x < img.width; x++) {
-                int r = img(x, y, 0);
-                int g = img(x, y, 1);
-                int b = img(x, y, 2);
-                qimg.setPixel(x, y, qRgb(r, g, b));
-            }
+        if (img.byteSize() == 0) return QImage();
+        auto *owner = new Image(img); // O(1): shares the buffer copy-on-write
+        const uchar *pixels = owner->imageData;
+        return QImage(pixels, owner->width, owner->height, static_cast<qsizetype>(owner->width) * 3,
+                      QImage::Format_RGB888, [](void *info) { delete static_cast<Image *>(info); }, owner);
+    }
+
+    /**
+     * @brief Copy a QImage into a new RGB Image.
+     * 
+     * @param source Image in any format; camera frames arrive as 32-bit RGB or YUV
+     * @return The pixels, or an empty Image if @p source is null
+     * 
+     * @details Converts to RGB888 only when @p source is in another format,
+     * then copies row by row, since QImage pads its rows to 4 bytes.
+     * 
+     * @see buildQImage() for the opposite direction
+     */
+    static Image imageFromQImage(const QImage &source)
+    {
+        if (source.isNull()) return Image();
+        const QImage rgb = source.format() == QImage::Format_RGB888 ? source
+                                                                    : source.convertToFormat(QImage::Format_RGB888);
+        Image img(rgb.width(), rgb.height());
+        const size_t rowBytes = static_cast<size_t>(rgb.width()) * 3;
+        for (int y = 0; y < rgb.height(); ++y) {
+            std::memcpy(img.imageData + static_cast<size_t>(y) * rowBytes, rgb.constScanLine(y), rowBytes);
         }
-        return qimg;
+        return img;
     }
 };
 
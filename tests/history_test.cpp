@@ -0,0 +1,201 @@
+/**
+ * @file history_test.cpp
+ * @brief Round-trip tests for HistoryManager and its dirty maps.
+ *
+ * Pushes edits on a synthetic image, undoes and redoes them, and checks that
+ * every restored state is byte-identical to the image it was pushed as. The
+ * cases cover dirty maps from DirtyRegion::between(), a reset recorded as an
+ * edit, and a current image replaced without pushUndo() (see
+ * HistoryManager::currentReplaced()).
+ *
+ * @code
+ * cmake -DPHOTOSMITH_BUILD_TESTS=ON .. && ctest
+ * @endcode
+ *
+ * @author Team Members:
+ * - Ahmed Mohamed ElSayed Tolba (ID: 20242023)
+ * - Eyad Mohamed Saad Ali (ID: 20242062)
+ * - Tarek Sami Mohamed Mohamed (ID: 20242190)
+ *
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 2.0.0
+ * @date October 13, 2025
+ * @copyright FCAI Cairo University
+ */
+
+#include "image/Image_Class.h"
+#include "image/DirtyRegion.h"
+#include "history/HistoryManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& what)
+{
+    if (!condition) {
+        std::fprintf(stderr, "FAIL: %s\n", what.c_str());
+        ++failures;
+    }
+}
+
+/**
+ * @brief Deep copy, so a state kept by the test never shares the history's buffer.
+ */
+Image copyOf(const Image& image)
+{
+    Image copy(image.width, image.height, image.format());
+    std::memcpy(copy.imageData, image.imageData, image.byteSize());
+    return copy;
+}
+
+bool sameBytes(const Image& a, const Image& b)
+{
+    return a.width == b.width && a.height == b.height && a.format() == b.format()
+        && std::memcmp(a.imageData, b.imageData, a.byteSize()) == 0;
+}
+
+/**
+ * @brief A 1024x1024 RGB image with smooth gradients and some hashed texture.
+ */
+Image makeImage()
+{
+    Image image(1024, 1024);
+    std::uint32_t state = 12345;
+    for (int y = 0; y < image.height; ++y) {
+        for (int x = 0; x < image.width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            image(x, y, 0) = static_cast<unsigned char>(x / 4);
+            image(x, y, 1) = static_cast<unsigned char>(y / 4);
+            image(x, y, 2) = static_cast<unsigned char>((x + y) / 8 + (state >> 29));
+        }
+    }
+    return image;
+}
+
+/**
+ * @brief Inverts rows [@p rowBegin, @p rowEnd), like a filter applied to a selection.
+ */
+Image inverted(const Image& image, int rowBegin, int rowEnd)
+{
+    Image result = copyOf(image);
+    for (int y = rowBegin; y < rowEnd; ++y)
+        for (int x = 0; x < result.width; ++x)
+            for (int c = 0; c < result.channels; ++c) result(x, y, c) = 255 - result(x, y, c);
+    return result;
+}
+
+/**
+ * @brief Turns rows [@p rowBegin, @p rowEnd) gray.
+ */
+Image grayscale(const Image& image, int rowBegin, int rowEnd)
+{
+    Image result = copyOf(image);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        for (int x = 0; x < result.width; ++x) {
+            const int sum = result(x, y, 0) + result(x, y, 1) + result(x, y, 2);
+            for (int c = 0; c < 3; ++c) result(x, y, c) = static_cast<unsigned char>(sum / 3);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief What the editor does for a filter: push the current image with its dirty map, then replace it.
+ *
+ * The new image is a copy, so no state in the history shares its buffer with
+ * the test (shared states are never packed).
+ */
+void edit(HistoryManager& history, Image& current, const Image& next)
+{
+    history.pushUndo(current, DirtyRegion::between(current, next));
+    current = copyOf(next);
+}
+
+/**
+ * @brief invert -> grayscale -> reset -> invert, with the reset recorded as an edit.
+ *
+ * The edits touch different halves of the image, so the dirty maps have clean
+ * tiles that are stored as references to the neighbouring state.
+ */
+void testRecordedReset()
+{
+    HistoryManager history;
+    const Image original = makeImage();
+    Image current = copyOf(original);
+
+    edit(history, current, inverted(current, 0, 512));
+    const Image gray = grayscale(current, 512, 1024);
+    edit(history, current, gray);
+    edit(history, current, original);
+    const Image last = inverted(current, 0, 512);
+    edit(history, current, last);
+
+    check(history.undo(current) && sameBytes(current, original), "recorded reset: first undo gives the original");
+    check(history.undo(current) && sameBytes(current, gray), "recorded reset: second undo gives the grayscale image");
+    check(history.redo(current) && sameBytes(current, original), "recorded reset: redo gives the original");
+    check(history.redo(current) && sameBytes(current, last), "recorded reset: redo gives the last edit");
+}
+
+/**
+ * @brief The same sequence, with the reset replacing the current image outside the history.
+ */
+void testUnrecordedReplacement()
+{
+    HistoryManager history;
+    const Image original = makeImage();
+    Image current = copyOf(original);
+
+    const Image first = inverted(current, 0, 512);
+    edit(history, current, first);
+    edit(history, current, grayscale(current, 512, 1024));
+    current = copyOf(original);
+    history.currentReplaced();
+    edit(history, current, inverted(current, 0, 512));
+
+    check(history.undo(current) && sameBytes(current, original), "unrecorded replacement: first undo gives the original");
+    check(history.undo(current) && sameBytes(current, first), "unrecorded replacement: second undo gives the inverted image");
+    check(history.undo(current) && sameBytes(current, original), "unrecorded replacement: third undo gives the original");
+    check(!history.canUndo(), "unrecorded replacement: history is exhausted");
+}
+
+/**
+ * @brief Undoing with a dirty map reports the tiles that changed, and only those.
+ */
+void testRegionEdit()
+{
+    HistoryManager history;
+    Image current = makeImage();
+    const Image before = copyOf(current);
+
+    Image next = copyOf(current);
+    for (int y = 300; y < 340; ++y)
+        for (int x = 500; x < 700; ++x) next(x, y, 1) = 0;
+    edit(history, current, next);
+    edit(history, current, inverted(current, 0, current.height));
+
+    check(history.undo(current) && sameBytes(current, next), "region edit: first undo gives the partial edit");
+    DirtyRegion changed;
+    check(history.undo(current, &changed) && sameBytes(current, before), "region edit: second undo gives the original");
+    check(changed.covers(current), "region edit: undo reports a dirty map");
+    const DirtyRegion::Rect bounds = changed.bounds();
+    check(bounds.x <= 500 && bounds.y <= 300 && bounds.x + bounds.width >= 700 && bounds.y + bounds.height >= 340,
+          "region edit: the dirty map covers the edit");
+    check(changed.dirtyTiles() < static_cast<std::size_t>(64), "region edit: the dirty map is not the whole image");
+}
+
+} // namespace
+
+int main()
+{
+    testRecordedReset();
+    testUnrecordedReplacement();
+    testRegionEdit();
+    if (failures == 0) std::printf("history: all tests passed\n");
+    return failures == 0 ? 0 : 1;
+}